@@ -22,14 +22,31 @@
 
 #include "Communications.hh"
 
+#include <algorithm>
 #include <cerrno>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 
 #include <assert.h>
 #include <config.h>
 
+#ifdef HAVE_SYS_EPOLL_H
+#define RTIA_USES_EPOLL
+#include <sys/epoll.h>
+#endif
+
+#ifdef CERTI_RTIA_NETWORK_THREAD
+#include <sys/socket.h>
+#endif
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#endif
+
 #include <libCERTI/M_Classes.hh>
 #include <libCERTI/NM_Classes.hh>
 #include <libCERTI/PrettyDebug.hh>
@@ -48,6 +65,80 @@ namespace rtia {
 static PrettyDebug D("RTIA_COMM", "(RTIA Comm) ");
 static PrettyDebug G("GENDOC", __FILE__);
 
+namespace {
+/// Attribute updates and interactions wait at most 1 ms for the next ones...
+constexpr long DEFAULT_BATCH_DELAY = 1000;
+/// ...or until they fill 32 KiB.
+constexpr size_t DEFAULT_BATCH_SIZE = 32 * 1024;
+/// An update waits at most 100 ms for the RTIA of a subscriber to answer, then goes through the RTIG.
+constexpr int PEER_CONNECT_TIMEOUT = 100;
+}
+
+namespace {
+/// Whether the read ahead buffer of the socket holds at least one complete message.
+bool hasCompleteMessage(const SocketTCP& socket)
+{
+    size_t length;
+    const unsigned char* data = socket.bufferedData(length);
+
+    return length >= MessageBuffer::reservedBytes && length >= MessageBuffer::sizeFromReservedBytes(data);
+}
+
+#ifndef _WIN32
+/** Writing to an RTIA which went away must fail, not raise SIGPIPE, which
+ * the RTIA takes as a request to end.
+ */
+class SigpipeBlocker {
+public:
+    SigpipeBlocker()
+    {
+        sigemptyset(&my_sigpipe);
+        sigaddset(&my_sigpipe, SIGPIPE);
+        pthread_sigmask(SIG_BLOCK, &my_sigpipe, &my_previous);
+    }
+
+    ~SigpipeBlocker()
+    {
+        // discard the SIGPIPE raised meanwhile
+        sigset_t pending;
+        sigpending(&pending);
+        if (sigismember(&pending, SIGPIPE)) {
+            struct timespec now = {0, 0};
+            sigtimedwait(&my_sigpipe, NULL, &now);
+        }
+        pthread_sigmask(SIG_SETMASK, &my_previous, NULL);
+    }
+
+private:
+    sigset_t my_sigpipe;
+    sigset_t my_previous;
+};
+#endif
+}
+
+#ifdef RTIA_USES_EPOLL
+namespace {
+/// @return an epoll instance watching the given sockets, -1 on failure
+int createEpoll(const int* fds, int count)
+{
+    int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+        return -1;
+    }
+    for (int i = 0; i < count; ++i) {
+        struct epoll_event event;
+        event.events = EPOLLIN;
+        event.data.fd = fds[i];
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fds[i], &event) < 0) {
+            close(epoll_fd);
+            return -1;
+        }
+    }
+    return epoll_fd;
+}
+}
+#endif
+
 NetworkMessage* Communications::waitMessage(NetworkMessage::Type type_msg, FederateHandle numeroFedere)
 {
     assert(static_cast<std::underlying_type<NetworkMessage::Type>::type>(type_msg) > 0
@@ -64,14 +155,24 @@ NetworkMessage* Communications::waitMessage(NetworkMessage::Type type_msg, Feder
     }
 
     // Otherwise, wait for a message with same type than expected and with
-    // same federate number.
-    msg = NM_Factory::receive(socketTCP);
+    // same federate number. The RTIG may need the batch to answer.
+    flushMessages();
+    msg = receiveFromRTIG();
 
     Debug(D, pdProtocol) << "TCP Message of Type " << static_cast<int>(type_msg) << "has arrived." << std::endl;
 
     while ((msg->getMessageType() != type_msg) || ((numeroFedere != 0) && (msg->getFederate() != numeroFedere))) {
-        waitingList.push_back(msg);
-        msg = NM_Factory::receive(socketTCP);
+        // Reflections and interactions go straight to the RTIA queues, unless
+        // an older message is set aside (it may be the discovery of the object).
+        const bool data_plane = msg->getMessageType() == NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES
+            || msg->getMessageType() == NetworkMessage::Type::RECEIVE_INTERACTION;
+        if (data_plane && waitingList.empty() && dataMessageHandler) {
+            dataMessageHandler(msg);
+        }
+        else {
+            park(msg);
+        }
+        msg = receiveFromRTIG();
         Debug(D, pdProtocol) << "Message of Type " << static_cast<int>(type_msg) << " has arrived." << std::endl;
     }
 
@@ -85,17 +186,34 @@ Communications::Communications(int RTIA_port, int RTIA_fd)
     char nom_serveur_RTIG[200];
     const char* default_host = "localhost";
 
+#ifndef _WIN32
+    // behaves as a plain SocketUN until the federate asks for the rings
+    socketSHMRing = new SocketSHMRing();
+    socketUN = socketSHMRing;
+#else
     socketUN = new SocketUN();
-#ifdef FEDERATION_USES_MULTICAST
-    socketMC = new SocketMC();
 #endif
+    // only a plain TCP link may be replaced with the local socket of the RTIG
+    bool plain_tcp = false;
     if (getenv("CERTI_HTTP_PROXY") != NULL || getenv("http_proxy") != NULL)
         socketTCP = new SocketHTTPProxy();
-    else
+    else {
 #ifdef WITH_GSSAPI
         socketTCP = new SecureTCPSocket();
 #else
         socketTCP = new SocketTCP();
+        plain_tcp = true;
+#endif
+    }
+#ifdef SOCKTCP_LOCAL_SOCKET
+    // behaves as a plain SocketTCP until the RTIG accepts the rings
+    socketRTIGRings = NULL;
+    const char* rtig_transport = getenv("CERTI_RTIG_TRANSPORT");
+    if (plain_tcp && rtig_transport && strcmp(rtig_transport, "shm") == 0) {
+        delete socketTCP;
+        socketRTIGRings = new SocketTCPSHMRing();
+        socketTCP = socketRTIGRings;
+    }
 #endif
     socketUDP = new SocketUDP();
 
@@ -134,8 +252,106 @@ Communications::Communications(int RTIA_port, int RTIA_fd)
     if (udp_port == NULL)
         udp_port = PORT_UDP_RTIG;
 
-    socketTCP->createConnection(certihost, atoi(tcp_port));
+    const char* batch_delay = getenv("CERTI_RTIA_BATCH_DELAY");
+    const char* batch_size = getenv("CERTI_RTIA_BATCH_SIZE");
+    batchDelay = std::chrono::microseconds(batch_delay ? atol(batch_delay) : DEFAULT_BATCH_DELAY);
+    batchSize = batch_size ? strtoul(batch_size, NULL, 10) : DEFAULT_BATCH_SIZE;
+    batchedFrames.reserve(batchSize);
+
+    localRTIGAddress = 0;
+#ifdef SOCKTCP_LOCAL_SOCKET
+    if (plain_tcp) {
+        connectLocalRTIG(certihost, atoi(tcp_port));
+    }
+#endif
+    if (!socketTCP->isLocal()) {
+        socketTCP->createConnection(certihost, atoi(tcp_port));
+    }
+#ifdef SOCKTCP_LOCAL_SOCKET
+    else if (socketRTIGRings) {
+        openRTIGRings();
+    }
+#endif
     socketUDP->createConnection(certihost, atoi(udp_port));
+
+    // Created now to be watched with the other links, bound once the RTIG tells the port.
+    multicastBase = 0;
+    socketMC = NULL;
+    const char* multicast = getenv("CERTI_MULTICAST");
+    bool use_multicast = !multicast || strcmp(multicast, "off") != 0;
+#ifdef SOCKTCP_LOCAL_SOCKET
+    // the rings already carry one copy per RTIA
+    use_multicast = use_multicast && !usesRTIGRings();
+#endif
+    if (use_multicast) {
+        socketMC = new SocketMC();
+        try {
+            // the groups are joined on the interface which leads to the RTIG
+            struct sockaddr_in local;
+            socklen_t length = sizeof(local);
+            if (socketTCP->isLocal()
+                || getsockname(socketTCP->returnSocket(), (struct sockaddr*) &local, &length) < 0) {
+                local.sin_addr.s_addr = htonl(INADDR_ANY);
+            }
+            socketMC->createReceiver(local.sin_addr.s_addr);
+        }
+        catch (NetworkError& e) {
+            Debug(D, pdError) << "No multicast: " << e.reason() << std::endl;
+            delete socketMC;
+            socketMC = NULL;
+        }
+    }
+
+    // Accepts the other RTIAs, which then only send: read by the network receiver thread.
+    // Only the port is taken here, the links are accepted once the RTIG routes the updates.
+    socketPeer = NULL;
+    peerToPeer = false;
+    peerFederation = 0;
+#ifdef CERTI_RTIA_NETWORK_THREAD
+    const char* peer_to_peer = getenv("CERTI_PEER_TO_PEER");
+    if (!peer_to_peer || strcmp(peer_to_peer, "off") != 0) {
+        socketPeer = new SocketTCP();
+        try {
+            // on the interface which leads to the RTIG, as the RTIG gives it to the other RTIAs
+            struct sockaddr_in local;
+            socklen_t length = sizeof(local);
+            if (socketTCP->isLocal()
+                || getsockname(socketTCP->returnSocket(), (struct sockaddr*) &local, &length) < 0) {
+                local.sin_addr.s_addr = htonl(INADDR_ANY);
+            }
+            socketPeer->reserveServer(0, local.sin_addr.s_addr);
+        }
+        catch (NetworkError& e) {
+            Debug(D, pdError) << "No peer to peer: " << e.reason() << std::endl;
+            delete socketPeer;
+            socketPeer = NULL;
+        }
+    }
+#endif
+
+#ifdef CERTI_RTIA_NETWORK_THREAD
+    startNetworkReceiver();
+#endif
+
+    waitingRank = 0;
+
+    epollAll = -1;
+    epollFederate = -1;
+#ifdef RTIA_USES_EPOLL
+    int fds[4];
+    const int count = networkLinks(fds);
+    fds[count] = socketUN->returnSocket();
+    epollAll = createEpoll(fds, count + 1);
+    epollFederate = createEpoll(fds + count, 1);
+    if (epollAll < 0 || epollFederate < 0) {
+        Debug(D, pdError) << "epoll unavailable (" << strerror(errno) << "), using select()" << std::endl;
+        if (epollAll >= 0) {
+            close(epollAll);
+        }
+        epollAll = -1;
+        epollFederate = -1;
+    }
+#endif
 }
 
 Communications::~Communications()
@@ -144,15 +360,26 @@ Communications::~Communications()
     Debug(G, pdGendoc) << "enter Communications::~Communications" << std::endl;
 
     NM_Close_Connexion closeMsg;
-    closeMsg.send(socketTCP, NM_msgBufSend);
+    sendMessage(&closeMsg);
+#ifdef CERTI_RTIA_NETWORK_THREAD
+    stopNetworkReceiver();
+#endif
     socketTCP->close();
 
-    delete socketUN;
-#ifdef FEDERATION_USES_MULTICAST
-    delete socketMC;
+#ifdef RTIA_USES_EPOLL
+    if (epollAll >= 0) {
+        close(epollAll);
+        close(epollFederate);
+    }
 #endif
+
+    peerLinks.clear();
+
+    delete socketUN;
     delete socketTCP;
     delete socketUDP;
+    delete socketMC;
+    delete socketPeer;
 
     Debug(G, pdGendoc) << "exit  Communications::~Communications" << std::endl;
 }
@@ -170,60 +397,232 @@ void Communications::requestFederateService(Message* req)
 
 unsigned long Communications::getAddress()
 {
+    // the RTIG sees the loopback on a local link, the other RTIAs need the address of this host
+    if (socketTCP->isLocal()) {
+        return localRTIGAddress;
+    }
     return socketUDP->getAddr();
 }
 
+#ifdef SOCKTCP_LOCAL_SOCKET
+void Communications::connectLocalRTIG(const char* host, unsigned int port)
+{
+    const char* local_socket = getenv("CERTI_LOCAL_SOCKET");
+    if (local_socket && strcmp(local_socket, "off") == 0) {
+        return;
+    }
+
+    try {
+        in_addr_t address;
+        Socket::host2addr(host, address);
+        if (!SocketTCP::isLocalAddress(address)) {
+            return;
+        }
+
+        socketTCP->createLocalClient(localRTIGName(port));
+        localRTIGAddress = address;
+        Debug(D, pdInit) << "Connected to the RTIG of this host through " << localRTIGName(port) << std::endl;
+    }
+    catch (NetworkError& e) {
+        // an RTIG without local socket, or in a container: TCP then
+        Debug(D, pdInit) << "No local link to the RTIG: " << e.reason() << std::endl;
+    }
+}
+
+void Communications::openRTIGRings()
+{
+    try {
+        NM_Shm_Rings request;
+        request.setName(socketRTIGRings->create());
+        request.send(socketTCP, NM_msgBufSend);
+
+        std::unique_ptr<NetworkMessage> answer(NM_Factory::receive(socketTCP));
+        if (answer->getMessageType() != NetworkMessage::Type::SHM_RINGS
+            || static_cast<NM_Shm_Rings*>(answer.get())->getName().empty()) {
+            Debug(D, pdInit) << "The RTIG keeps the local socket" << std::endl;
+            socketRTIGRings->release();
+            return;
+        }
+        socketRTIGRings->activate();
+        Debug(D, pdInit) << "Messages to and from the RTIG go through shared memory" << std::endl;
+    }
+    catch (NetworkError& e) {
+        Debug(D, pdError) << "No shared memory with the RTIG: " << e.reason() << std::endl;
+        socketRTIGRings->release();
+    }
+}
+
+bool Communications::usesRTIGRings() const
+{
+    return socketRTIGRings && socketRTIGRings->isActive();
+}
+#endif
+
 unsigned int Communications::getPort()
 {
+    // port 0 asks the RTIG to send the best effort messages over TCP
+    const char* best_effort = getenv("CERTI_BEST_EFFORT");
+    if (best_effort && strcmp(best_effort, "tcp") == 0) {
+        return 0;
+    }
+#ifdef SOCKTCP_LOCAL_SOCKET
+    // and through the rings, which are faster than UDP
+    if (usesRTIGRings()) {
+        return 0;
+    }
+#endif
     return socketUDP->getPort();
 }
 
-void Communications::readMessage(Communications::ReadResult& n,
-                                 NetworkMessage** msg_reseau,
-                                 Message** msg,
-                                 struct timeval* timeout)
+void Communications::useCompactEncoding()
 {
-    const int tcp_fd(socketTCP->returnSocket());
-    const int udp_fd(socketUDP->returnSocket());
+    Debug(D, pdInit) << "Messages to the RTIG use the compact encoding" << std::endl;
+    socketTCP->setCompactEncoding(true);
+}
 
-    int max_fd = 0; // not used for _WIN32
-    fd_set fdset;
-    FD_ZERO(&fdset);
+void Communications::openMulticast(in_addr_t base, unsigned int port)
+{
+    if (!socketMC || socketMC->isBound()) {
+        return;
+    }
+    try {
+        socketMC->bindReceiver(port);
+        multicastBase = base;
+    }
+    catch (NetworkError& e) {
+        Debug(D, pdError) << "No multicast: " << e.reason() << std::endl;
+    }
+}
 
-    if (msg_reseau) {
-        FD_SET(tcp_fd, &fdset);
-        FD_SET(udp_fd, &fdset);
-#ifndef _WIN32
-        max_fd = std::max(max_fd, std::max(tcp_fd, udp_fd));
-#endif
+bool Communications::usesMulticast() const
+{
+    return multicastBase != 0;
+}
+
+bool Communications::joinMulticastGroup(SocketMC::Group kind, Handle handle)
+{
+    return usesMulticast() && SocketMC::hasGroup(multicastBase, handle)
+        && socketMC->join(SocketMC::groupAddress(multicastBase, kind, handle));
+}
+
+void Communications::leaveMulticastGroup(SocketMC::Group kind, Handle handle)
+{
+    if (usesMulticast() && SocketMC::hasGroup(multicastBase, handle)) {
+        socketMC->leave(SocketMC::groupAddress(multicastBase, kind, handle));
     }
-    if (msg) {
-        FD_SET(socketUN->returnSocket(), &fdset);
-#ifndef _WIN32
-        max_fd = std::max(max_fd, socketUN->returnSocket());
+}
+
+unsigned int Communications::getPeerPort()
+{
+    if (!socketPeer) {
+        return 0;
+    }
+    struct sockaddr_in local;
+    socklen_t length = sizeof(local);
+    if (getsockname(socketPeer->returnSocket(), (struct sockaddr*) &local, &length) < 0) {
+        return 0;
+    }
+    return ntohs(local.sin_port);
+}
+
+void Communications::usePeerToPeer(FederationHandle federation)
+{
+    const char* peer_to_peer = getenv("CERTI_PEER_TO_PEER");
+    if (!peer_to_peer || strcmp(peer_to_peer, "off") != 0) {
+        Debug(D, pdInit) << "Updates without time stamp are sent to the RTIAs of the subscribers" << std::endl;
+        peerToPeer = true;
+    }
+#ifdef CERTI_RTIA_NETWORK_THREAD
+    if (socketPeer && !peerFederation) {
+        try {
+            socketPeer->listenServer();
+        }
+        catch (NetworkError& e) {
+            Debug(D, pdError) << "Direct updates not accepted: " << e.reason() << std::endl;
+            return;
+        }
+        peerFederation = federation.get();
+        // the network receiver thread watches the server from its next wake up on
+        const char wakeup = 0;
+        if (write(peerPipe[1], &wakeup, 1) != 1) {
+            Debug(D, pdError) << "Cannot wake up the network receiver thread" << std::endl;
+        }
+    }
+#else
+    (void) federation;
 #endif
+}
+
+bool Communications::usesPeerToPeer() const
+{
+    return peerToPeer;
+}
+
+bool Communications::connectPeer(FederateHandle federate, in_addr_t address, unsigned int port)
+{
+    auto found = peerLinks.find(federate);
+    if (found != peerLinks.end()) {
+        return found->second != nullptr;
+    }
+
+    std::unique_ptr<SocketTCP> link(new SocketTCP());
+    try {
+        link->createTCPClient(port, address, PEER_CONNECT_TIMEOUT);
+        Debug(D, pdInit) << "Link to the RTIA of federate " << federate << " at " << Socket::addr2string(address)
+                         << ":" << port << std::endl;
+    }
+    catch (NetworkError& e) {
+        Debug(D, pdError) << "RTIA of federate " << federate << " unreachable: " << e.reason() << std::endl;
+        link.reset();
     }
+    return (peerLinks[federate] = std::move(link)) != nullptr;
+}
+
+bool Communications::sendToPeer(FederateHandle federate, NetworkMessage* msg)
+{
+    auto found = peerLinks.find(federate);
+    assert(found != peerLinks.end() && found->second);
 
-#ifdef FEDERATION_USES_MULTICAST
-    // if multicast link is initialized (during join federation).
-    if (_est_init_mc) {
-        FD_SET(_socket_mc, &fdset);
+    try {
 #ifndef _WIN32
-        max_fd = std::max(max_fd, _socket_mc);
+        SigpipeBlocker blocker;
 #endif
+        msg->send(found->second.get(), NM_msgBufSend);
+        return true;
     }
-#endif
+    catch (NetworkError& e) {
+        Debug(D, pdError) << "Link to the RTIA of federate " << federate << " lost: " << e.reason() << std::endl;
+        found->second.reset();
+        return false;
+    }
+}
 
+void Communications::closePeer(FederateHandle federate)
+{
+    peerLinks.erase(federate);
+}
+
+void Communications::readMessage(Communications::ReadResult& n,
+                                 NetworkMessage** msg_reseau,
+                                 Message** msg,
+                                 struct timeval* timeout)
+{
     if (msg_reseau && !waitingList.empty()) {
         // One message is in waiting buffer.
-        *msg_reseau = waitingList.front();
-        waitingList.pop_front();
+        const NetworkMessage* oldest = waitingList.front().msg;
+        *msg_reseau = unpark(waitingIndex.find(WaitingKey(oldest->getMessageType(), oldest->getFederate())));
         n = ReadResult::FromNetwork;
     }
-    else if (msg_reseau && socketTCP->isDataReady()) {
-        // Datas are in TCP waiting buffer.
-        // Read a message from RTIG TCP link.
+#ifdef CERTI_RTIA_NETWORK_THREAD
+    else if (msg_reseau && (*msg_reseau = takeNetworkMessage(false))) {
+        // Already received by the network receiver thread.
+        n = ReadResult::FromNetwork;
+    }
+#else
+    else if (msg_reseau && hasBufferedTCPMessage()) {
+        // A whole message has already been read ahead from RTIG TCP link.
         *msg_reseau = NM_Factory::receive(socketTCP);
+        drainTCPBuffer();
         n = ReadResult::FromNetwork;
     }
     else if (msg_reseau && socketUDP->isDataReady()) {
@@ -232,6 +631,12 @@ void Communications::readMessage(Communications::ReadResult& n,
         *msg_reseau = NM_Factory::receive(socketUDP);
         n = ReadResult::FromNetwork;
     }
+    else if (msg_reseau && socketMC && socketMC->isDataReady()) {
+        // A datagram sent to a group is being read.
+        *msg_reseau = NM_Factory::receive(socketMC);
+        n = ReadResult::FromNetwork;
+    }
+#endif
     else if (msg && socketUN->isDataReady()) {
         // Datas are in UNIX waiting buffer.
         // Read a message from federate UNIX link.
@@ -239,47 +644,38 @@ void Communications::readMessage(Communications::ReadResult& n,
         n = ReadResult::FromFederate;
     }
     else {
-// waitingList is empty and no data in TCP buffer.
-// Wait a message (coming from federate or network).
-#ifdef _WIN32
-        if (select(max_fd, &fdset, NULL, NULL, timeout) < 0) {
-            if (WSAGetLastError() == WSAEINTR)
-#else
-        if (select(max_fd + 1, &fdset, NULL, NULL, timeout) < 0) {
-            if (errno == EINTR)
-#endif
-            {
-                throw NetworkSignal("EINTR on select");
-            }
-            else {
-                throw NetworkError("Unexpected errno on select");
-            }
-        }
+        // waitingList is empty and no data in TCP buffer.
+        // Wait a message (coming from federate or network).
+        const int fd = waitForLinksOrFlush(msg_reseau != NULL, msg != NULL, timeout);
 
 // At least one message has been received, read this message.
 
-#ifdef FEDERATION_USES_MULTICAST
-        // Priorite aux messages venant du multicast(pour essayer d'eviter
-        // un depassement de la file et donc la perte de messages)
-
-        if (_est_init_mc && FD_ISSET(_socket_mc, &fdset)) {
-            // Read a message coming from the multicast link.
-            receiveMC(*msg_reseau);
-            n = ReadResult::FromNetwork;
+#ifdef CERTI_RTIA_NETWORK_THREAD
+        if (fd == receivedPipe[0]) {
+            // The network receiver thread queued a message.
+            *msg_reseau = takeNetworkMessage(false);
+            n = *msg_reseau ? ReadResult::FromNetwork : ReadResult::Invalid;
         }
-#endif
-
-        if (FD_ISSET(socketTCP->returnSocket(), &fdset)) {
-            // Read a message coming from the TCP link with RTIG.
+#else
+        if (fd == socketTCP->returnSocket()) {
+            // Read a message coming from the TCP link with RTIG,
+            // and queue the ones which came in the same read.
             *msg_reseau = NM_Factory::receive(socketTCP);
+            drainTCPBuffer();
             n = ReadResult::FromNetwork;
         }
-        else if (FD_ISSET(socketUDP->returnSocket(), &fdset)) {
+        else if (fd == socketUDP->returnSocket()) {
             // Read a message coming from the UDP link with RTIG.
             *msg_reseau = NM_Factory::receive(socketUDP);
             n = ReadResult::FromNetwork;
         }
-        else if (FD_ISSET(socketUN->returnSocket(), &fdset)) {
+        else if (socketMC && fd == socketMC->returnSocket()) {
+            // Read a message the RTIG sent to a group.
+            *msg_reseau = NM_Factory::receive(socketMC);
+            n = ReadResult::FromNetwork;
+        }
+#endif
+        else if (fd == socketUN->returnSocket()) {
             // Read a message coming from the federate.
             *msg = M_Factory::receive(socketUN);
             n = ReadResult::FromFederate;
@@ -291,29 +687,497 @@ void Communications::readMessage(Communications::ReadResult& n,
     }
 }
 
+int Communications::networkLinks(int fds[3])
+{
+#ifdef CERTI_RTIA_NETWORK_THREAD
+    fds[0] = receivedPipe[0];
+    return 1;
+#else
+    fds[0] = socketTCP->returnSocket();
+    fds[1] = socketUDP->returnSocket();
+    if (socketMC) {
+        fds[2] = socketMC->returnSocket();
+        return 3;
+    }
+    return 2;
+#endif
+}
+
+int Communications::waitForLinksOrFlush(bool network, bool federate, struct timeval* timeout)
+{
+    using std::chrono::microseconds;
+
+    if (batchedFrames.empty()) {
+        return waitForLinks(network, federate, timeout);
+    }
+
+    const auto batch_wait = std::chrono::duration_cast<microseconds>(batchDeadline - std::chrono::steady_clock::now());
+    const microseconds wait = timeout ? microseconds(timeout->tv_sec * 1000000LL + timeout->tv_usec) : batch_wait;
+
+    if (batch_wait.count() > 0) {
+        if (timeout && wait <= batch_wait) {
+            return waitForLinks(network, federate, timeout);
+        }
+
+        struct timeval batch_timeout;
+        batch_timeout.tv_sec = batch_wait.count() / 1000000;
+        batch_timeout.tv_usec = batch_wait.count() % 1000000;
+        const int fd = waitForLinks(network, federate, &batch_timeout);
+        if (fd >= 0) {
+            return fd;
+        }
+    }
+
+    // The batch is due and nothing came: send it, then wait for the rest of the timeout.
+    flushMessages();
+    if (!timeout) {
+        return waitForLinks(network, federate, NULL);
+    }
+
+    const microseconds remaining = std::max(wait - std::max(batch_wait, microseconds(0)), microseconds(0));
+    struct timeval remaining_timeout;
+    remaining_timeout.tv_sec = remaining.count() / 1000000;
+    remaining_timeout.tv_usec = remaining.count() % 1000000;
+    return waitForLinks(network, federate, &remaining_timeout);
+}
+
+int Communications::waitForLinks(bool network, bool federate, struct timeval* timeout)
+{
+    // watched descriptors, by priority
+    int fds[4];
+    int count = network ? networkLinks(fds) : 0;
+    if (federate) {
+        fds[count++] = socketUN->returnSocket();
+    }
+
+#ifdef RTIA_USES_EPOLL
+    if (epollAll >= 0 && federate) {
+        const int epoll_fd = network ? epollAll : epollFederate;
+        const int timeout_ms = timeout ? timeout->tv_sec * 1000 + (timeout->tv_usec + 999) / 1000 : -1;
+
+        struct epoll_event events[4];
+        const int ready_count = epoll_wait(epoll_fd, events, 4, timeout_ms);
+        if (ready_count < 0) {
+            if (errno == EINTR) {
+                throw NetworkSignal("EINTR on epoll_wait");
+            }
+            else {
+                throw NetworkError("Unexpected errno on epoll_wait");
+            }
+        }
+
+        // Same priority as with select().
+        int ready = count;
+        for (int i = 0; i < ready_count; ++i) {
+            ready = std::min<int>(ready, std::find(fds, fds + count, events[i].data.fd) - fds);
+        }
+        return ready < count ? fds[ready] : -1;
+    }
+#endif
+
+    int max_fd = 0; // not used for _WIN32
+    fd_set fdset;
+    FD_ZERO(&fdset);
+
+    for (int i = 0; i < count; ++i) {
+        FD_SET(fds[i], &fdset);
+#ifndef _WIN32
+        max_fd = std::max(max_fd, fds[i]);
+#endif
+    }
+
+#ifdef _WIN32
+    if (select(max_fd, &fdset, NULL, NULL, timeout) < 0) {
+        if (WSAGetLastError() == WSAEINTR)
+#else
+    if (select(max_fd + 1, &fdset, NULL, NULL, timeout) < 0) {
+        if (errno == EINTR)
+#endif
+        {
+            throw NetworkSignal("EINTR on select");
+        }
+        else {
+            throw NetworkError("Unexpected errno on select");
+        }
+    }
+
+    for (int i = 0; i < count; ++i) {
+        if (FD_ISSET(fds[i], &fdset)) {
+            return fds[i];
+        }
+    }
+    return -1;
+}
+
+NetworkMessage* Communications::receiveFromRTIG()
+{
+#ifdef CERTI_RTIA_NETWORK_THREAD
+    return takeNetworkMessage(true);
+#else
+    return NM_Factory::receive(socketTCP);
+#endif
+}
+
+#ifdef CERTI_RTIA_NETWORK_THREAD
+bool Communications::isDirectUpdate(const NetworkMessage& msg) const
+{
+    if (msg.getMessageType() != NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES) {
+        return false;
+    }
+    const auto& reflection = static_cast<const NM_Reflect_Attribute_Values&>(msg);
+    return reflection.hasPeer() && reflection.getPeer() && reflection.getFederation() == peerFederation;
+}
+
+void Communications::startNetworkReceiver()
+{
+    if (pipe(receivedPipe) < 0 || pipe(peerPipe) < 0) {
+        throw NetworkError(std::string("Cannot create network receiver pipe: ") + strerror(errno));
+    }
+
+    // Signals are for the main thread, which turns them into NetworkSignal.
+    sigset_t nset, oset;
+    sigfillset(&nset);
+    pthread_sigmask(SIG_SETMASK, &nset, &oset);
+
+    networkReceiver = std::thread{&Communications::receiveNetworkMessages, this};
+
+    pthread_sigmask(SIG_SETMASK, &oset, nullptr);
+}
+
+void Communications::stopNetworkReceiver()
+{
+    {
+        std::lock_guard<std::mutex> lock(receivedMutex);
+        receiverStopping = true;
+    }
+    roomCondition.notify_one();
+
+    // The receiver thread ends on the end of file.
+    ::shutdown(socketTCP->returnSocket(), SHUT_RDWR);
+    if (networkReceiver.joinable()) {
+        networkReceiver.join();
+    }
+
+    for (auto msg : receivedMessages) {
+        delete msg;
+    }
+    receivedMessages.clear();
+
+    ::close(receivedPipe[0]);
+    ::close(receivedPipe[1]);
+    ::close(peerPipe[0]);
+    ::close(peerPipe[1]);
+}
+
+void Communications::receiveNetworkMessages()
+{
+    // the federate name of the debug messages is per thread
+    PrettyDebug::setFederateName("RTIA::NetworkReceiver");
+
+    const int tcp_fd(socketTCP->returnSocket());
+    const int udp_fd(socketUDP->returnSocket());
+    const int mc_fd(socketMC ? socketMC->returnSocket() : -1);
+    const int peer_fd(socketPeer ? socketPeer->returnSocket() : -1);
+    // socketPeer is watched once listening
+    bool peer_listening = false;
+
+    // links accepted from the other RTIAs
+    std::vector<std::unique_ptr<SocketTCP>> peers;
+
+    std::vector<NetworkMessage*> batch;
+
+    try {
+        for (;;) {
+            bool from_tcp = hasBufferedTCPMessage();
+            bool from_udp = socketUDP->isDataReady();
+            bool from_mc = socketMC && socketMC->isDataReady();
+            bool from_peers = std::any_of(
+                peers.begin(), peers.end(), [](const std::unique_ptr<SocketTCP>& peer) { return hasCompleteMessage(*peer); });
+            bool new_peer = false;
+
+            fd_set fdset;
+            FD_ZERO(&fdset);
+            if (!from_tcp && !from_udp && !from_mc && !from_peers) {
+                FD_SET(tcp_fd, &fdset);
+                FD_SET(udp_fd, &fdset);
+                if (socketMC) {
+                    FD_SET(mc_fd, &fdset);
+                }
+                int max_fd = std::max({tcp_fd, udp_fd, mc_fd, peer_fd, peerPipe[0]});
+                if (peer_listening) {
+                    FD_SET(peer_fd, &fdset);
+                }
+                else if (socketPeer) {
+                    FD_SET(peerPipe[0], &fdset);
+                }
+                for (const auto& peer : peers) {
+                    FD_SET(peer->returnSocket(), &fdset);
+                    max_fd = std::max<int>(max_fd, peer->returnSocket());
+                }
+
+                if (select(max_fd + 1, &fdset, NULL, NULL, NULL) < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw NetworkError("Unexpected errno on select");
+                }
+                from_tcp = FD_ISSET(tcp_fd, &fdset);
+                from_udp = FD_ISSET(udp_fd, &fdset);
+                from_mc = socketMC && FD_ISSET(mc_fd, &fdset);
+                new_peer = peer_listening && FD_ISSET(peer_fd, &fdset);
+                if (socketPeer && !peer_listening && FD_ISSET(peerPipe[0], &fdset)) {
+                    char wakeup;
+                    peer_listening = read(peerPipe[0], &wakeup, 1) == 1;
+                }
+            }
+
+            if (from_tcp) {
+                // and every message which came in the same read
+                do {
+                    batch.push_back(NM_Factory::receive(socketTCP));
+                } while (hasBufferedTCPMessage());
+            }
+            if (from_udp) {
+                // and every datagram which came in the same read
+                do {
+                    batch.push_back(NM_Factory::receive(socketUDP));
+                } while (socketUDP->isDataReady());
+            }
+            if (from_mc) {
+                do {
+                    batch.push_back(NM_Factory::receive(socketMC));
+                } while (socketMC->isDataReady());
+            }
+            for (auto peer = peers.begin(); peer != peers.end();) {
+                if (!hasCompleteMessage(**peer) && !FD_ISSET((*peer)->returnSocket(), &fdset)) {
+                    ++peer;
+                    continue;
+                }
+                try {
+                    do {
+                        std::unique_ptr<NetworkMessage> msg(NM_Factory::receive(peer->get()));
+                        if (!isDirectUpdate(*msg)) {
+                            throw NetworkError("Not a direct update of the federation: "
+                                               + std::string(msg->getMessageName()));
+                        }
+                        batch.push_back(msg.release());
+                    } while (hasCompleteMessage(**peer));
+                    ++peer;
+                }
+                catch (NetworkError& e) {
+                    // the other RTIA closed its link, its federate left, or it sent what it must not
+                    Debug(D, pdDebug) << "Link of another RTIA closed: " << e.reason() << std::endl;
+                    peer = peers.erase(peer);
+                }
+            }
+            if (new_peer) {
+                std::unique_ptr<SocketTCP> peer(new SocketTCP());
+                try {
+                    peer->accept(socketPeer);
+                    peers.push_back(std::move(peer));
+                }
+                catch (NetworkError& e) {
+                    Debug(D, pdError) << e.reason() << std::endl;
+                }
+            }
+
+            if (batch.empty()) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(receivedMutex);
+            if (receivedMessages.empty()) {
+                const char wakeup = 0;
+                if (write(receivedPipe[1], &wakeup, 1) != 1) {
+                    throw NetworkError("Cannot wake up the RTIA");
+                }
+            }
+            receivedMessages.insert(receivedMessages.end(), batch.begin(), batch.end());
+            batch.clear();
+            receivedCondition.notify_one();
+
+            if (receivedMessages.size() >= maxReceivedMessages) {
+                Debug(D, pdDebug) << receivedMessages.size() << " messages not taken, stop reading" << std::endl;
+                roomCondition.wait(
+                    lock, [this] { return receivedMessages.size() < maxReceivedMessages || receiverStopping; });
+            }
+            if (receiverStopping) {
+                Debug(D, pdDebug) << "Network receiver thread stopped" << std::endl;
+                return;
+            }
+        }
+    }
+    catch (...) {
+        for (auto msg : batch) {
+            delete msg;
+        }
+
+        Debug(D, pdDebug) << "Network receiver thread ends" << std::endl;
+
+        std::lock_guard<std::mutex> lock(receivedMutex);
+        if (receivedMessages.empty()) {
+            const char wakeup = 0;
+            if (write(receivedPipe[1], &wakeup, 1) != 1) {
+                Debug(D, pdError) << "Cannot wake up the RTIA" << std::endl;
+            }
+        }
+        receiverError = std::current_exception();
+        receivedCondition.notify_one();
+    }
+}
+
+NetworkMessage* Communications::takeNetworkMessage(bool wait)
+{
+    std::unique_lock<std::mutex> lock(receivedMutex);
+
+    if (wait) {
+        receivedCondition.wait(lock, [this] { return !receivedMessages.empty() || receiverError; });
+    }
+
+    if (receivedMessages.empty()) {
+        if (receiverError) {
+            std::rethrow_exception(receiverError);
+        }
+        return NULL;
+    }
+
+    NetworkMessage* msg = receivedMessages.front();
+    receivedMessages.pop_front();
+
+    if (receivedMessages.size() == maxReceivedMessages - 1) {
+        roomCondition.notify_one();
+    }
+
+    if (receivedMessages.empty() && !receiverError) {
+        // nothing left: consume the wake up byte
+        char wakeup;
+        if (read(receivedPipe[0], &wakeup, 1) != 1) {
+            throw NetworkError("Cannot read the network receiver pipe");
+        }
+    }
+    return msg;
+}
+#endif
+
+bool Communications::hasBufferedTCPMessage() const
+{
+#ifdef SOCKTCP_LOCAL_SOCKET
+    // nothing is read ahead from the rings, but this arms their doorbell before select()
+    if (usesRTIGRings()) {
+        return socketRTIGRings->isDataReady();
+    }
+#endif
+    return hasCompleteMessage(*socketTCP);
+}
+
+void Communications::drainTCPBuffer()
+{
+    while (hasBufferedTCPMessage()) {
+        park(NM_Factory::receive(socketTCP));
+    }
+}
+
+void Communications::setDataMessageHandler(std::function<void(NetworkMessage*)> handler)
+{
+    dataMessageHandler = handler;
+}
+
+void Communications::park(NetworkMessage* msg)
+{
+    auto entry = waitingList.insert(waitingList.end(), WaitingMessage{waitingRank++, msg});
+    waitingIndex[WaitingKey(msg->getMessageType(), msg->getFederate())].push_back(entry);
+}
+
+NetworkMessage* Communications::unpark(std::map<WaitingKey, std::deque<WaitingList::iterator>>::iterator bucket)
+{
+    auto entry = bucket->second.front();
+    NetworkMessage* msg = entry->msg;
+
+    bucket->second.pop_front();
+    if (bucket->second.empty()) {
+        waitingIndex.erase(bucket);
+    }
+    waitingList.erase(entry);
+    return msg;
+}
+
 bool Communications::searchMessage(NetworkMessage::Type type_msg, FederateHandle numeroFedere, NetworkMessage** msg)
 {
-    list<NetworkMessage*>::iterator i;
-    for (i = waitingList.begin(); i != waitingList.end(); ++i) {
-        Debug(D, pdProtocol) << "Rechercher message de type " << static_cast<int>(type_msg) << std::endl;
-
-        if ((*i)->getMessageType() == type_msg) {
-            // if numeroFedere != 0, verify that federateNumbers are similar
-            if (((*i)->getFederate() == numeroFedere) || (numeroFedere == 0)) {
-                *msg = *i;
-                waitingList.erase(i);
-                Debug(D, pdProtocol) << "Message of Type " << static_cast<int>(type_msg) << " was already here"
-                                     << std::endl;
-                return true;
+    Debug(D, pdProtocol) << "Rechercher message de type " << static_cast<int>(type_msg) << std::endl;
+
+    auto found = waitingIndex.end();
+    if (numeroFedere != 0) {
+        found = waitingIndex.find(WaitingKey(type_msg, numeroFedere));
+    }
+    else {
+        // oldest message of this type, whatever the federate
+        for (auto bucket = waitingIndex.lower_bound(WaitingKey(type_msg, 0));
+             bucket != waitingIndex.end() && bucket->first.first == type_msg;
+             ++bucket) {
+            if (found == waitingIndex.end() || bucket->second.front()->rank < found->second.front()->rank) {
+                found = bucket;
             }
         }
     }
-    return false;
+
+    if (found == waitingIndex.end()) {
+        return false;
+    }
+
+    *msg = unpark(found);
+    Debug(D, pdProtocol) << "Message of Type " << static_cast<int>(type_msg) << " was already here" << std::endl;
+    return true;
 }
 
 void Communications::sendMessage(NetworkMessage* Msg)
 {
-    Msg->send(socketTCP, NM_msgBufSend);
+    if (Msg->serializedSize() >= MessageBuffer::segmentThreshold) {
+        // large values are written from where they are, not copied into the batch
+        flushMessages();
+        Msg->send(socketTCP, NM_msgBufSend);
+    }
+    else if (isBatched(Msg)) {
+        batch(Msg);
+        if (batchedFrames.size() >= batchSize) {
+            flushMessages();
+        }
+    }
+    else if (!batchedFrames.empty()) {
+        // written along with the batch, after it
+        batch(Msg);
+        flushMessages();
+    }
+    else {
+        Msg->send(socketTCP, NM_msgBufSend);
+    }
+}
+
+void Communications::flushMessages()
+{
+    if (batchedFrames.empty()) {
+        return;
+    }
+
+    Debug(D, pdDebug) << "Sending a batch of " << batchedFrames.size() << " bytes to RTIG" << std::endl;
+    socketTCP->send(batchedFrames.data(), batchedFrames.size());
+    batchedFrames.clear();
+}
+
+bool Communications::isBatched(const NetworkMessage* msg) const
+{
+    return batchDelay.count() > 0 && (msg->getMessageType() == NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES
+                                      || msg->getMessageType() == NetworkMessage::Type::SEND_INTERACTION);
+}
+
+void Communications::batch(NetworkMessage* msg)
+{
+    if (batchedFrames.empty()) {
+        batchDeadline = std::chrono::steady_clock::now() + batchDelay;
+    }
+
+    msg->serializeFrame(NM_msgBufSend, socketTCP->usesCompactEncoding());
+    const unsigned char* frame = static_cast<unsigned char*>(NM_msgBufSend(0));
+    batchedFrames.insert(batchedFrames.end(), frame, frame + NM_msgBufSend.size());
 }
 
 void Communications::sendUN(Message* Msg)
@@ -326,5 +1190,28 @@ Message* Communications::receiveUN()
     Message* msg = M_Factory::receive(socketUN);
     return msg;
 }
+
+bool Communications::attachFederateRing(const std::string& name)
+{
+#ifndef _WIN32
+    try {
+        socketSHMRing->attach(name);
+        return true;
+    }
+    catch (NetworkError& e) {
+        Debug(D, pdError) << e.reason() << ", keeping the Unix socket" << std::endl;
+    }
+#else
+    (void) name;
+#endif
+    return false;
+}
+
+void Communications::activateFederateRing()
+{
+#ifndef _WIN32
+    socketSHMRing->activate();
+#endif
+}
 }
 } // namespace certi/rtia
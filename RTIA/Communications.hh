@@ -23,17 +23,34 @@
 #ifndef _CERTI_COMMUNICATIONS_HH
 #define _CERTI_COMMUNICATIONS_HH
 
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
 #include <list>
+#include <map>
+#include <memory>
+#include <vector>
+#ifdef CERTI_RTIA_NETWORK_THREAD
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#endif
 
 #include <include/certi.hh>
 
 #include <libCERTI/Message.hh>
 #include <libCERTI/NetworkMessage.hh>
+#include <libCERTI/SocketMC.hh>
 #include <libCERTI/SocketTCP.hh>
+#ifdef SOCKTCP_LOCAL_SOCKET
+#include <libCERTI/SocketTCPSHMRing.hh>
+#endif
 #include <libCERTI/SocketUDP.hh>
 #include <libCERTI/SocketUN.hh>
-#ifdef FEDERATION_USES_MULTICAST
-#include <libCERTI/SocketMC.hh>
+#ifndef _WIN32
+#include <libCERTI/SocketSHMRing.hh>
 #endif
 
 namespace certi {
@@ -53,10 +70,19 @@ public:
 
     /**
      * Send a message to RTIG.
+     * Attribute updates and interactions may be batched: they are written
+     * with the next message, when the batch is full or when it is older
+     * than the batching delay, whichever comes first.
      * @param[in] Msg the message to be sent
      */
     void sendMessage(NetworkMessage* Msg);
 
+    /** Send the batched attribute updates and interactions to RTIG now.
+     * Called for every federate service which is not an update or an
+     * interaction, so that the RTIG sees them before any later request.
+     */
+    void flushMessages();
+
     /** Send a message to RTIA.
      * FIXME Historically those messages were sent to Unix Socket thus the 'UN'.
      * @param[in] Msg the message to be sent
@@ -71,6 +97,14 @@ public:
      */
     Message* receiveUN();
 
+    /** Map the shared memory rings offered by the federate in OPEN_CONNEXION.
+     * @return false if they cannot be used, the Unix socket is kept then
+     */
+    bool attachFederateRing(const std::string& name);
+
+    /// Exchange federate messages through the shared memory rings from now on.
+    void activateFederateRing();
+
     /**
      * Read some message from either network (RTIG/RTIA) or federate (RTIA/Federate).
      * Returns the actual source in the 1st parameter (RTIG=>1 federate=>2)
@@ -82,9 +116,59 @@ public:
     void readMessage(Communications::ReadResult& n, NetworkMessage** msg_reseau, Message** msg, struct timeval* timeout);
 
     void requestFederateService(Message* req);
+    /// Address the RTIG sends the best effort messages to, 0 for the one it sees this RTIA at.
     unsigned long getAddress();
     unsigned int getPort();
 
+    /// Send to the RTIG with the compact encoding from now on (see NetworkMessage::WireFormat).
+    void useCompactEncoding();
+
+    /** Receive what the RTIG sends to the multicast groups, given in its
+     * answer to the join.
+     * @param base address of the first group, in network byte order
+     * @param port port the groups are sent to
+     */
+    void openMulticast(in_addr_t base, unsigned int port);
+
+    /// Whether the RTIG sends to multicast groups and this RTIA can receive them.
+    bool usesMulticast() const;
+
+    /** Receive the messages sent to the group of a class.
+     * @return false if the group cannot be joined, the messages of the class are sent to this RTIA alone then
+     */
+    bool joinMulticastGroup(SocketMC::Group kind, Handle handle);
+
+    void leaveMulticastGroup(SocketMC::Group kind, Handle handle);
+
+    /** Port this RTIA accepts the updates of the other RTIAs on, 0 if it
+     * does not: without the network receiver thread, or when
+     * CERTI_PEER_TO_PEER is "off".
+     */
+    unsigned int getPeerPort();
+
+    /** The RTIG routes the updates without time stamp to the RTIAs, as
+     * told in its answer to the join: the links of the other RTIAs of the
+     * federation are accepted from now on. Nothing is done if
+     * CERTI_PEER_TO_PEER is "off".
+     */
+    void usePeerToPeer(FederationHandle federation);
+
+    bool usesPeerToPeer() const;
+
+    /** Open the link to the RTIA of a subscriber, if it is not open yet.
+     * @param address in network byte order
+     * @return false if it cannot be reached, it is not tried again then
+     */
+    bool connectPeer(FederateHandle federate, in_addr_t address, unsigned int port);
+
+    /** Send a message on the link opened by connectPeer().
+     * @return false if it failed, the link is closed and not tried again then
+     */
+    bool sendToPeer(FederateHandle federate, NetworkMessage* msg);
+
+    /// Close the link to the RTIA of a federate which left.
+    void closePeer(FederateHandle federate);
+
     /**
      * Wait for a message coming from RTIG and return when received.
      * @param[in] type_msg expected message type,
@@ -93,23 +177,98 @@ public:
      */
     NetworkMessage* waitMessage(NetworkMessage::Type type_msg, FederateHandle numeroFedere);
 
+    /** Messages which never answer a request (attribute reflections and
+     * interactions) read by waitMessage are given to this handler, which
+     * puts them in the RTIA queues, instead of being set aside.
+     */
+    void setDataMessageHandler(std::function<void(NetworkMessage*)> handler);
+
 protected:
     MessageBuffer NM_msgBufSend;
     MessageBuffer msgBufSend;
 
     SocketUN* socketUN;
-#ifdef FEDERATION_USES_MULTICAST
-    SocketMC* socketMC;
+#ifndef _WIN32
+    /// same object as socketUN
+    SocketSHMRing* socketSHMRing;
 #endif
     SocketTCP* socketTCP;
+#ifdef SOCKTCP_LOCAL_SOCKET
+    /// same object as socketTCP if CERTI_RTIG_TRANSPORT is "shm", NULL otherwise
+    SocketTCPSHMRing* socketRTIGRings;
+#endif
     SocketUDP* socketUDP;
+    /// NULL if multicast is disabled (CERTI_MULTICAST=off)
+    SocketMC* socketMC;
+    /// address of the first group, 0 until openMulticast()
+    in_addr_t multicastBase;
+    /// accepts the links of the other RTIAs, NULL if it does not (see getPeerPort())
+    SocketTCP* socketPeer;
+    /// set by usePeerToPeer()
+    bool peerToPeer;
+    /** Federation of the direct updates accepted, 0 until usePeerToPeer():
+     * socketPeer is not even listening before.
+     */
+    std::atomic<uint32_t> peerFederation;
 
 private:
+    struct WaitingMessage {
+        /// arrival order
+        unsigned long rank;
+        NetworkMessage* msg;
+    };
+    typedef std::list<WaitingMessage> WaitingList;
+    typedef std::pair<NetworkMessage::Type, FederateHandle> WaitingKey;
+
     /** This is the wait list of message already received from RTIG
      * but not yet dispatched. We need a wait list because we may
      * receive messages while waiting for some particular [other] messages.
      */
-    std::list<NetworkMessage*> waitingList;
+    WaitingList waitingList;
+
+    /// waitingList entries by type and federate, oldest first
+    std::map<WaitingKey, std::deque<WaitingList::iterator>> waitingIndex;
+
+    unsigned long waitingRank;
+
+    std::function<void(NetworkMessage*)> dataMessageHandler;
+
+    /// links to the RTIAs of the subscribers, NULL for those which cannot be reached
+    std::map<FederateHandle, std::unique_ptr<SocketTCP>> peerLinks;
+
+    /// messages to RTIG not written yet, with their headers, in sending order
+    std::vector<unsigned char> batchedFrames;
+    /// when batchedFrames must be written at the latest
+    std::chrono::steady_clock::time_point batchDeadline;
+    /// batching delay, zero when batching is disabled (CERTI_RTIA_BATCH_DELAY, in us)
+    std::chrono::microseconds batchDelay;
+    /// batchedFrames is written once it reaches this size (CERTI_RTIA_BATCH_SIZE, in bytes)
+    size_t batchSize;
+
+#ifdef SOCKTCP_LOCAL_SOCKET
+    /** Connect socketTCP to the local socket of the RTIG if it runs on this
+     * host (see SocketTCP::createLocalServer), unless CERTI_LOCAL_SOCKET is
+     * "off". socketTCP is left unconnected otherwise.
+     */
+    void connectLocalRTIG(const char* host, unsigned int port);
+
+    /** Offer the local RTIG shared memory rings for the messages of
+     * socketTCP (see SocketTCPSHMRing). The socket is kept if it refuses.
+     */
+    void openRTIGRings();
+
+    /// Whether the messages from and to the RTIG go through shared memory.
+    bool usesRTIGRings() const;
+#endif
+
+    /// address the RTIG was found at through its local socket, 0 if not local
+    in_addr_t localRTIGAddress;
+
+    /// Append a message to the wait list.
+    void park(NetworkMessage* msg);
+
+    /// Remove the entry at the front of its waitingIndex bucket.
+    NetworkMessage* unpark(std::map<WaitingKey, std::deque<WaitingList::iterator>>::iterator bucket);
 
     /** Returns true if a 'type_msg' message coming from federate
      * 'numeroFedere' (or any other federate if numeroFedere == 0) was in
@@ -117,6 +276,93 @@ private:
      * returns RTI_FALSE.
      */
     bool searchMessage(NetworkMessage::Type type_msg, FederateHandle numeroFedere, NetworkMessage** msg);
+
+    /** Move every complete message already read ahead from the RTIG TCP
+     * link to the wait list, so that a burst is handled without going
+     * back to select()/epoll_wait().
+     */
+    void drainTCPBuffer();
+
+    /// Whether the TCP read ahead buffer holds at least one complete message.
+    bool hasBufferedTCPMessage() const;
+
+    /// Whether sendMessage() may delay this message in the batch.
+    bool isBatched(const NetworkMessage* msg) const;
+
+    /// Append a message to the batch.
+    void batch(NetworkMessage* msg);
+
+    /** waitForLinks() which flushes the batch when its delay expires
+     * before any link is readable.
+     */
+    int waitForLinksOrFlush(bool network, bool federate, struct timeval* timeout);
+
+    /** Wait for the links selected in readMessage.
+     * @return the file descriptor to be read, -1 on timeout
+     */
+    int waitForLinks(bool network, bool federate, struct timeval* timeout);
+
+    /** The descriptors watched for RTIG messages, by priority.
+     * @return the number of descriptors written in fds
+     */
+    int networkLinks(int fds[3]);
+
+    /// Block until the next message from RTIG.
+    NetworkMessage* receiveFromRTIG();
+
+#ifdef CERTI_RTIA_NETWORK_THREAD
+    /** Body of the network receiver thread: reads and decodes every message
+     * coming from RTIG, even while the RTIA only listens to its federate,
+     * so that RTIG is never blocked by a busy federate. It also accepts and
+     * reads the links of the other RTIAs.
+     */
+    void receiveNetworkMessages();
+
+    /** The only messages another RTIA may send on its link: a reflection
+     * marked peer, of the federation given to usePeerToPeer().
+     */
+    bool isDirectUpdate(const NetworkMessage& msg) const;
+
+    void startNetworkReceiver();
+    void stopNetworkReceiver();
+
+    /** Take the oldest message decoded by the receiver thread.
+     * @param[in] wait block until a message comes
+     * @return NULL if none was received (and wait is false)
+     */
+    NetworkMessage* takeNetworkMessage(bool wait);
+
+    /** Past that many messages not taken yet, the receiver thread stops
+     * reading until the RTIA catches up: the RTIG then waits for this RTIA,
+     * as it does when the RTIA reads the RTIG link itself.
+     */
+    static constexpr size_t maxReceivedMessages = 4096;
+
+    std::thread networkReceiver;
+    std::mutex receivedMutex;
+    std::condition_variable receivedCondition;
+    /// signaled when receivedMessages goes below maxReceivedMessages
+    std::condition_variable roomCondition;
+    /// messages decoded by the receiver thread, not taken yet
+    std::deque<NetworkMessage*> receivedMessages;
+    /// the RTIA ends, the receiver thread must not wait for room
+    bool receiverStopping{false};
+    /// error which ended the receiver thread, rethrown once the queue is empty
+    std::exception_ptr receiverError;
+    /** Readable (one byte) as long as receivedMessages is not empty or
+     * receiverError is set: this is what the RTIA waits for with the
+     * federate link.
+     */
+    int receivedPipe[2];
+    /// Readable once usePeerToPeer() made socketPeer listen: the receiver thread watches it from then on.
+    int peerPipe[2];
+#endif
+
+    /** epoll instances (-1 when select() is used): one watching the RTIG
+     * links and the federate, one watching the federate only.
+     */
+    int epollAll;
+    int epollFederate;
 };
 }
 } // namespace certi/rtia
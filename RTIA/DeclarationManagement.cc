@@ -193,6 +193,13 @@ void DeclarationManagement::subscribeObjectClassAttribute(ObjectClassHandle theC
     for (uint32_t i = 0; i < attribArraySize; i++)
         req.setAttributes(attribArray[i], i);
 
+    // The group is joined before the RTIG sends to it, an empty subscription leaves it.
+    const bool multicast
+        = attribArraySize > 0 && comm->joinMulticastGroup(SocketMC::Group::ObjectClass, theClassHandle);
+    if (comm->usesMulticast()) {
+        req.setMulticast(multicast);
+    }
+
     // Send the message to RTIG
     Debug(G, pdGendoc) << "                              =====> send S_O_C to RTIG" << std::endl;
     comm->sendMessage(&req);
@@ -203,6 +210,19 @@ void DeclarationManagement::subscribeObjectClassAttribute(ObjectClassHandle theC
     Debug(G, pdGendoc) << "                              =====> received S_O_C from RTIG" << std::endl;
 
     e = rep->getException();
+
+    if (e == Exception::Type::NO_EXCEPTION) {
+        if (multicast) {
+            my_multicast_classes[theClassHandle]
+                = std::set<AttributeHandle>(attribArray.begin(), attribArray.begin() + attribArraySize);
+        }
+        else if (my_multicast_classes.erase(theClassHandle)) {
+            comm->leaveMulticastGroup(SocketMC::Group::ObjectClass, theClassHandle);
+        }
+    }
+    else if (multicast && !my_multicast_classes.count(theClassHandle)) {
+        comm->leaveMulticastGroup(SocketMC::Group::ObjectClass, theClassHandle);
+    }
     Debug(G, pdGendoc) << "exit  DeclarationManagement::subscribeObjectClassAttribute" << std::endl;
 }
 
@@ -225,6 +245,10 @@ void DeclarationManagement::unsubscribeObjectClassAttribute(ObjectClassHandle th
         comm->waitMessage(NetworkMessage::Type::UNSUBSCRIBE_OBJECT_CLASS, req.getFederate()));
 
     e = rep->getException();
+
+    if (e == Exception::Type::NO_EXCEPTION && my_multicast_classes.erase(theClassHandle)) {
+        comm->leaveMulticastGroup(SocketMC::Group::ObjectClass, theClassHandle);
+    }
 }
 
 void DeclarationManagement::subscribeInteractionClass(InteractionClassHandle theClassHandle, Exception::Type& e)
@@ -251,12 +275,24 @@ void DeclarationManagement::subscribeInteractionClass(InteractionClassHandle the
     req.setFederation(fm->getFederationHandle().get());
     req.setFederate(fm->getFederateHandle());
 
+    const bool multicast = comm->joinMulticastGroup(SocketMC::Group::InteractionClass, theClassHandle);
+    if (comm->usesMulticast()) {
+        req.setMulticast(multicast);
+    }
+
     comm->sendMessage(&req);
 
     std::unique_ptr<NetworkMessage> rep(
         comm->waitMessage(NetworkMessage::Type::SUBSCRIBE_INTERACTION_CLASS, req.getFederate()));
 
     e = rep->getException();
+
+    if (multicast && e == Exception::Type::NO_EXCEPTION) {
+        my_multicast_interactions.insert(theClassHandle);
+    }
+    else if (multicast && !my_multicast_interactions.count(theClassHandle)) {
+        comm->leaveMulticastGroup(SocketMC::Group::InteractionClass, theClassHandle);
+    }
 }
 
 void DeclarationManagement::unsubscribeInteractionClass(InteractionClassHandle theClassHandle, Exception::Type& e)
@@ -289,6 +325,10 @@ void DeclarationManagement::unsubscribeInteractionClass(InteractionClassHandle t
         comm->waitMessage(NetworkMessage::Type::UNSUBSCRIBE_INTERACTION_CLASS, req.getFederate()));
 
     e = rep->getException();
+
+    if (e == Exception::Type::NO_EXCEPTION && my_multicast_interactions.erase(theClassHandle)) {
+        comm->leaveMulticastGroup(SocketMC::Group::InteractionClass, theClassHandle);
+    }
 }
 
 void DeclarationManagement::setClassRelevanceAdvisorySwitch(bool state, Exception::Type& e)
@@ -400,5 +440,31 @@ void DeclarationManagement::turnInteractionsOff(InteractionClassHandle interacti
 
     e = rep->getExceptionType();
 }
+
+bool DeclarationManagement::isFromFederation(const NetworkMessage& msg) const
+{
+    return msg.getFederation() == fm->getFederationHandle().get() && msg.getFederate() != fm->getFederateHandle();
+}
+
+bool DeclarationManagement::filterMulticast(NM_Reflect_Attribute_Values& msg) const
+{
+    auto subscribed = my_multicast_classes.find(msg.getMulticastClass());
+    if (!isFromFederation(msg) || subscribed == my_multicast_classes.end()) {
+        return false;
+    }
+
+    for (uint32_t i = msg.getAttributesSize(); i-- > 0;) {
+        if (!subscribed->second.count(msg.getAttributes(i))) {
+            msg.removeAttributes(i);
+            msg.removeValues(i);
+        }
+    }
+    return msg.getAttributesSize() > 0;
+}
+
+bool DeclarationManagement::filterMulticast(const NM_Receive_Interaction& msg) const
+{
+    return isFromFederation(msg) && my_multicast_interactions.count(msg.getInteractionClass());
+}
 }
 } // namespace certi/rtia
@@ -25,9 +25,13 @@
 
 #include <include/certi.hh>
 
+#include <libCERTI/NM_Classes.hh>
 #include <libCERTI/PrettyDebug.hh>
 #include <libCERTI/RootObject.hh>
 
+#include <map>
+#include <set>
+
 #include "Communications.hh"
 #include "FederationManagement.hh"
 #include "Files.hh"
@@ -103,11 +107,32 @@ public:
     // 5.13
     void turnInteractionsOff(InteractionClassHandle interaction, Exception::Type& e);
 
+    /**
+     * Reduce a reflection the RTIG sent to a multicast group to the
+     * attributes subscribed at its class. The group carries the
+     * reflections of every federation and federate.
+     * @return false if nothing is left for this federate, the message is dropped then
+     */
+    bool filterMulticast(NM_Reflect_Attribute_Values& msg) const;
+
+    /// @return false if an interaction sent to a multicast group is not for this federate
+    bool filterMulticast(const NM_Receive_Interaction& msg) const;
+
 protected:
     Communications* comm;
     Queues* queues;
     FederationManagement* fm;
     RootObject* rootObject;
+
+private:
+    /// Whether a message of a multicast group comes from another federate of the federation.
+    bool isFromFederation(const NetworkMessage& msg) const;
+
+    /// attributes subscribed to, by class whose multicast group is joined
+    std::map<ObjectClassHandle, std::set<AttributeHandle>> my_multicast_classes;
+
+    /// interaction classes whose multicast group is joined
+    std::set<InteractionClassHandle> my_multicast_interactions;
 };
 }
 } // namespace certi/rtia
@@ -220,12 +220,14 @@ FederateHandle FederationManagement::joinFederationExecution(const std::string&
 
     request.setBestEffortAddress(comm->getAddress());
     request.setBestEffortPeer(comm->getPort());
+    request.setPeerPort(comm->getPeerPort());
 
     request.setFederationExecutionName(federation_execution_name);
     request.setFederateName(federate_name);
     request.setFederateType(federate_type);
     
     request.setRtiVersion(rti_version);
+    request.setWireFormat(static_cast<uint32_t>(NetworkMessage::localWireFormat()));
 
     request.setAdditionalFomModulesSize(additional_fom_modules.size());
     auto i = 0;
@@ -246,15 +248,25 @@ FederateHandle FederationManagement::joinFederationExecution(const std::string&
         NM_Join_Federation_Execution& joinResponse = static_cast<NM_Join_Federation_Execution&>(*response);
         rootObject->rebuildFromSerializedFOM(joinResponse);
 
+        // an older RTIG does not answer with its wire format
+        if (joinResponse.hasWireFormat() && NetworkMessage::localWireFormat() == NetworkMessage::WireFormat::COMPACT
+            && joinResponse.getWireFormat() >= static_cast<uint32_t>(NetworkMessage::WireFormat::COMPACT)) {
+            comm->useCompactEncoding();
+        }
+
+        if (joinResponse.getMulticastAddress() != 0 && joinResponse.hasMulticastPort()) {
+            comm->openMulticast(joinResponse.getMulticastAddress(), joinResponse.getMulticastPort());
+        }
+
+        if (joinResponse.hasPeerPort()) {
+            comm->usePeerToPeer(FederationHandle(joinResponse.getFederation()));
+        }
+
         my_federation_name = federation_execution_name;
         my_federate_name = federate_name;
         my_federation_handle = FederationHandle(joinResponse.getFederation());
         my_federate_handle = joinResponse.getFederate();
         my_tm->setFederate(my_federate_handle);
-#ifdef FEDERATION_USES_MULTICAST
-        // creation du socket pour la communication best-effort
-        comm->CreerSocketMC(reponse->getMulticastAddress(), MC_PORT);
-#endif
 
         for (int i = 0; i < joinResponse.getNumberOfRegulators(); i++) {
             response.reset(comm->waitMessage(NetworkMessage::Type::MESSAGE_NULL, 0));
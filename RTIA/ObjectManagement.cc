@@ -35,6 +35,7 @@
 #include <libCERTI/PrettyDebug.hh>
 
 #include "FederationManagement.hh"
+#include "PeerRouting.hh"
 #include "TimeManagement.hh"
 
 using std::cout;
@@ -102,6 +103,9 @@ ObjectHandle ObjectManagement::registerObject(
     if (e == Exception::Type::NO_EXCEPTION) {
         auto responses
             = rootObject->registerObjectInstance(fm->getFederateHandle(), the_class, rep->getObject(), rep->getLabel());
+        if (peers) {
+            peers->addObject(rep->getObject());
+        }
         return rep->getObject();
     }
     else {
@@ -174,6 +178,16 @@ void ObjectManagement::updateAttributeValues(ObjectHandle theObjectHandle,
     NM_Update_Attribute_Values req;
 
     Debug(G, pdGendoc) << "enter ObjectManagement::updateAttributeValues without time" << std::endl;
+
+    // straight to the RTIAs of the subscribers when the RTIG routes the updates
+    const uint32_t sequence = peers ? peers->nextSequence(theObjectHandle) : 0;
+    if (peers
+        && peers->updateAttributeValues(theObjectHandle, attribArray, valueArray, attribArraySize, theTag, sequence)) {
+        e = Exception::Type::NO_EXCEPTION;
+        Debug(G, pdGendoc) << "exit  ObjectManagement::updateAttributeValues without time" << std::endl;
+        return;
+    }
+
     // Building request (req NetworkMessage)
     req.setFederation(fm->getFederationHandle().get());
     req.setFederate(fm->getFederateHandle());
@@ -188,6 +202,9 @@ void ObjectManagement::updateAttributeValues(ObjectHandle theObjectHandle,
     }
 
     req.setLabel(theTag);
+    if (sequence) {
+        req.setSequence(sequence);
+    }
 
     comm->sendMessage(&req);
     std::unique_ptr<NetworkMessage> rep(comm->waitMessage(req.getMessageType(), req.getFederate()));
@@ -429,6 +446,9 @@ EventRetractionHandle ObjectManagement::deleteObject(ObjectHandle theObjectHandl
     e = rep->getException();
 
     if (e == Exception::Type::NO_EXCEPTION) {
+        if (peers) {
+            peers->deleteObject(theObjectHandle);
+        }
         auto responses = rootObject->deleteObjectInstance(fm->getFederateHandle(), theObjectHandle, theTag);
         std::cout << "==========================" << std::endl;
         std::cout << "RESPONSES FROM ROOT OBJECT" << std::endl;
@@ -456,6 +476,9 @@ void ObjectManagement::deleteObject(ObjectHandle theObjectHandle, const std::str
     e = rep->getException();
 
     if (e == Exception::Type::NO_EXCEPTION) {
+        if (peers) {
+            peers->deleteObject(theObjectHandle);
+        }
         auto responses = rootObject->deleteObjectInstance(fm->getFederateHandle(), theObjectHandle, theTag);
         std::cout << "==========================" << std::endl;
         std::cout << "RESPONSES FROM ROOT OBJECT" << std::endl;
@@ -497,6 +520,10 @@ void ObjectManagement::removeObject(ObjectHandle the_object,
 
     comm->requestFederateService(&req);
 
+    if (peers) {
+        peers->removeObject(the_object);
+    }
+
     auto responses = rootObject->deleteObjectInstance(the_federate, the_object, theTime, the_tag);
     std::cout << "==========================" << std::endl;
     std::cout << "RESPONSES FROM ROOT OBJECT" << std::endl;
@@ -518,6 +545,10 @@ void ObjectManagement::removeObject(ObjectHandle the_object,
 
     comm->requestFederateService(&req);
 
+    if (peers) {
+        peers->removeObject(the_object);
+    }
+
     auto responses = rootObject->deleteObjectInstance(the_federate, the_object, the_tag);
     std::cout << "==========================" << std::endl;
     std::cout << "RESPONSES FROM ROOT OBJECT" << std::endl;
@@ -33,6 +33,7 @@ class Communications;
 class Queues;
 class FederationManagement;
 class TimeManagement;
+class PeerRouting;
 
 class ObjectManagement {
 public:
@@ -270,6 +271,7 @@ public:
     const std::string& getOrderingName(OrderType theType);
 
     TimeManagement* tm;
+    PeerRouting* peers{nullptr};
 
 protected:
     Communications* comm;
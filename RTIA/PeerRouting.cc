@@ -0,0 +1,349 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "PeerRouting.hh"
+#include <config.h>
+
+#include <algorithm>
+
+#include <libCERTI/ObjectAttribute.hh>
+#include <libCERTI/ObjectClassSet.hh>
+#include <libCERTI/ObjectSet.hh>
+#include <libCERTI/PrettyDebug.hh>
+
+#include "Communications.hh"
+#include "FederationManagement.hh"
+
+namespace certi {
+namespace rtia {
+
+static PrettyDebug D("RTIA_PEER", "(RTIA Peer) ");
+
+namespace {
+/// Direct reflections set aside at most, waiting for the discovery of their object.
+constexpr size_t MAX_UNDISCOVERED = 256;
+
+/// Removed objects remembered at most, to drop their late direct reflections.
+constexpr size_t MAX_REMOVED = 256;
+}
+
+PeerRouting::PeerRouting(Communications* GC, FederationManagement* GF, RootObject* theRootObj)
+    : comm(GC), fm(GF), rootObject(theRootObj)
+{
+}
+
+PeerRouting::~PeerRouting()
+{
+    for (auto reflection : my_undiscovered) {
+        delete reflection;
+    }
+}
+
+void PeerRouting::update(const NM_Peer_Route& route)
+{
+    const FederateHandle federate = route.getFederate();
+
+    if (route.getObjectClass() == 0 && route.getPeerPort() != 0) {
+        Debug(D, pdRegister) << "Federate " << federate << " joined, its RTIA accepts direct updates" << std::endl;
+        my_endpoints[federate] = Endpoint{route.getPeerAddress(), route.getPeerPort()};
+        return;
+    }
+
+    if (route.getObjectClass() == 0) {
+        Debug(D, pdRegister) << "Federate " << federate << " left, no more route to it" << std::endl;
+        for (auto& routes : my_routes) {
+            routes.second.erase(federate);
+        }
+        my_endpoints.erase(federate);
+        comm->closePeer(federate);
+        return;
+    }
+
+    my_endpoints[federate] = Endpoint{route.getPeerAddress(), route.getPeerPort()};
+
+    Subscribers& subscribers = my_routes[route.getObjectClass()];
+    if (route.getAttributesSize() == 0) {
+        subscribers.erase(federate);
+    }
+    else {
+        subscribers[federate] = std::set<AttributeHandle>(route.getAttributes().begin(), route.getAttributes().end());
+    }
+
+    Debug(D, pdRegister) << "Federate " << federate << " subscribes to " << route.getAttributesSize()
+                         << " attributes of class " << route.getObjectClass() << std::endl;
+}
+
+void PeerRouting::addObject(ObjectHandle object)
+{
+    my_objects.insert(object);
+    my_sequences[object] = 0;
+}
+
+void PeerRouting::forgetObject(ObjectHandle object)
+{
+    // still numbered: the direct updates sent before may be late
+    my_objects.erase(object);
+}
+
+void PeerRouting::deleteObject(ObjectHandle object)
+{
+    my_objects.erase(object);
+    my_sequences.erase(object);
+}
+
+uint32_t PeerRouting::nextSequence(ObjectHandle object)
+{
+    auto sequence = my_sequences.find(object);
+    if (!comm->usesPeerToPeer() || sequence == my_sequences.end()) {
+        return 0;
+    }
+    // 0 is not a sequence number
+    if (++sequence->second == 0) {
+        ++sequence->second;
+    }
+    return sequence->second;
+}
+
+bool PeerRouting::updateAttributeValues(ObjectHandle object,
+                                        const std::vector<AttributeHandle>& attributes,
+                                        const std::vector<AttributeValue_t>& values,
+                                        uint32_t size,
+                                        const std::string& tag,
+                                        uint32_t sequence)
+{
+    if (!comm->usesPeerToPeer() || my_objects.count(object) == 0) {
+        return false;
+    }
+
+    const FederateHandle me = fm->getFederateHandle();
+
+    // The RTIG checks what this RTIA cannot, and reports the errors.
+    ObjectClassHandle the_class;
+    try {
+        for (uint32_t i = 0; i < size; ++i) {
+            const ObjectAttribute* attribute = rootObject->getObjectAttribute(object, attributes[i]);
+            if (attribute->getOwner() != me || attribute->getRegion()) {
+                return false;
+            }
+        }
+        the_class = rootObject->objects->getObjectClass(object);
+    }
+    catch (Exception&) {
+        return false;
+    }
+
+    const auto subscribers = subscribersOf(the_class, attributes, size);
+
+    // all of them or none: the RTIG would reflect to every subscriber
+    for (const auto& subscriber : subscribers) {
+        auto endpoint = my_endpoints.find(subscriber.first);
+        if (endpoint == my_endpoints.end() || endpoint->second.port == 0
+            || !comm->connectPeer(subscriber.first, endpoint->second.address, endpoint->second.port)) {
+            return false;
+        }
+    }
+
+    for (const auto& subscriber : subscribers) {
+        NM_Reflect_Attribute_Values reflection;
+        reflection.setFederation(fm->getFederationHandle().get());
+        reflection.setFederate(me);
+        reflection.setException(Exception::Type::NO_EXCEPTION);
+        reflection.setObject(object);
+        reflection.setLabel(tag);
+        reflection.setPeer(true);
+        if (sequence) {
+            reflection.setSequence(sequence);
+        }
+
+        reflection.setAttributesSize(subscriber.second.size());
+        reflection.setValuesSize(subscriber.second.size());
+        for (uint32_t i = 0; i < subscriber.second.size(); ++i) {
+            reflection.setAttributes(attributes[subscriber.second[i]], i);
+            reflection.setValues(values[subscriber.second[i]], i);
+        }
+
+        // a lost link is not tried again, the next updates go through the RTIG
+        comm->sendToPeer(subscriber.first, &reflection);
+    }
+
+    Debug(D, pdDebug) << "Update of object " << object << " sent to " << subscribers.size() << " RTIAs" << std::endl;
+    return true;
+}
+
+bool PeerRouting::filterReflection(NM_Reflect_Attribute_Values* reflection)
+{
+    ObjectClassHandle the_class;
+    try {
+        the_class = rootObject->objects->getObjectClass(reflection->getObject());
+    }
+    catch (ObjectNotKnown&) {
+        if (std::find(my_removed.begin(), my_removed.end(), reflection->getObject()) != my_removed.end()) {
+            Debug(D, pdDebug) << "Direct reflection of removed object " << reflection->getObject() << " dropped"
+                              << std::endl;
+            delete reflection;
+            return false;
+        }
+        // the discovery comes through the RTIG, it may be late
+        if (my_undiscovered.size() == MAX_UNDISCOVERED) {
+            delete my_undiscovered.front();
+            my_undiscovered.pop_front();
+        }
+        my_undiscovered.push_back(reflection);
+        return false;
+    }
+
+    // the RTIG announced the senders long before the discovery of their objects
+    const FederateHandle me = fm->getFederateHandle();
+    if (reflection->getFederate() == me || my_endpoints.count(reflection->getFederate()) == 0) {
+        Debug(D, pdDebug) << "Direct reflection from unrouted federate " << reflection->getFederate() << " dropped"
+                          << std::endl;
+        delete reflection;
+        return false;
+    }
+
+    // the sender may not know yet that the subscription changed
+    std::set<AttributeHandle> subscribed;
+    for (ObjectClassHandle c = the_class; c != 0; c = rootObject->ObjectClasses->getObjectFromHandle(c)->getSuperclass()) {
+        auto routes = my_routes.find(c);
+        if (routes == my_routes.end()) {
+            continue;
+        }
+        auto mine = routes->second.find(me);
+        if (mine != routes->second.end()) {
+            subscribed.insert(mine->second.begin(), mine->second.end());
+        }
+    }
+
+    for (uint32_t i = reflection->getAttributesSize(); i-- > 0;) {
+        if (subscribed.count(reflection->getAttributes(i)) == 0) {
+            reflection->removeAttributes(i);
+            reflection->removeValues(i);
+        }
+    }
+
+    if (reflection->getAttributesSize() == 0) {
+        delete reflection;
+        return false;
+    }
+    return true;
+}
+
+std::vector<NM_Reflect_Attribute_Values*> PeerRouting::takeUndiscovered(ObjectHandle object)
+{
+    // the RTIG gives the handles of the removed objects again
+    my_removed.erase(std::remove(my_removed.begin(), my_removed.end(), object), my_removed.end());
+
+    std::vector<NM_Reflect_Attribute_Values*> reflections;
+    for (auto it = my_undiscovered.begin(); it != my_undiscovered.end();) {
+        if ((*it)->getObject() == object) {
+            reflections.push_back(*it);
+            it = my_undiscovered.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    return reflections;
+}
+
+bool PeerRouting::inSequence(const NM_Reflect_Attribute_Values& reflection)
+{
+    if (!reflection.hasSequence()) {
+        return true;
+    }
+
+    auto inserted = my_received_sequences.emplace(std::make_pair(reflection.getFederate(), reflection.getObject()),
+                                                  reflection.getSequence());
+    if (inserted.second) {
+        return true;
+    }
+
+    uint32_t& last = inserted.first->second;
+    // modulo 2^32, the numbers of an object wrap around
+    if (static_cast<int32_t>(reflection.getSequence() - last) <= 0) {
+        Debug(D, pdDebug) << "Reflection " << reflection.getSequence() << " of object " << reflection.getObject()
+                          << " overtaken by " << last << ", dropped" << std::endl;
+        return false;
+    }
+    last = reflection.getSequence();
+    return true;
+}
+
+void PeerRouting::removeObject(ObjectHandle object)
+{
+    for (auto it = my_undiscovered.begin(); it != my_undiscovered.end();) {
+        if ((*it)->getObject() == object) {
+            delete *it;
+            it = my_undiscovered.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    for (auto it = my_received_sequences.begin(); it != my_received_sequences.end();) {
+        if (it->first.second == object) {
+            it = my_received_sequences.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    if (my_removed.size() == MAX_REMOVED) {
+        my_removed.pop_front();
+    }
+    my_removed.push_back(object);
+}
+
+std::map<FederateHandle, std::vector<uint32_t>> PeerRouting::subscribersOf(
+    ObjectClassHandle the_class, const std::vector<AttributeHandle>& attributes, uint32_t size) const
+{
+    const FederateHandle me = fm->getFederateHandle();
+
+    // like ObjectClass::broadcastClassMessage, from the class of the object up
+    std::map<FederateHandle, std::set<uint32_t>> found;
+    for (ObjectClassHandle c = the_class; c != 0; c = rootObject->ObjectClasses->getObjectFromHandle(c)->getSuperclass()) {
+        auto routes = my_routes.find(c);
+        if (routes == my_routes.end()) {
+            continue;
+        }
+        for (const auto& subscriber : routes->second) {
+            if (subscriber.first == me) {
+                continue;
+            }
+            for (uint32_t i = 0; i < size; ++i) {
+                if (subscriber.second.count(attributes[i])) {
+                    found[subscriber.first].insert(i);
+                }
+            }
+        }
+    }
+
+    std::map<FederateHandle, std::vector<uint32_t>> subscribers;
+    for (const auto& subscriber : found) {
+        subscribers[subscriber.first].assign(subscriber.second.begin(), subscriber.second.end());
+    }
+    return subscribers;
+}
+}
+} // namespace certi::rtia
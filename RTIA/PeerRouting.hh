@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_RTIA_PEER_ROUTING_HH
+#define _CERTI_RTIA_PEER_ROUTING_HH
+
+#include <include/certi.hh>
+
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/RootObject.hh>
+
+#include <deque>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace certi {
+namespace rtia {
+
+class Communications;
+class FederationManagement;
+
+/** Updates without time stamp sent directly to the RTIAs of the subscribers.
+ *
+ * When the RTIG uses peer to peer (CERTI_PEER_TO_PEER), it sends every RTIA
+ * the attributes each federate subscribes to, class by class, with the
+ * address its RTIA accepts the updates on (NM_Peer_Route). A route without
+ * class announces a federate which joined, or left when it has no port: only
+ * the reflections of the federates announced are accepted. An update of an
+ * object the federate registered then goes straight to the RTIAs of the
+ * subscribers instead of crossing the RTIG twice; everything else (time
+ * stamped updates, interactions, regions, ownership transfers) still goes
+ * through the RTIG, which stays the control plane.
+ *
+ * The routes follow the subscriptions with the delay of one message from
+ * the RTIG: an update sent meanwhile may miss a new subscriber, like a
+ * best effort one.
+ *
+ * The updates of an object may switch paths whenever the routes change, so
+ * those without time stamp carry a sequence number, per object, on both
+ * paths: the RTIA of a subscriber drops a reflection older than the last one
+ * it queued for the same object, rather than reflecting it out of order.
+ */
+class PeerRouting {
+public:
+    PeerRouting(Communications*, FederationManagement*, RootObject*);
+    ~PeerRouting();
+
+    /// Record a route sent by the RTIG.
+    void update(const NM_Peer_Route& route);
+
+    /// The federate registered the object: it owns the attributes it publishes.
+    void addObject(ObjectHandle object);
+
+    /** The updates of the object go through the RTIG from now on: the
+     * federate deletes it or gives attributes away, and the RTIA does not
+     * follow the ownership transfers.
+     */
+    void forgetObject(ObjectHandle object);
+
+    /// The federate deleted the object.
+    void deleteObject(ObjectHandle object);
+
+    /** The sequence number of the next update without time stamp of the
+     * object, to be sent whichever the path.
+     * @return 0 if the updates of the object never go directly to the other RTIAs
+     */
+    uint32_t nextSequence(ObjectHandle object);
+
+    /** Send an update without time stamp to the RTIAs of the subscribers.
+     * @return false if it must go through the RTIG: the routes are unknown,
+     * the object or the attributes are not simply owned by the federate,
+     * or a subscriber does not accept direct updates
+     */
+    bool updateAttributeValues(ObjectHandle object,
+                               const std::vector<AttributeHandle>& attributes,
+                               const std::vector<AttributeValue_t>& values,
+                               uint32_t size,
+                               const std::string& tag,
+                               uint32_t sequence);
+
+    /** Check a reflection another RTIA sent directly, which must come from
+     * a federate the RTIG announced, keeping only the attributes the
+     * federate subscribes to.
+     * @return false if it must not be queued: it is deleted, or set aside
+     * until its object is discovered (see takeUndiscovered())
+     */
+    bool filterReflection(NM_Reflect_Attribute_Values* reflection);
+
+    /// The reflections set aside until the object was discovered, oldest first.
+    std::vector<NM_Reflect_Attribute_Values*> takeUndiscovered(ObjectHandle object);
+
+    /** Check the sequence number of a reflection about to be queued.
+     * @return false if it was overtaken by a newer reflection of its object
+     */
+    bool inSequence(const NM_Reflect_Attribute_Values& reflection);
+
+    /** The object was removed: the direct reflections still set aside for it,
+     * or arriving late, are deleted.
+     */
+    void removeObject(ObjectHandle object);
+
+private:
+    struct Endpoint {
+        uint32_t address;
+        uint32_t port;
+    };
+
+    typedef std::map<FederateHandle, std::set<AttributeHandle>> Subscribers;
+
+    /// The subscribers of the attributes, at the class of the object and above.
+    std::map<FederateHandle, std::vector<uint32_t>> subscribersOf(ObjectClassHandle the_class,
+                                                                const std::vector<AttributeHandle>& attributes,
+                                                                uint32_t size) const;
+
+    Communications* comm;
+    FederationManagement* fm;
+    RootObject* rootObject;
+
+    /// the routes, by class
+    std::map<ObjectClassHandle, Subscribers> my_routes;
+    std::map<FederateHandle, Endpoint> my_endpoints;
+
+    /// objects registered by the federate and still simply owned by it
+    std::set<ObjectHandle> my_objects;
+
+    /// last sequence numbers sent, of the objects registered by the federate
+    std::map<ObjectHandle, uint32_t> my_sequences;
+
+    /// last sequence numbers queued, by updating federate and object
+    std::map<std::pair<FederateHandle, ObjectHandle>, uint32_t> my_received_sequences;
+
+    /// direct reflections which overtook the discovery of their object, oldest first
+    std::deque<NM_Reflect_Attribute_Values*> my_undiscovered;
+
+    /// objects removed lately, their late direct reflections are not set aside, oldest first
+    std::deque<ObjectHandle> my_removed;
+};
+}
+} // namespace certi::rtia
+
+#endif // _CERTI_RTIA_PEER_ROUTING_HH
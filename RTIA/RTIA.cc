@@ -39,11 +39,14 @@ RTIA::RTIA(int RTIA_port, int RTIA_fd)
     , dm{&comm, &fm, &my_root_object}
     , tm{&comm, &queues, &fm, &dm, &om, &owm}
     , ddm{&my_root_object, &fm, &comm}
+    , peers{&comm, &fm, &my_root_object}
 {
     fm.setTm(&tm);
     queues.fm = &fm;
     queues.dm = &dm;
     om.tm = &tm;
+    om.peers = &peers;
+    comm.setDataMessageHandler([this](NetworkMessage* msg) { processNetworkMessage(msg); });
 }
 
 RTIA::~RTIA()
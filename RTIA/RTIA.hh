@@ -32,6 +32,7 @@
 #include "FederationManagement.hh"
 #include "ObjectManagement.hh"
 #include "OwnershipManagement.hh"
+#include "PeerRouting.hh"
 #include "Statistics.hh"
 #include "TimeManagement.hh"
 
@@ -109,6 +110,7 @@ private:
     DeclarationManagement dm;
     TimeManagement tm;
     DataDistribution ddm;
+    PeerRouting peers;
     
     std::string rti_version;
 };
@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "RTIAThread.hh"
+
+#include <iostream>
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <pthread.h>
+#endif
+
+#include "RTIA.hh"
+
+namespace certi {
+namespace rtia {
+
+static PrettyDebug D("RTIA_THREAD", "(RTIA Thread) ");
+
+RTIAThread::RTIAThread(int RTIA_port, int RTIA_fd)
+{
+#ifndef _WIN32
+    // Signals are for the federate: the RTIA thread inherits a mask blocking
+    // them all, so that they never interrupt its select() nor run its handlers.
+    sigset_t nset, oset;
+    sigfillset(&nset);
+    pthread_sigmask(SIG_SETMASK, &nset, &oset);
+#endif
+
+    my_thread = std::thread{&RTIAThread::run, RTIA_port, RTIA_fd};
+
+#ifndef _WIN32
+    pthread_sigmask(SIG_SETMASK, &oset, nullptr);
+#endif
+}
+
+RTIAThread::~RTIAThread()
+{
+    if (my_thread.joinable()) {
+        my_thread.join();
+    }
+}
+
+#ifdef CERTI_REALTIME_EXTENSIONS
+int RTIAThread::setScheduler(int policy, int priority)
+{
+    struct sched_param parameters;
+    parameters.sched_priority = priority;
+
+    // pthread functions return the error instead of setting errno
+    int error = pthread_setschedparam(my_thread.native_handle(), policy, &parameters);
+    if (error) {
+        errno = error;
+        return -1;
+    }
+    return 0;
+}
+
+int RTIAThread::setAffinity(const cpu_set_t& mask)
+{
+    int error = pthread_setaffinity_np(my_thread.native_handle(), sizeof(cpu_set_t), &mask);
+    if (error) {
+        errno = error;
+        return -1;
+    }
+    return 0;
+}
+#endif
+
+void RTIAThread::run(int RTIA_port, int RTIA_fd)
+{
+    // the name is per thread, the federate thread keeps its own
+    PrettyDebug::setFederateName("RTIA::UnknownFederate");
+    Debug(D, pdInit) << "In-process RTIA started" << std::endl;
+
+    // Same termination policy as the rtia executable (see main.cc),
+    // but an exception must never escape the thread.
+    try {
+        RTIA rtia(RTIA_port, RTIA_fd);
+
+        try {
+            rtia.execute();
+        }
+        catch (Exception& e) {
+            Debug(D, pdExcept) << "In-process RTIA has thrown " << e.name() << " exception: " << e.reason()
+                               << std::endl;
+        }
+
+        rtia.displayStatistics();
+    }
+    catch (Exception& e) {
+        std::cerr << "RTIA:: RTIA has thrown " << e.name() << " exception." << std::endl;
+        if (!e.reason().empty()) {
+            std::cerr << "RTIA:: Reason: " << e.reason() << std::endl;
+        }
+    }
+
+    Debug(D, pdTerm) << "In-process RTIA ended" << std::endl;
+}
+}
+} // namespace certi/rtia
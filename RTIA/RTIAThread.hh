@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_RTIA_THREAD_HH
+#define _CERTI_RTIA_THREAD_HH
+
+#include <thread>
+
+#ifdef CERTI_REALTIME_EXTENSIONS
+#include <sched.h>
+#endif
+
+namespace certi {
+
+namespace rtia {
+
+/** In-process RTIA.
+ *
+ * When CERTI is built with CERTI_RTIA_IN_PROCESS, libRTI does not fork/exec
+ * a rtia process for each RTIambassador: the RTIA engine runs on a thread of
+ * the federate process instead. The federate and its RTIA thread exchange
+ * their messages through in-memory rings (see SocketSHMRing); the socket
+ * pair between them is only written to wake up a sleeping side.
+ *
+ * The thread ends by itself once the federate closed the connection
+ * (CLOSE_CONNEXION or federate socket closed); the destructor waits for it.
+ */
+class RTIAThread {
+public:
+    /** Start the RTIA engine.
+     * @param RTIA_port tcp port of the federate (RTIA_USE_TCP), unused if RTIA_fd is valid
+     * @param RTIA_fd RTIA end of the federate socket pair, the RTIA owns it from now on
+     */
+    RTIAThread(int RTIA_port, int RTIA_fd);
+
+    RTIAThread(const RTIAThread&) = delete;
+    RTIAThread& operator=(const RTIAThread&) = delete;
+
+    ~RTIAThread();
+
+#ifdef CERTI_REALTIME_EXTENSIONS
+    /** Real-time extensions: the RTIA is a thread of the federate, not a
+     * process, so sched_setscheduler()/sched_setaffinity() on a pid do not apply.
+     * @return 0, or -1 with errno set, as sched_setscheduler() does
+     */
+    int setScheduler(int policy, int priority);
+
+    /// @return 0, or -1 with errno set, as sched_setaffinity() does
+    int setAffinity(const cpu_set_t& mask);
+#endif
+
+private:
+    static void run(int RTIA_port, int RTIA_fd);
+
+    std::thread my_thread;
+};
+}
+} // namespace certi/rtia
+
+#endif // _CERTI_RTIA_THREAD_HH
@@ -632,6 +632,7 @@ void RTIA::chooseFederateProcessing(Message* request, Message* answer, Exception
                           << std::endl;
         Debug(D, pdTrace) << "Object " << UAODq->getObject() << " number of attributes " << UAODq->getAttributesSize()
                           << std::endl;
+        peers.forgetObject(UAODq->getObject());
         owm.unconditionalAttributeOwnershipDivestiture(
             UAODq->getObject(), UAODq->getAttributes(), UAODq->getAttributesSize(), e);
     } break;
@@ -644,6 +645,7 @@ void RTIA::chooseFederateProcessing(Message* request, Message* answer, Exception
                           << std::endl;
         Debug(D, pdTrace) << "Object " << NAODq->getObject() << " ; nb Attribute " << NAODq->getAttributesSize()
                           << std::endl;
+        peers.forgetObject(NAODq->getObject());
         owm.negotiatedAttributeOwnershipDivestiture(
             NAODq->getObject(), NAODq->getAttributes(), NAODq->getAttributesSize(), request->getTag(), e);
     } break;
@@ -672,6 +674,7 @@ void RTIA::chooseFederateProcessing(Message* request, Message* answer, Exception
         Debug(D, pdTrace) << "Object " << AORRq->getObject() << " nb Attribute " << AORRq->getAttributesSize()
                           << std::endl;
 
+        peers.forgetObject(AORRq->getObject());
         AttributeHandleSet* theAttributes = owm.attributeOwnershipRealeaseResponse(
             AORRq->getObject(), AORRq->getAttributes(), AORRq->getAttributesSize(), e);
         if (e == Exception::Type::NO_EXCEPTION) {
@@ -1187,6 +1190,11 @@ void RTIA::chooseFederateProcessing(Message* request, Message* answer, Exception
     case Message::TICK_REQUEST_STOP:
         // called to terminate tick() when error occured
         // do not invoke any callbacks, reset _tick_state and return
+        if (tm._tick_state == TimeManagement::NO_TICK) {
+            // the tick() the federate wanted to stop has already returned
+            // (HLA_IMMEDIATE callback thread): nothing to answer
+            break;
+        }
         tm._tick_state = TimeManagement::TICK_RETURN;
 
         processOngoingTick();
@@ -1323,6 +1331,11 @@ void RTIA::initFederateProcessing(Message* request, Message* answer)
             OCr->setVersionMajor(CERTI_Message::versionMajor);
             OCr->setVersionMinor(minorEffective);
 
+            // the reply tells the federate whether the rings are used
+            if (OCq->hasShmRingName() && comm.attachFederateRing(OCq->getShmRingName())) {
+                OCr->setShmRingName(OCq->getShmRingName());
+            }
+
             fm.setConnectionState(FederationManagement::ConnectionState::Ready);
         }
         else {
@@ -1706,6 +1719,13 @@ void RTIA::processFederateRequest(Message* request)
         rep->setException(Exception::Type::RTIinternalError);
     }
 
+    // Every other service is a flush point (tick, time advance requests...):
+    // the RTIG must get the updates and interactions before what follows.
+    if (request->getMessageType() != Message::UPDATE_ATTRIBUTE_VALUES
+        && request->getMessageType() != Message::SEND_INTERACTION) {
+        comm.flushMessages();
+    }
+
     delete request;
 
     if (rep->getMessageType() != Message::TICK_REQUEST && rep->getMessageType() != Message::TICK_REQUEST_NEXT
@@ -1714,6 +1734,11 @@ void RTIA::processFederateRequest(Message* request)
         // the TICK_REQUEST confirmation is generated in processOngoingTick()
         comm.sendUN(rep.get());
         Debug(D, pdDebug) << "Reply send to Unix socket." << std::endl;
+
+        if (rep->getMessageType() == Message::OPEN_CONNEXION
+            && static_cast<M_Open_Connexion*>(rep.get())->hasShmRingName()) {
+            comm.activateFederateRing();
+        }
     }
     Debug(G, pdGendoc) << "exit  RTIA::processFederateRequest" << std::endl;
 } /* end of RTIA::processFederateRequest(Message *req) */
@@ -71,6 +71,20 @@ void RTIA::processNetworkMessage(NetworkMessage* request)
         break;
     }
 
+    case NetworkMessage::Type::PEER_ROUTE:
+        Debug(D, pdTrace) << "Receiving Message from RTIG, type NetworkMessage::PEER_ROUTE." << std::endl;
+        peers.update(static_cast<NM_Peer_Route&>(*request));
+        delete request;
+        break;
+
+    case NetworkMessage::Type::MESSAGE_NULL_REQUEST: {
+        Debug(DNULL, pdDebug) << "NULL message request received (Federate=" << request->getFederate()
+                              << ", Time = " << request->getDate().getTime() << ")" << std::endl;
+        tm.nullMessageRequested(request->getDate());
+        delete request;
+        break;
+    }
+
     case NetworkMessage::Type::SET_TIME_REGULATING: {
         // Another federate is becoming regulating.
         Debug(D, pdTrace) << "Receving Message from RTIG, type NetworkMessage::SET_TIME_REGULATING." << std::endl;
@@ -131,6 +145,11 @@ void RTIA::processNetworkMessage(NetworkMessage* request)
         catch (ObjectAlreadyRegistered&) {
         }
 
+        // the direct reflections which came first
+        for (auto reflection : peers.takeUndiscovered(DO->getObject())) {
+            processNetworkMessage(reflection);
+        }
+
     } break;
 
     case NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES: {
@@ -152,6 +171,34 @@ void RTIA::processNetworkMessage(NetworkMessage* request)
         // decided to store message as TSO only if all attributes meets TSO
         // criteria. Otherwise, a single message will be enqueue in FIFO.
 
+        if (RAV->hasMulticastClass() && !dm.filterMulticast(*RAV)) {
+            delete request;
+            break;
+        }
+
+        // sent by another RTIA, which may not know the subscriptions changed
+        if (RAV->hasPeer() && !peers.filterReflection(RAV)) {
+            break;
+        }
+
+        // A best effort reflection comes over UDP and may overtake the
+        // discovery of its object, it is dropped as it could have been lost.
+        ObjectClassHandle och;
+        try {
+            och = my_root_object.objects->getObjectClass(RAV->getObject());
+        }
+        catch (ObjectNotKnown&) {
+            Debug(D, pdDebug) << "Reflection of undiscovered object " << RAV->getObject() << " dropped" << std::endl;
+            delete request;
+            break;
+        }
+
+        // the updates of the object may have switched from or to the direct path
+        if (!peers.inSequence(*RAV)) {
+            delete request;
+            break;
+        }
+
         // Here we have to consider RAV without time
         if (!request->isDated()) {
             // without time
@@ -160,9 +207,6 @@ void RTIA::processNetworkMessage(NetworkMessage* request)
         else {
             // Retrieve order type
             updateOrder = TIMESTAMP;
-            // FIXME we may inspect rootObject for an unknown object which has
-            // (not yet) been discovered...because DiscoverObject is a RO message
-            ObjectClassHandle och = my_root_object.objects->getObjectClass(RAV->getObject());
             //std::cerr << "FOUND och = " <<och << "  for object " << RAV->getObject() <<std::endl;
             for (uint32_t i = 0; i < RAV->getAttributesSize(); ++i) {
                 // FIXME we need an object **CLASS** handle and not an **OBJECT* handle
@@ -194,6 +238,11 @@ void RTIA::processNetworkMessage(NetworkMessage* request)
 
         Debug(D, pdTrace) << "Receving Message from RTIG, type NetworkMessage::RECEIVE_INTERACTION." << std::endl;
 
+        if (RI->hasMulticast() && !dm.filterMulticast(*RI)) {
+            delete request;
+            break;
+        }
+
         // Here we have to consider RAV without time
         if (!request->isDated()) {
             // without time
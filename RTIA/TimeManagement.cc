@@ -573,6 +573,11 @@ void TimeManagement::timeAdvance(bool& msg_restant, Exception::Type& e)
 
                 _avancee_en_cours = PAS_D_AVANCEE;
             }
+#ifdef CERTI_USE_DEMAND_DRIVEN_NULL_MESSAGE
+            else {
+                sendNullMessageRequest(date_avancee);
+            }
+#endif
             // otherwise nothing has to be sent to federate (empty tick).
         }
         else {
@@ -687,6 +692,9 @@ void TimeManagement::nextEventAdvance(bool& msg_restant, Exception::Type& e)
                 sendNullMessage(_LBTS);
                 #endif
             }
+#ifdef CERTI_USE_DEMAND_DRIVEN_NULL_MESSAGE
+            sendNullMessageRequest(date_min);
+#endif
         }
     }
 
@@ -1003,6 +1011,14 @@ void TimeManagement::sendNullMessage(FederationTime logical_time)
     // must be logical time + lookahead
     logical_time += _lookahead_courant;
 
+#ifdef CERTI_USE_DEMAND_DRIVEN_NULL_MESSAGE
+    // Nobody is waiting for us: keep the NULL message for later.
+    if (!_nullMessageRequested) {
+        Debug(DNULL, pdDebug) << "NULL message not requested, Time = " << logical_time.getTime() << std::endl;
+        return;
+    }
+#endif
+
     if (logical_time > _lastNullMessageDate) {
         msg.setFederation(fm->getFederationHandle().get());
         msg.setFederate(fm->getFederateHandle());
@@ -1011,6 +1027,10 @@ void TimeManagement::sendNullMessage(FederationTime logical_time)
         comm->sendMessage(&msg);
         _lastNullMessageDate = logical_time;
         Debug(DNULL, pdDebug) << "NULL message sent, Time = " << logical_time.getTime() << std::endl;
+
+        if (logical_time > _nullMessageRequestDate) {
+            _nullMessageRequested = false;
+        }
     }
     else {
         Debug(DNULL, pdExcept) << "NULL message not sent, Time = " << logical_time.getTime()
@@ -1018,6 +1038,63 @@ void TimeManagement::sendNullMessage(FederationTime logical_time)
     }
 }
 
+void TimeManagement::nullMessageRequested(FederationTime logical_time)
+{
+    if (!_is_regulating) {
+        Debug(DNULL, pdExcept) << "NULL message requested but federate is not regulating" << std::endl;
+        return;
+    }
+
+    Debug(DNULL, pdDebug) << "NULL message requested, Time = " << logical_time.getTime() << std::endl;
+
+    if (!_nullMessageRequested || logical_time > _nullMessageRequestDate) {
+        _nullMessageRequestDate = logical_time;
+    }
+    _nullMessageRequested = true;
+
+    // Answer with the lowest time we may still send a TSO message at.
+    switch (_avancee_en_cours) {
+    case TAR:
+    case TARA:
+        sendNullMessage(date_avancee);
+        break;
+    case NER:
+    case NERA:
+        if (_is_constrained) {
+            FederationTime min_next_event = requestMinNextEventTime();
+            sendNullMessage(min_next_event < date_avancee ? min_next_event : date_avancee);
+        }
+        else {
+            sendNullMessage(date_avancee);
+        }
+        break;
+    default:
+        sendNullMessage(_heure_courante);
+        break;
+    }
+}
+
+void TimeManagement::sendNullMessageRequest(FederationTime logical_time)
+{
+    // Ask again only if we now wait for a later time or if the set of
+    // regulators changed since the last request (a newcomer was not asked).
+    if (_nullMessageRequestSent && logical_time <= _lastNullMessageRequestDate
+        && size() == _lastNullMessageRequestRegulators) {
+        return;
+    }
+
+    NM_Message_Null_Request msg;
+    msg.setFederation(fm->getFederationHandle().get());
+    msg.setFederate(fm->getFederateHandle());
+    msg.setDate(logical_time);
+
+    comm->sendMessage(&msg);
+    _nullMessageRequestSent = true;
+    _lastNullMessageRequestDate = logical_time;
+    _lastNullMessageRequestRegulators = size();
+    Debug(DNULL, pdDebug) << "NULL message request sent, Time = " << logical_time.getTime() << std::endl;
+}
+
 FederationTime TimeManagement::sendNullPrimeMessage(FederationTime logical_time)
 {
     NM_Message_Null_Prime msg;
@@ -1082,9 +1159,7 @@ void TimeManagement::sendTimeStateUpdate()
         // mom disabled or no periodic update, do nothing
         return;
     }
-    
-    static std::chrono::time_point<std::chrono::system_clock> my_lastUpdate{};
-    static NM_Time_State_Update last_msg{};
+
     NM_Time_State_Update msg;
 
     msg.setFederation(fm->getFederationHandle().get());
@@ -1096,21 +1171,21 @@ void TimeManagement::sendTimeStateUpdate()
     msg.setGalt(_LBTS.getTime());
     msg.setLits(requestMinNextEventTime().getTime());
     
-    if(msg.getDate() == last_msg.getDate()
-        && msg.getLookahead() == last_msg.getLookahead()
-        && msg.getState() == last_msg.getState()
-        && msg.getGalt() == last_msg.getGalt()
-        && msg.getLits() == last_msg.getLits()) {
+    if(msg.getDate() == my_lastTimeState.getDate()
+        && msg.getLookahead() == my_lastTimeState.getLookahead()
+        && msg.getState() == my_lastTimeState.getState()
+        && msg.getGalt() == my_lastTimeState.getGalt()
+        && msg.getLits() == my_lastTimeState.getLits()) {
         // nothing changed, do nothing
         return;
     }
 
     auto now = std::chrono::system_clock::now();
     
-    if(now - my_lastUpdate >= my_updateRate) {
+    if(now - my_lastTimeStateUpdate >= my_updateRate) {
         comm->sendMessage(&msg);
-        last_msg = msg;
-        my_lastUpdate = now;
+        my_lastTimeState = msg;
+        my_lastTimeStateUpdate = now;
         
         Debug(DTUS, pdDebug) << "Time State Update sent" << std::endl;
     }
@@ -31,6 +31,7 @@
 
 #include <libCERTI/LBTS.hh>
 #include <libCERTI/Message.hh>
+#include <libCERTI/NM_Classes.hh>
 #include <libCERTI/PrettyDebug.hh>
 
 #include "Communications.hh"
@@ -121,6 +122,14 @@ public:
     
     void setMomUpdateRate(const std::chrono::seconds updateRate);
 
+    /**
+     * A constrained federate blocked at logical_time asked us (through RTIG)
+     * for a NULL message. We answer right away with the best time we can
+     * guarantee and remember the request until our NULL messages go past it.
+     * @param[in] logical_time the time the requesting federate is waiting for
+     */
+    void nullMessageRequested(FederationTime logical_time);
+
     /**
      * The different tick state values.
      * The @tick method is the method that will be called
@@ -208,6 +217,12 @@ private:
      */
     void sendNullMessage(FederationTime logical_time);
     FederationTime sendNullPrimeMessage(FederationTime logical_time);
+    /**
+     * Ask the regulators holding back our LBTS for a NULL message
+     * (demand-driven NULL message protocol).
+     * @param[in] logical_time the time we are blocked at
+     */
+    void sendNullMessageRequest(FederationTime logical_time);
     void timeRegulationEnabled(FederationTime logical_time, Exception::Type& e);
     void timeConstrainedEnabled(FederationTime logical_time, Exception::Type& e);
     
@@ -229,6 +244,14 @@ private:
     FederationTime _nerTimeRequested{0.0};
     std::vector<double> _MyEventTimestampList;
 
+    /// Federate State for demand-driven Null Message Algorithm
+    bool _nullMessageRequested{false};
+    FederationTime _nullMessageRequestDate{0.0};
+    /// no request sent yet, whatever the time the federation starts at
+    bool _nullMessageRequestSent{false};
+    FederationTime _lastNullMessageRequestDate{0.0};
+    size_t _lastNullMessageRequestRegulators{0};
+
     /// Type/date from last request (timeAdvance, nextEvent, flushQueue)
     TypeAvancee _avancee_en_cours{PAS_D_AVANCEE};
     FederationTime date_avancee;
@@ -241,6 +264,9 @@ private:
     bool _is_constrained{false};
     
     std::chrono::seconds my_updateRate{0};
+    /// last MOM time state sent, and when
+    NM_Time_State_Update my_lastTimeState{};
+    std::chrono::time_point<std::chrono::system_clock> my_lastTimeStateUpdate{};
 };
 }
 } // namespace certi/rtia
@@ -67,6 +67,8 @@ void NewHandler()
  * (see \ref certi_user_env) environment variable. If it is void or not set then he will
  * try to connect to localhost. RTIA connect to TCP port specified by CERTI_TCP_PORT
  * and UDP port specified by CERTI_UDP_PORT.
+ * Best effort attributes and interactions are received over UDP unless
+ * CERTI_BEST_EFFORT is set to "tcp".
  *
  * @ingroup certi_executable
  */
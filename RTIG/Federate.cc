@@ -120,6 +120,22 @@ void Federate::setLastNERxValue(const FederationTime t) noexcept
     my_isUsingNERx = true;
 }
 
+void Federate::setPeerEndpoint(const uint32_t address, const uint32_t port) noexcept
+{
+    my_peer_address = address;
+    my_peer_port = port;
+}
+
+uint32_t Federate::getPeerAddress() const noexcept
+{
+    return my_peer_address;
+}
+
+uint32_t Federate::getPeerPort() const noexcept
+{
+    return my_peer_port;
+}
+
 bool Federate::isClassRelevanceAdvisorySwitch() const noexcept
 {
     return my_classRelevanceAdvisorySwitch;
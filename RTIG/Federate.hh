@@ -70,6 +70,17 @@ public:
 
     void setLastNERxValue(const FederationTime t) noexcept;
 
+    /** Where the RTIA of the federate accepts the updates the other RTIAs
+     * send directly (see SocketServer::enablePeerToPeer).
+     * @param address in network byte order
+     * @param port 0 if the RTIA does not accept them
+     */
+    void setPeerEndpoint(const uint32_t address, const uint32_t port) noexcept;
+
+    uint32_t getPeerAddress() const noexcept;
+
+    uint32_t getPeerPort() const noexcept;
+
     /**
      * Returns the current state of the ClassRelevanceAdvisory switch.
      * @return a boolean indicating the current state of the switch,
@@ -185,6 +196,9 @@ private:
     /// The last NERx timestamp value received for this federate.
     FederationTime my_lastNERxValueReceived{};
 
+    uint32_t my_peer_address{0};
+    uint32_t my_peer_port{0};
+
     bool my_classRelevanceAdvisorySwitch{true};
     bool my_interactionRelevanceAdvisorySwitch{true};
     bool my_attributeRelevanceAdvisorySwitch{false};
@@ -98,17 +98,45 @@ static PrettyDebug D("FEDERATION", __FILE__);
 static PrettyDebug G("GENDOC", __FILE__);
 static PrettyDebug DNULL("RTIG_NULLMSG", "[RTIG NULL MSG]");
 
-#ifdef FEDERATION_USES_MULTICAST
-Federation::Federation(const string& federation_name,
-                       const FederationHandle federation_handle,
-                       SocketServer& socket_server,
-                       AuditFile& audit_server,
-                       const std::vector<std::string> fom_modules,
-                       const std::string& mim_module,
-                       const RtiVersion rti_version,
-                       SocketMC* mc_link,
-                       const int theVerboseLevel)
-#else
+struct Federation::SerializedFOM {
+    /// routingSpaces, objectClasses and interactionClasses, as NM_Join_Federation_Execution::serializeFOMDescription writes them
+    std::vector<uint8_t> fixed;
+    std::vector<uint8_t> compact;
+};
+
+namespace {
+/// Gives the FOM part of a join answer written by the generated code, as cachedFOM() stores it.
+struct FOMDescriptionWriter : public NM_Join_Federation_Execution {
+    using NM_Join_Federation_Execution::serializeFOMDescription;
+};
+}
+
+/** The FOM part is written from the bytes serialized by cachedFOM(): referenced
+ * by the segmented frames of SocketServer::queueSend, it is not even copied.
+ */
+class Federation::JoinAnswer : public NM_Join_Federation_Execution {
+public:
+    explicit JoinAnswer(std::shared_ptr<const SerializedFOM> fom) : my_fom(std::move(fom))
+    {
+    }
+
+protected:
+    void serializeFOMDescription(MessageBuffer& msgBuffer) override
+    {
+        const auto& fom = msgBuffer.isCompact() ? my_fom->compact : my_fom->fixed;
+        msgBuffer.write_uint8s(fom.data(), fom.size());
+    }
+
+    uint32_t serializedFOMDescriptionSize() const override
+    {
+        // the compact bytes should not be longer, but serializedSize() is an upper bound of both
+        return std::max(my_fom->fixed.size(), my_fom->compact.size());
+    }
+
+private:
+    std::shared_ptr<const SerializedFOM> my_fom;
+};
+
 Federation::Federation(const string& federation_name,
                        const FederationHandle federation_handle,
                        SocketServer& socket_server,
@@ -117,20 +145,8 @@ Federation::Federation(const string& federation_name,
                        const std::string& mim_module,
                        const RtiVersion rti_version,
                        const int verboseLevel)
-#endif
     : my_handle(federation_handle), my_name(federation_name), my_rti_version{rti_version}
 {
-#ifdef FEDERATION_USES_MULTICAST // -----------------
-    // Initialize Multicast
-    if (mc_link == nullptr) {
-        Debug(D, pdExcept) << "Null Multicast socket for new Federation." << endl;
-        throw RTIinternalError("NULL Multicast socket for new Federation.");
-    }
-
-    Debug(D, pdInit) << "New Federation " << federation_handle << " will use Multicast." << endl;
-    MCLink = mc_link;
-#endif // FEDERATION_USES_MULTICAST // --------------
-
     Debug(G, pdGendoc) << "enter Federation::Federation" << endl;
     // Allocates Name
     if (federation_name.empty() || (!federation_handle.isValid())) {
@@ -175,11 +191,6 @@ Federation::~Federation()
 //         delete(*i);
 //     }
 //     clear();
-
-#ifdef FEDERATION_USES_MULTICAST
-    FermerConnexion(mc_link);
-    delete mc_link;
-#endif
 }
 
 FederationHandle Federation::getHandle() const
@@ -269,8 +280,8 @@ std::pair<FederateHandle, Responses> Federation::add(const string& federate_name
                                                      const RtiVersion rti_version,
                                                      SocketTCP* tcp_link,
                                                      const uint32_t peer,
-                                                     const uint32_t address
-                                                    )
+                                                     const uint32_t address,
+                                                     const uint32_t peer_to_peer_port)
 {
     try {
         getFederate(federate_name);
@@ -331,15 +342,17 @@ std::pair<FederateHandle, Responses> Federation::add(const string& federate_name
         throw RTIinternalError("Network Error while initializing federate.");
     }
     
-    auto rep = make_unique<NM_Join_Federation_Execution>();
-    getFOM(*rep);
-    
-    auto fom_rep = make_unique<NM_Additional_Fom_Module>();
-    getFOM(*fom_rep);
-    
-    auto fom_resp = respondToAll(std::move(fom_rep), federate_handle);
-    responses.insert(end(responses), make_move_iterator(begin(fom_resp)), make_move_iterator(end(fom_resp)));
-    
+    auto rep = make_unique<JoinAnswer>(cachedFOM());
+
+    // The other federates only need the FOM again if this one brought new modules.
+    if (!additional_fom_modules.empty()) {
+        auto fom_rep = make_unique<NM_Additional_Fom_Module>();
+        getFOM(*fom_rep);
+
+        auto fom_resp = respondToAll(std::move(fom_rep), federate_handle);
+        responses.insert(end(responses), make_move_iterator(begin(fom_resp)), make_move_iterator(end(fom_resp)));
+    }
+
     // Prepare answer about JoinFederationExecution
     rep->setFederationExecutionName(getName());
     rep->setFederate(federate_handle);
@@ -347,18 +360,52 @@ std::pair<FederateHandle, Responses> Federation::add(const string& federate_name
     rep->setNumberOfRegulators(getNbRegulators());
     rep->setBestEffortPeer(peer);
     rep->setBestEffortAddress(address);
+    rep->setWireFormat(static_cast<uint32_t>(NetworkMessage::localWireFormat()));
 
-// Now we have to answer about JoinFederationExecution
-#ifdef FEDERATION_USES_MULTICAST
-    rep->AdresseMulticast = MCLink->returnAdress();
-#endif
+    // 0: the RTIG does not use multicast
+    const SocketServer& socket_server = my_server->getSocketServer();
+    rep->setMulticastAddress(socket_server.getMulticastBase());
+    if (socket_server.usesMulticast()) {
+        rep->setMulticastPort(socket_server.getMulticastPort());
+    }
+    // the RTIA sends its updates without time stamp to the other RTIAs
+    if (socket_server.usesPeerToPeer()) {
+        rep->setPeerPort(peer_to_peer_port);
+    }
 
+    // Now we have to answer about JoinFederationExecution
     responses.emplace_back(tcp_link, std::move(rep));
 
     // Store Federate <->Socket reference.
     my_server->getSocketServer().setReferences(
         tcp_link->returnSocket(), my_handle, federate_handle, address, peer);
 
+    if (socket_server.usesPeerToPeer()) {
+        federate.setPeerEndpoint(address ? address : tcp_link->returnAdress(), peer_to_peer_port);
+
+        // the RTIAs only accept the direct updates of the federates announced
+        for (const auto& pair : my_federates) {
+            if (pair.first != federate_handle && pair.second->getPeerPort() != 0) {
+                responses.emplace_back(tcp_link, peerRoute(pair.first, 0));
+            }
+        }
+        if (peer_to_peer_port != 0) {
+            auto resp = respondToAll(peerRoute(federate_handle, 0), federate_handle);
+            responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
+        }
+
+        // the subscriptions made before the federate joined
+        for (auto it = my_root_object->ObjectClasses->handled_begin();
+             it != my_root_object->ObjectClasses->handled_end();
+             ++it) {
+            for (const auto& pair : my_federates) {
+                if (pair.first != federate_handle && it->second->isSubscribed(pair.first)) {
+                    responses.emplace_back(tcp_link, peerRoute(pair.first, it->first));
+                }
+            }
+        }
+    }
+
     if (my_mom) {
         auto resp = my_mom->registerFederate(federate, tcp_link, additional_fom_modules);
         responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
@@ -402,6 +449,11 @@ Responses Federation::remove(FederateHandle federate_handle)
         responses = my_mom->updateFederatesInFederation();
     }
 
+    if (my_server->getSocketServer().usesPeerToPeer()) {
+        auto resp = respondToAll(peerRoute(federate_handle, 0));
+        responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
+    }
+
     auto rep = make_unique<NM_Resign_Federation_Execution>();
 
     rep->setFederate(federate_handle);
@@ -571,6 +623,35 @@ Responses Federation::removeRegulator(FederateHandle federate_handle)
     return responses;
 }
 
+Responses Federation::requestNullMessages(FederateHandle federate_handle, FederationTime time)
+{
+    Responses responses;
+
+    // It may throw FederateNotExecutionMember
+    getFederate(federate_handle);
+
+    std::vector<LBTS::FederateClock> clocks;
+    my_regulators.get(clocks);
+
+    for (const auto& clock : clocks) {
+        if (clock.first == federate_handle || clock.second > time) {
+            continue;
+        }
+
+        Debug(DNULL, pdDebug) << "Request NULL MSG from Federate " << clock.first << " (Federate=" << federate_handle
+                              << ", Time = " << time.getTime() << ")" << std::endl;
+
+        auto msg = make_unique<NM_Message_Null_Request>();
+        msg->setFederation(my_handle.get());
+        msg->setFederate(federate_handle);
+        msg->setDate(time);
+
+        responses.emplace_back(my_server->getSocketLink(clock.first), std::move(msg));
+    }
+
+    return responses;
+}
+
 Responses Federation::setConstrained(FederateHandle federate_handle, bool constrained, FederationTime time)
 {
     Responses responses;
@@ -1154,7 +1235,8 @@ Responses Federation::publishObject(FederateHandle federate_handle,
 Responses Federation::subscribeObject(FederateHandle federate,
                                       ObjectClassHandle object,
                                       const vector<AttributeHandle>& attributes,
-                                      const bool subscribe_or_unsubscribe)
+                                      const bool subscribe_or_unsubscribe,
+                                      const bool multicast)
 {
     Debug(G, pdGendoc) << "enter Federation::subscribeObject" << endl;
 
@@ -1164,6 +1246,8 @@ Responses Federation::subscribeObject(FederateHandle federate,
 
     // It may throw AttributeNotDefined
     my_root_object->ObjectClasses->subscribe(federate, object, attributes);
+    my_root_object->ObjectClasses->getObjectFromHandle(object)->setMulticastMember(federate,
+                                                                                   multicast && !attributes.empty());
 
     /*
      * The above code line (root->ObjectClasses->subscribe(...) calls the
@@ -1221,6 +1305,10 @@ Responses Federation::subscribeObject(FederateHandle federate,
          */
     }
 
+    // before the answer: the RTIA of the subscriber filters with its own route
+    auto routes = routeToPeers(federate, object);
+    responses.insert(end(responses), make_move_iterator(begin(routes)), make_move_iterator(end(routes)));
+
     if (subscribe_or_unsubscribe) {
         auto rep = make_unique<NM_Subscribe_Object_Class>();
         rep->setFederate(federate);
@@ -1243,6 +1331,44 @@ Responses Federation::subscribeObject(FederateHandle federate,
     return responses;
 }
 
+Responses Federation::routeToPeers(FederateHandle subscriber, ObjectClassHandle object_class)
+{
+    if (!my_server->getSocketServer().usesPeerToPeer() || !check(subscriber)) {
+        return {};
+    }
+    return respondToAll(peerRoute(subscriber, object_class));
+}
+
+std::unique_ptr<NM_Peer_Route> Federation::peerRoute(FederateHandle subscriber, ObjectClassHandle object_class)
+{
+    auto route = make_unique<NM_Peer_Route>();
+    route->setFederation(my_handle.get());
+    route->setFederate(subscriber);
+    route->setObjectClass(object_class);
+
+    auto it = my_federates.find(subscriber);
+    if (it != my_federates.end()) {
+        route->setPeerAddress(it->second->getPeerAddress());
+        route->setPeerPort(it->second->getPeerPort());
+    }
+    else {
+        route->setPeerAddress(0);
+        route->setPeerPort(0);
+    }
+
+    if (object_class != 0) {
+        const auto& attributes = my_root_object->ObjectClasses->getObjectFromHandle(object_class)->getHandleClassAttributeMap();
+        for (const auto& pair : attributes) {
+            if (pair.second->isSubscribed(subscriber)) {
+                route->setAttributesSize(route->getAttributesSize() + 1);
+                route->setAttributes(pair.first, route->getAttributesSize() - 1);
+            }
+        }
+    }
+
+    return route;
+}
+
 void Federation::reserveObjectInstanceName(FederateHandle theFederateHandle, string newObjName)
 {
     Debug(G, pdGendoc) << "enter Federation::reserveObjectInstanceName" << endl;
@@ -1549,7 +1675,8 @@ Responses Federation::updateAttributeValues(FederateHandle federate,
                                             ObjectHandle object_handle,
                                             const vector<AttributeHandle>& attributes,
                                             const vector<AttributeValue_t>& values,
-                                            const string& tag)
+                                            const string& tag,
+                                            uint32_t sequence)
 {
     Debug(G, pdGendoc) << "enter Federation::updateAttributeValues without time" << endl;
     Responses responses;
@@ -1560,7 +1687,7 @@ Responses Federation::updateAttributeValues(FederateHandle federate,
     Object* object = my_root_object->objects->getObject(object_handle);
 
     // It may throw *NotDefined
-    responses = my_root_object->ObjectClasses->updateAttributeValues(federate, object, attributes, values, tag);
+    responses = my_root_object->ObjectClasses->updateAttributeValues(federate, object, attributes, values, tag, sequence);
 
     if (my_mom && federate != my_mom->getHandle()) {
         std::map<FederateHandle, int> reflections;
@@ -1632,7 +1759,8 @@ Responses Federation::publishInteraction(FederateHandle federate_handle,
 
 Responses Federation::subscribeInteraction(FederateHandle federate_handle,
                                            InteractionClassHandle interaction_class_handle,
-                                           bool subscribe_or_unsubscribe)
+                                           bool subscribe_or_unsubscribe,
+                                           bool multicast)
 {
     Responses responses;
 
@@ -1640,6 +1768,8 @@ Responses Federation::subscribeInteraction(FederateHandle federate_handle,
 
     // It may throw *NotDefined
     my_root_object->Interactions->subscribe(federate_handle, interaction_class_handle, 0, subscribe_or_unsubscribe);
+    my_root_object->Interactions->getObjectFromHandle(interaction_class_handle)
+        ->setMulticastMember(federate_handle, multicast && subscribe_or_unsubscribe);
     Debug(D, pdRegister) << "Federation " << my_handle << ": Federate " << federate_handle
                          << "(un)subscribes to Interaction " << interaction_class_handle << endl;
 
@@ -2085,6 +2215,27 @@ void Federation::getFOM(NM_Additional_Fom_Module& object_model_data)
     my_root_object->convertToSerializedFOM(object_model_data);
 }
 
+std::shared_ptr<const Federation::SerializedFOM> Federation::cachedFOM()
+{
+    if (!my_fom_cache) {
+        Debug(D, pdDebug) << "Serializing the FOM of federation " << my_handle << endl;
+        FOMDescriptionWriter fom;
+        getFOM(fom);
+
+        auto serialized = std::make_shared<SerializedFOM>();
+        MessageBuffer buffer;
+        for (const bool compact : {false, true}) {
+            buffer.reset();
+            buffer.setCompact(compact);
+            fom.serializeFOMDescription(buffer);
+            const auto begin = static_cast<const uint8_t*>(buffer(MessageBuffer::reservedBytes));
+            (compact ? serialized->compact : serialized->fixed).assign(begin, begin + buffer.size() - MessageBuffer::reservedBytes);
+        }
+        my_fom_cache = std::move(serialized);
+    }
+    return my_fom_cache;
+}
+
 bool Federation::updateLastNERxForFederate(FederateHandle federate_handle, FederationTime date)
 {
     bool retval = false;
@@ -2189,11 +2340,7 @@ Responses Federation::respondToAll(std::unique_ptr<NetworkMessage> message, cons
     std::vector<Socket*> sockets;
     for (const auto& pair : my_federates) {
         if (pair.first != except) {
-#ifdef HLA_USES_UDP
-            sockets.push_back(my_server->getSocketLink(pair.first, BEST_EFFORT));
-#else
             sockets.push_back(my_server->getSocketLink(pair.first));
-#endif
         }
     }
 
@@ -2209,11 +2356,7 @@ Responses Federation::respondToSome(std::unique_ptr<NetworkMessage> message,
 
     std::vector<Socket*> sockets;
     for (const auto& fed : recipients) {
-#ifdef HLA_USES_UDP
-        sockets.push_back(server->getSocketLink(fed, BEST_EFFORT));
-#else
         sockets.push_back(my_server->getSocketLink(fed));
-#endif
     }
 
     responses.emplace_back(sockets, std::move(message));
@@ -23,6 +23,7 @@
 #ifndef _CERTI_RTIG_FEDERATION_HH
 #define _CERTI_RTIG_FEDERATION_HH
 
+#include <array>
 #include <cstdint>
 #include <map>
 #include <set>
@@ -46,15 +47,12 @@
 #include "Federate.hh"
 #include "Mom.hh"
 
-#ifdef FEDERATION_USES_MULTICAST
-#include "SocketMC.hh"
-#endif
-
 namespace certi {
 class AttributeHandleSet;
 class AuditFile;
 class Extent;
 class NM_Join_Federation_Execution;
+class NM_Peer_Route;
 class NM_Resign_Federation_Execution;
 class NetworkMessage;
 class RootObject;
@@ -67,26 +65,9 @@ class Mom;
 
 class Federation {
 public:
-#ifdef FEDERATION_USES_MULTICAST
-    /**
-	 * Allocates memory the Name's storage, and read its FED file to store the
-	 * result in RootObj.
-	 *   (with FEDERATION_USES_MULTICAST defined).
-	 */
-    Federation(const std::string& federation_name,
-               const FederationHandle federation_handle,
-               SocketServer& socket_server,
-               AuditFile& audit_server,
-               const std::vector<std::string> fom_modules,
-               const std::string& mim_module,
-               const RtiVersion rti_version,
-               SocketMC* mc_link,
-               const int verboseLevel);
-#else
     /**
      * Allocates memory the Name's storage, and read its FED file to store the
      * result in RootObj.
-     * with FEDERATION_USES_MULTICAST not defined
      * @param federation_name Name of the federation
      * @param federation_handle Handle of the federation
      * @param socket_server Socket server from RTIG
@@ -102,7 +83,6 @@ public:
                const std::string& mim_module,
                const RtiVersion rti_version,
                const int verboseLevel);
-#endif
 
     ~Federation();
 
@@ -157,6 +137,8 @@ public:
      * 
      * Also send Null messages from all others federates to initialize its LBTS, and
      * finally a RequestPause message if the Federation is already paused.
+     *
+     * @param peer_to_peer_port port the RTIA accepts the updates of the other RTIAs on, 0 if it does not
      */
     std::pair<FederateHandle, Responses> add(const std::string& federate_name,
                                              const std::string& federate_type,
@@ -164,7 +146,8 @@ public:
                                              const RtiVersion rti_version,
                                              SocketTCP* tcp_link,
                                              const uint32_t peer,
-                                             const uint32_t address);
+                                             const uint32_t address,
+                                             const uint32_t peer_to_peer_port = 0);
 
     /** Remove a federate.
      * 
@@ -206,6 +189,13 @@ public:
     /// includes Time Regulation already disabled.
     Responses removeRegulator(FederateHandle federate_handle);
 
+    /** Forward a NULL message request to the regulators holding back a federate.
+     *
+     * Only regulators whose last known time does not exceed the requested date
+     * are asked, the requesting federate itself excepted.
+     */
+    Responses requestNullMessages(FederateHandle federate_handle, FederationTime time);
+
     Responses setConstrained(FederateHandle federate_handle, bool constrained, FederationTime time);
 
     /// Update the current time of a regulator federate.
@@ -289,11 +279,20 @@ public:
      * @param[in] federate_handle federate handle of the subscriber
      * @param[in] object_handle subscripted object class handle 
      * @param[in] attributes subscripted vector of attributes 
+     * @param[in] multicast the RTIA of the subscriber joined the multicast group of the class
      */
     Responses subscribeObject(FederateHandle federate_handle,
                               ObjectClassHandle object_handle,
                               const std::vector<AttributeHandle>& attributes,
-                              const bool subscribe_or_unsubscribe);
+                              const bool subscribe_or_unsubscribe,
+                              const bool multicast = false);
+
+    /** Tell every RTIA which attributes of an object class the federate now
+     * subscribes to, whatever the region, so that the RTIAs of the
+     * publishers send it their updates without time stamp directly.
+     * Nothing is sent unless the socket server uses peer to peer.
+     */
+    Responses routeToPeers(FederateHandle subscriber, ObjectClassHandle object_class);
 
     void reserveObjectInstanceName(FederateHandle federate_handle, std::string object_name);
 
@@ -335,11 +334,13 @@ public:
                                     FederationTime time,
                                     const std::string& tag);
 
+    /// @param sequence the sequence number of the update, 0 if it has none (see NM_Reflect_Attribute_Values)
     Responses updateAttributeValues(FederateHandle federate_handle,
                                     ObjectHandle object_handle,
                                     const std::vector<AttributeHandle>& attributes,
                                     const std::vector<AttributeValue_t>& attribute_values,
-                                    const std::string& tag);
+                                    const std::string& tag,
+                                    uint32_t sequence = 0);
 
     // ----------------------------
     // -- Interaction Management --
@@ -351,7 +352,8 @@ public:
 
     Responses subscribeInteraction(FederateHandle federate_handle,
                                    InteractionClassHandle interaction_class_handle,
-                                   bool subscribe_or_unsubscribe);
+                                   bool subscribe_or_unsubscribe,
+                                   bool multicast = false);
 
     /// broadcastInteraction with time
     Responses broadcastInteraction(FederateHandle federate_handle,
@@ -487,6 +489,15 @@ private:
 
     void openFomModules(std::vector<std::string> modules, const bool is_mim = false);
 
+    /// The FOM part of the join answer, serialized in both wire formats.
+    struct SerializedFOM;
+
+    /// A join answer whose FOM part is a SerializedFOM.
+    class JoinAnswer;
+
+    /// The FOM part of the join answer, serialized once for all the federates joining.
+    std::shared_ptr<const SerializedFOM> cachedFOM();
+
     bool saveXmlData();
     bool restoreXmlData(std::string docFilename);
 
@@ -495,6 +506,9 @@ private:
 
     Responses setAutoProvide(const bool value);
 
+    /// The route of subscriber at object_class, object_class 0: the federate left.
+    std::unique_ptr<NM_Peer_Route> peerRoute(FederateHandle subscriber, ObjectClassHandle object_class);
+
     FederationHandle my_handle;
     std::string my_name;
 
@@ -503,10 +517,6 @@ private:
 
     bool my_auto_provide{false};
 
-#ifdef FEDERATION_USES_MULTICAST
-    SocketMC* MCLink;
-#endif
-
     /** This object is initialized when the Federation is created
      * 
      *  with the reference of the RTIG managed Socket Server. The reference of
@@ -515,6 +525,20 @@ private:
     std::unique_ptr<SecurityServer> my_server;
     std::unique_ptr<RootObject> my_root_object;
 
+    /** Built by cachedFOM(), dropped whenever FOM modules are merged into my_root_object.
+     * The join answers not sent yet keep the previous one alive.
+     */
+    std::shared_ptr<const SerializedFOM> my_fom_cache;
+
+    /** Content hash of the modules opened so far, in order: the key of
+     * my_root_object in the parsed FOM cache shared by all federations.
+     * my_fom_cacheable becomes false once the root object depends on
+     * something else (a .fed module, which may use the security server,
+     * or a module added by a joining federate).
+     */
+    std::array<uint64_t, 2> my_fom_key{};
+    bool my_fom_cacheable{true};
+
     /// The minimum NERx timestamp for this federation
     FederationTime my_min_NERx{};
 
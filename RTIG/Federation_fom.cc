@@ -25,13 +25,17 @@
 
 // #include "NM_Classes.hh"
 #include <algorithm>
+#include <array>
 #include <cerrno>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 // #include <ext/alloc_traits.h>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <list>
+#include <map>
 #include <memory>
 #include <set>
 #include <sys/stat.h>
@@ -59,6 +63,7 @@
 #include <libCERTI/XmlParser2000.hh>
 #include <libCERTI/XmlParser2010.hh>
 #include <libCERTI/fed.hh>
+#include <libHLA/MurmurHash3.h>
 
 #include <include/make_unique.hh>
 
@@ -281,6 +286,73 @@ void parseModuleInto(const std::string& filepath, const FileType type, RootObjec
     }
 }
 
+namespace {
+/// A root object as left by opening a sequence of FOM modules.
+struct ParsedFom {
+    NM_Join_Federation_Execution fom;
+    int freeObjectClassHandle;
+    int freeInteractionClassHandle;
+    int freeDimensionHandle;
+    int freeParameterHandle;
+    int freeSpaceHandle;
+};
+
+/// Most module sequences used by a RTIG are kept, one is about 10 KiB.
+constexpr size_t parsed_fom_cache_size = 64;
+
+/// Parsed FOMs of all the federations created by this RTIG, see Federation::my_fom_key.
+std::map<std::array<uint64_t, 2>, std::shared_ptr<const ParsedFom>> parsed_foms;
+
+std::array<uint64_t, 2>
+nextFomKey(const std::array<uint64_t, 2>& previous, const bool is_mim, const std::string& module_path)
+{
+    std::ifstream file(module_path, std::ios::binary);
+    const std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+    std::array<uint64_t, 2> content_hash;
+    libhla::hash::MurmurHash3_x64_128(content.data(), static_cast<int>(content.size()), 0, content_hash.data());
+
+    const uint64_t chain[5] = {previous[0], previous[1], content_hash[0], content_hash[1], is_mim};
+    std::array<uint64_t, 2> key;
+    libhla::hash::MurmurHash3_x64_128(chain, sizeof(chain), 0, key.data());
+    return key;
+}
+
+std::shared_ptr<const ParsedFom> findParsedFom(const std::array<uint64_t, 2>& key)
+{
+    auto it = parsed_foms.find(key);
+    return it == parsed_foms.end() ? nullptr : it->second;
+}
+
+void storeParsedFom(const std::array<uint64_t, 2>& key, RootObject& root_object)
+{
+    if (parsed_foms.size() >= parsed_fom_cache_size) {
+        parsed_foms.clear();
+    }
+
+    auto parsed = std::make_shared<ParsedFom>();
+    root_object.convertToSerializedFOM(parsed->fom);
+    parsed->freeObjectClassHandle = root_object.freeObjectClassHandle;
+    parsed->freeInteractionClassHandle = root_object.freeInteractionClassHandle;
+    parsed->freeDimensionHandle = root_object.freeDimensionHandle;
+    parsed->freeParameterHandle = root_object.freeParameterHandle;
+    parsed->freeSpaceHandle = root_object.freeSpaceHandle;
+
+    parsed_foms[key] = parsed;
+}
+
+void restoreParsedFom(const ParsedFom& parsed, RootObject& root_object)
+{
+    root_object.rebuildFromSerializedFOM(parsed.fom);
+    // so that modules added later get the same handles as without the cache
+    root_object.freeObjectClassHandle = parsed.freeObjectClassHandle;
+    root_object.freeInteractionClassHandle = parsed.freeInteractionClassHandle;
+    root_object.freeDimensionHandle = parsed.freeDimensionHandle;
+    root_object.freeParameterHandle = parsed.freeParameterHandle;
+    root_object.freeSpaceHandle = parsed.freeSpaceHandle;
+}
+}
+
 void Federation::openFomModules(std::vector<std::string> modules, const bool is_mim)
 {
 #ifdef OUTPUT_ROOT_OBJECTS
@@ -288,6 +360,11 @@ void Federation::openFomModules(std::vector<std::string> modules, const bool is_
     my_root_object->display();
 #endif
 
+    if (!modules.empty()) {
+        // even a partial merge changes the FOM sent to joining federates
+        my_fom_cache.reset();
+    }
+
     try {
         for (auto& module : modules) {
             Debug(D, pdDebug) << "Open module <" << module << ">" << std::endl;
@@ -298,31 +375,52 @@ void Federation::openFomModules(std::vector<std::string> modules, const bool is_
             Debug(D, pdDebug) << "  Check file type" << std::endl;
             auto file_type = checkFileType(module_path);
 
-            Debug(D, pdDebug) << "  Parse file" << std::endl;
-            auto temporary_root_object = RootObject{nullptr, true};
-            parseModuleInto(module_path, file_type, temporary_root_object);
+            my_fom_cacheable = my_fom_cacheable && my_federates.empty() && file_type == FileType::Xml;
+            std::array<uint64_t, 2> key{};
+            std::shared_ptr<const ParsedFom> parsed;
+            if (my_fom_cacheable) {
+                key = nextFomKey(my_fom_key, is_mim, module_path);
+                parsed = findParsedFom(key);
+            }
+
+            if (parsed) {
+                // Same modules as an already created federation: already checked, no parsing.
+                Debug(D, pdDebug) << "  Reuse parsed FOM" << std::endl;
+                my_root_object = make_unique<RootObject>(my_server.get());
+                restoreParsedFom(*parsed, *my_root_object);
+            }
+            else {
+                Debug(D, pdDebug) << "  Parse file" << std::endl;
+                auto temporary_root_object = RootObject{nullptr, true};
+                parseModuleInto(module_path, file_type, temporary_root_object);
 
 #ifdef OUTPUT_ROOT_OBJECTS
-            Debug(D, pdDebug) << "TEMPORARY ROOT OBJECT" << std::endl;
-            temporary_root_object.display();
+                Debug(D, pdDebug) << "TEMPORARY ROOT OBJECT" << std::endl;
+                temporary_root_object.display();
 #endif
 
-            Debug(D, pdDebug) << "  Check consistency" << std::endl;
-            if(is_mim) {
-                auto is_compliant = Mom::isAvailableInRootObjectAndCompliant(temporary_root_object);
-                if (!is_compliant) {
-                    throw ErrorReadingFED("4.5.5.e : Invalid MIM.");
+                Debug(D, pdDebug) << "  Check consistency" << std::endl;
+                if (is_mim) {
+                    auto is_compliant = Mom::isAvailableInRootObjectAndCompliant(temporary_root_object);
+                    if (!is_compliant) {
+                        throw ErrorReadingFED("4.5.5.e : Invalid MIM.");
+                    }
                 }
-            }
-            else {
-                auto is_valid = temporary_root_object.canBeAddedTo(*my_root_object);
-                if (!is_valid) {
-                    throw ErrorReadingFED("4.5.5.b : Invalid FOM module.");
+                else {
+                    auto is_valid = temporary_root_object.canBeAddedTo(*my_root_object);
+                    if (!is_valid) {
+                        throw ErrorReadingFED("4.5.5.b : Invalid FOM module.");
+                    }
                 }
-            }
 
-            Debug(D, pdDebug) << "  Add to current root object" << std::endl;
-            parseModuleInto(module_path, file_type, *my_root_object, true);
+                Debug(D, pdDebug) << "  Add to current root object" << std::endl;
+                parseModuleInto(module_path, file_type, *my_root_object, true);
+
+                if (my_fom_cacheable) {
+                    storeParsedFom(key, *my_root_object);
+                }
+            }
+            my_fom_key = key;
 
             Debug(D, pdDebug) << "  Update path to module" << std::endl;
             if(is_mim) {
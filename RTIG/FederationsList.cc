@@ -69,16 +69,6 @@ void FederationsList::setVerboseLevel(const int verboseLevel) noexcept
     my_verbose_level = verboseLevel;
 }
 
-#ifdef FEDERATION_USES_MULTICAST
-std::unique_ptr<NM_Create_Federation_Execution> FederationsList::createFederation(const std::string& name,
-                                                                                  const FederationHandle handle,
-                                                                                  SocketServer& socket_server,
-                                                                                  AuditFile& audit,
-                                                                                  const std::vector<std::string> fom_modules,
-                                                                                  const std::string& mim_module,
-                                                                                  const RtiVersion rti_version,
-                                                                                  SocketMC* multicastSocket)
-#else
 std::unique_ptr<NM_Create_Federation_Execution> FederationsList::createFederation(const std::string& name,
                                                                                   const FederationHandle handle,
                                                                                   SocketServer& socket_server,
@@ -86,7 +76,6 @@ std::unique_ptr<NM_Create_Federation_Execution> FederationsList::createFederatio
                                                                                   const std::vector<std::string> fom_modules,
                                                                                   const std::string& mim_module,
                                                                                   const RtiVersion rti_version)
-#endif
 {
     Debug(G, pdGendoc) << "enter FederationsList::createFederation" << std::endl;
     audit << ", Handle : " << handle;
@@ -107,11 +96,7 @@ std::unique_ptr<NM_Create_Federation_Execution> FederationsList::createFederatio
 
     try {
         auto federation
-#ifdef FEDERATION_USES_MULTICAST
-            = make_unique<Federation>(name, handle, socket_server, audit, fom_modules, mim_module, rti_version, multicastSocket, my_verbose_level);
-#else
             = make_unique<Federation>(name, handle, socket_server, audit, fom_modules, mim_module, rti_version, my_verbose_level);
-#endif
         Debug(D, pdDebug) << "new Federation created" << std::endl;
 
         // Federation's existence has already been checked above, no need to check insert's result
@@ -60,22 +60,7 @@ public:
 // -- Federation Management --
 // ---------------------------
 
-#ifdef FEDERATION_USES_MULTICAST
-    /** createFederation (with FEDERATION_USES_MULTICAST defined)
-     /   @p*aram name Federation name
-     @param handle Federation handle
-     @param mc_link
-     */
-    std::unique_ptr<NM_Create_Federation_Execution> createFederation(const std::string& name,
-                                                                     const FederationHandle handle,
-                                                                     SocketServer& socket_server,
-                                                                     AuditFile& audit,
-                                                                     const std::vector<std::string> fom_modules,
-                                                                     const std::string& mim_module,
-                                                                     const RtiVersion rti_version,
-                                                                     SocketMC* multicastSocket);
-#else
-    /** createFederation (with FEDERATION_USES_MULTICAST not defined)
+    /** createFederation
      @ p*aram name Federation name
      @param handle Federation handle
      @param FEDid execution id. of the federation (i.e. file name)
@@ -87,7 +72,6 @@ public:
                                                                      const std::vector<std::string> fom_modules,
                                                                      const std::string& mim_module,
                                                                      const RtiVersion rti_version);
-#endif
 
     /** Return the Handle of the Federation named "name" if it is found in the
      * FederationList, else throw FederationExecutionDoesNotExist.
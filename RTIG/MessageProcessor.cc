@@ -56,6 +56,7 @@ Responses MessageProcessor::processEvent(MessageEvent<NetworkMessage> request)
         BASIC_CASE(MESSAGE_NULL, NM_Message_Null);
         BASIC_CASE(RESIGN_FEDERATION_EXECUTION, NM_Resign_Federation_Execution);
         BASIC_CASE(MESSAGE_NULL_PRIME, NM_Message_Null_Prime);
+        BASIC_CASE(MESSAGE_NULL_REQUEST, NM_Message_Null_Request);
         BASIC_CASE(UPDATE_ATTRIBUTE_VALUES, NM_Update_Attribute_Values);
         BASIC_CASE(SEND_INTERACTION, NM_Send_Interaction);
         BASIC_CASE(CREATE_FEDERATION_EXECUTION, NM_Create_Federation_Execution);
@@ -140,30 +141,8 @@ Responses MessageProcessor::process(MessageEvent<NM_Create_Federation_Execution>
     my_auditServer << "Federation Name : " << federation;
     auto handle = FederationHandle(my_federationHandleGenerator.provide());
 
-#ifdef FEDERATION_USES_MULTICAST
-    // multicast base address
-    unsigned long base_adr_mc = inet_addr(ADRESSE_MULTICAST);
-
-    // creer la communication multicast
-    SocketMC* com_mc = new SocketMC();
-    if (!com_mc) {
-        Debug(D, pdExcept) << "Unable to allocate Multicast socket" << endl;
-        Debug(G, pdGendoc) << "exit  RTIG::processCreateFederation on exception RTIinternalError" << endl;
-        throw RTIinternalError("Unable to allocate Multicast socket");
-    }
-
-    com_mc->CreerSocketMC(base_adr_mc + h, MC_PORT);
-
-    // inserer la nouvelle federation dans la liste des federations
-    auto rep = my_federations->createFederation(
-        federation, handle, my_socketServer, my_auditServer, fom_modules, mim_designator, rti_version, com_mc);
-
-    // inserer descripteur fichier pour le prochain appel a un select
-    ClientSockets.push_front(com_mc);
-#else
     auto rep = my_federations.createFederation(
         federation, handle, my_socketServer, my_auditServer, fom_modules, mim_designator, rti_version);
-#endif
     my_auditServer << " created";
 
     responses = my_federations.searchFederation(FederationHandle(rep->getFederation())).enableMomIfAvailable();
@@ -206,11 +185,19 @@ Responses MessageProcessor::process(MessageEvent<NM_Join_Federation_Execution>&&
                                                           rti_version,
                                                           static_cast<SocketTCP*>(request.sockets().front()),
                                                           peer,
-                                                          address);
+                                                          address,
+                                                          request.message()->hasPeerPort() ? request.message()->getPeerPort() : 0);
     
     my_auditServer << "(" << federation_handle << ") with handle " << federate_handle << ". Socket "
                    << int(request.sockets().front()->returnSocket());
 
+    // an older RTIA does not send its wire format
+    if (request.message()->hasWireFormat() && NetworkMessage::localWireFormat() == NetworkMessage::WireFormat::COMPACT
+        && request.message()->getWireFormat() >= static_cast<uint32_t>(NetworkMessage::WireFormat::COMPACT)) {
+        Debug(D, pdInit) << "Messages to federate " << federate_handle << " use the compact encoding" << endl;
+        request.sockets().front()->setCompactEncoding(true);
+    }
+
     Debug(D, pdInit) << "Federate \"" << federate_name << "\" has joined Federation " << federation_handle
                      << " under handle " << federate_handle << endl;
 
@@ -497,6 +484,28 @@ Responses MessageProcessor::process(MessageEvent<NM_Message_Null_Prime>&& reques
     return {};
 }
 
+Responses MessageProcessor::process(MessageEvent<NM_Message_Null_Request>&& request)
+{
+    my_auditServer.setLevel(AuditLine::Level(0));
+
+    my_auditServer << "Date " << request.message()->getDate().getTime();
+
+    Debug(DNULL, pdDebug) << "Rcv NULL MSG REQUEST (Federate=" << request.message()->getFederate()
+                          << ", Time = " << request.message()->getDate().getTime() << ")" << endl;
+
+    // Catch all exceptions because RTIA does not expect an answer anyway.
+    try {
+        return my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+            .requestNullMessages(request.message()->getFederate(), request.message()->getDate());
+    }
+    catch (Exception& e) {
+        Debug(D, pdError) << "NULL message request of Federate " << request.message()->getFederate()
+                          << " dropped: " << e.name() << " - " << e.reason() << endl;
+    }
+
+    return {};
+}
+
 Responses MessageProcessor::process(MessageEvent<NM_Register_Federation_Synchronization_Point>&& request)
 {
     Responses responses;
@@ -724,7 +733,8 @@ Responses MessageProcessor::process(MessageEvent<NM_Subscribe_Object_Class>&& re
                     .subscribeObject(request.message()->getFederate(),
                                      request.message()->getObjectClass(),
                                      request.message()->getAttributes(),
-                                     true);
+                                     true,
+                                     request.message()->hasMulticast() && request.message()->getMulticast());
 
     Debug(D, pdRegister) << "Federate " << request.message()->getFederate() << " of Federation "
                          << request.message()->getFederation() << " subscribed to object class "
@@ -796,9 +806,11 @@ Responses MessageProcessor::process(MessageEvent<NM_Subscribe_Interaction_Class>
 
     my_auditServer << "Subscribe Interaction Class = " << request.message()->getInteractionClass();
 
-    responses
-        = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-              .subscribeInteraction(request.message()->getFederate(), request.message()->getInteractionClass(), true);
+    responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+                    .subscribeInteraction(request.message()->getFederate(),
+                                          request.message()->getInteractionClass(),
+                                          true,
+                                          request.message()->hasMulticast() && request.message()->getMulticast());
 
     Debug(D, pdRequest) << "Federate " << request.message()->getFederate() << " of Federation "
                         << request.message()->getFederation() << " subscribed to Interaction "
@@ -886,7 +898,8 @@ Responses MessageProcessor::process(MessageEvent<NM_Update_Attribute_Values>&& r
                                                request.message()->getObject(),
                                                request.message()->getAttributes(),
                                                request.message()->getValues(),
-                                               request.message()->getLabel());
+                                               request.message()->getLabel(),
+                                               request.message()->hasSequence() ? request.message()->getSequence() : 0);
     }
 
     // Building answer (Network Message)
@@ -1373,11 +1386,12 @@ Responses MessageProcessor::process(MessageEvent<NM_DDM_Subscribe_Attributes>&&
                       << request.message()->getRegion() << " to some attributes of class "
                       << request.message()->getObjectClass() << endl;
 
-    my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-        .subscribeAttributesWR(request.message()->getFederate(),
-                               request.message()->getObjectClass(),
-                               request.message()->getRegion(),
-                               request.message()->getAttributes());
+    auto& federation = my_federations.searchFederation(FederationHandle(request.message()->getFederation()));
+    federation.subscribeAttributesWR(request.message()->getFederate(),
+                                     request.message()->getObjectClass(),
+                                     request.message()->getRegion(),
+                                     request.message()->getAttributes());
+    responses = federation.routeToPeers(request.message()->getFederate(), request.message()->getObjectClass());
 
     auto rep = make_unique<NM_DDM_Subscribe_Attributes>();
     rep->setFederate(request.message()->getFederate());
@@ -1399,9 +1413,10 @@ Responses MessageProcessor::process(MessageEvent<NM_DDM_Unsubscribe_Attributes>&
                       << request.message()->getRegion() << " from object class " << request.message()->getObjectClass()
                       << endl;
 
-    my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-        .unsubscribeAttributesWR(
-            request.message()->getFederate(), request.message()->getObjectClass(), request.message()->getRegion());
+    auto& federation = my_federations.searchFederation(FederationHandle(request.message()->getFederation()));
+    federation.unsubscribeAttributesWR(
+        request.message()->getFederate(), request.message()->getObjectClass(), request.message()->getRegion());
+    responses = federation.routeToPeers(request.message()->getFederate(), request.message()->getObjectClass());
 
     auto rep = make_unique<NM_DDM_Unsubscribe_Attributes>();
     rep->setFederate(request.message()->getFederate());
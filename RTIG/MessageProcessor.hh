@@ -71,6 +71,7 @@ private:
     Responses process(MessageEvent<NM_Set_Time_Constrained>&& request);
     Responses process(MessageEvent<NM_Message_Null>&& request, bool anonymous = false);
     Responses process(MessageEvent<NM_Message_Null_Prime>&& request);
+    Responses process(MessageEvent<NM_Message_Null_Request>&& request);
     Responses process(MessageEvent<NM_Register_Federation_Synchronization_Point>&& request);
     Responses process(MessageEvent<NM_Synchronization_Point_Achieved>&& request);
     Responses process(MessageEvent<NM_Request_Federation_Save>&& request);
@@ -35,6 +35,9 @@
 #include <libCERTI/NetworkMessage.hh>
 #include <libCERTI/PrettyDebug.hh>
 #include <libCERTI/Socket.hh>
+#ifdef SOCKTCP_LOCAL_SOCKET
+#include <libCERTI/SocketTCPSHMRing.hh>
+#endif
 
 #ifdef _WIN32
 #include <signal.h>
@@ -56,6 +59,29 @@ static constexpr auto tcpPortEnvironmentVariable = "CERTI_TCP_PORT";
 
 static constexpr auto defaultUdpPort = PORT_UDP_RTIG;
 static constexpr auto udpPortEnvironmentVariable = "CERTI_UDP_PORT";
+
+/// Best effort messages larger than this go over TCP.
+static constexpr auto maxDatagramEnvironmentVariable = "CERTI_UDP_MAX_DATAGRAM";
+
+/// First multicast group, setting it makes the RTIG send to groups.
+static constexpr auto multicastAddressEnvironmentVariable = "CERTI_MULTICAST_ADDRESS";
+static constexpr auto multicastPortEnvironmentVariable = "CERTI_MULTICAST_PORT";
+/// Interface the groups are sent through, the routing table decides by default.
+static constexpr auto multicastInterfaceEnvironmentVariable = "CERTI_MULTICAST_INTERFACE";
+
+/// A message goes to a group when it reaches at least this many subscribers.
+static constexpr unsigned int defaultMulticastThreshold = 2;
+static constexpr auto multicastThresholdEnvironmentVariable = "CERTI_MULTICAST_THRESHOLD";
+
+/// "on": the RTIAs send the updates without time stamp to each other, the RTIG only routes them.
+static constexpr auto peerToPeerEnvironmentVariable = "CERTI_PEER_TO_PEER";
+
+/// If set to "off", the RTIAs of the host connect over TCP too.
+static constexpr auto localSocketEnvironmentVariable = "CERTI_LOCAL_SOCKET";
+
+/// A local RTIA which leaves its shared memory ring full that long (ms) is dropped, 0 waits forever.
+static constexpr int defaultShmSendTimeout = 5000;
+static constexpr auto shmSendTimeoutEnvironmentVariable = "CERTI_SHM_SEND_TIMEOUT";
 }
 
 namespace certi {
@@ -84,6 +110,7 @@ RTIG::RTIG()
 RTIG::~RTIG()
 {
     my_tcpSocketServer.close();
+    my_localSocketServer.close();
     my_udpSocketServer.close();
 
     std::cout << std::endl << "Stopping RTIG" << std::endl;
@@ -108,9 +135,20 @@ int Epollfd;
 my_socketServer.createEpollFd();
 int fdtcp = my_tcpSocketServer.returnSocket();
 my_socketServer.addElementEpoll(fdtcp);
+if (my_localSocketServer.isLocal()) {
+    my_socketServer.addElementEpoll(my_localSocketServer.returnSocket());
+}
 Epollfd = my_socketServer.getEpollDescriptor();
 #endif
 
+#ifdef CERTI_RTIG_USE_IO_URING
+    std::vector<int> ready;
+    my_socketServer.addElementIoUring(my_tcpSocketServer);
+    if (my_localSocketServer.isLocal()) {
+        my_socketServer.addElementIoUring(my_localSocketServer);
+    }
+#endif
+
     while (!terminate) {
 #if _WIN32
         result = 0;
@@ -179,7 +217,7 @@ Epollfd = my_socketServer.getEpollDescriptor();
         // Or on the server socket ?
         if (FD_ISSET(my_tcpSocketServer.returnSocket(), &fd)) {
             Debug(D, pdCom) << "New client" << std::endl;
-            openConnection();
+            openConnection(my_tcpSocketServer);
         }
 #else
 
@@ -189,6 +227,10 @@ Epollfd = my_socketServer.getEpollDescriptor();
 
         int fd_max = my_socketServer.addToFDSet(&fd);
         fd_max = std::max(my_tcpSocketServer.returnSocket(), fd_max);
+        if (my_localSocketServer.isLocal()) {
+            FD_SET(my_localSocketServer.returnSocket(), &fd);
+            fd_max = std::max(my_localSocketServer.returnSocket(), fd_max);
+        }
 
         // Wait for an incoming message.
         result = select(fd_max + 1, &fd, nullptr, nullptr, nullptr);
@@ -226,7 +268,11 @@ Epollfd = my_socketServer.getEpollDescriptor();
         // Or on the server socket ?
         if (FD_ISSET(my_tcpSocketServer.returnSocket(), &fd)) {
             Debug(D, pdCom) << "New client" << std::endl;
-            openConnection();
+            openConnection(my_tcpSocketServer);
+        }
+        if (my_localSocketServer.isLocal() && FD_ISSET(my_localSocketServer.returnSocket(), &fd)) {
+            Debug(D, pdCom) << "New local client" << std::endl;
+            openConnection(my_localSocketServer);
         }
 #endif
 #ifdef CERTI_RTIG_USE_POLL
@@ -236,6 +282,12 @@ Epollfd = my_socketServer.getEpollDescriptor();
         tcp_server.fd = my_tcpSocketServer.returnSocket();
         tcp_server.events = POLLIN;
         my_socketServer.addElementPollList(tcp_server);
+        if (my_localSocketServer.isLocal()) {
+            struct pollfd local_server;
+            local_server.fd = my_localSocketServer.returnSocket();
+            local_server.events = POLLIN;
+            my_socketServer.addElementPollList(local_server);
+        }
         SocketVector = my_socketServer.getSocketVector();
         // blocking call (SHOULD IT BE THIS WAY ??)
         result = ::poll(&SocketVector[0], SocketVector.size(), -1);
@@ -273,7 +325,11 @@ Epollfd = my_socketServer.getEpollDescriptor();
 				}
 				if (my_tcpSocketServer.returnSocket() == it->fd) {
 					Debug(D, pdCom) << "New client" << std::endl;
-					openConnection();
+					openConnection(my_tcpSocketServer);
+				}
+				if (my_localSocketServer.isLocal() && my_localSocketServer.returnSocket() == it->fd) {
+					Debug(D, pdCom) << "New local client" << std::endl;
+					openConnection(my_localSocketServer);
 				}
 			}
 		}
@@ -316,12 +372,57 @@ Epollfd = my_socketServer.getEpollDescriptor();
 					}
 					if (my_tcpSocketServer.returnSocket() == pevents[i].data.fd) {
 						Debug(D, pdCom) << "New client" << std::endl;
-						openConnection();
+						openConnection(my_tcpSocketServer);
+					}
+					if (my_localSocketServer.isLocal() && my_localSocketServer.returnSocket() == pevents[i].data.fd) {
+						Debug(D, pdCom) << "New local client" << std::endl;
+						openConnection(my_localSocketServer);
 					}
 			}		
 		}
 
 #endif
+#ifdef CERTI_RTIG_USE_IO_URING
+        // also submits the polls armed again since the last wait
+        result = my_socketServer.waitIoUring(ready);
+        if ((result == -1) && (errno == EINTR)) {
+            break;
+        }
+        for (int ready_fd : ready) {
+            link = my_socketServer.getSocketFromFileDescriptor(ready_fd);
+            if (link) {
+                Debug(D, pdCom) << "Incoming message on socket " << link->returnSocket() << std::endl;
+
+                try {
+                    do {
+                        link = processIncomingMessage(link);
+                        if (!link) {
+                            break;
+                        }
+                    } while (link->isDataReady());
+                }
+                catch (NetworkError& e) {
+                    if (!e.reason().empty()) {
+                        Debug(D, pdExcept) << "Catching Network Error, reason: " << e.reason() << std::endl;
+                    }
+                    else {
+                        Debug(D, pdExcept) << "Catching Network Error, unknown reason" << std::endl;
+                    }
+                    std::cout << "RTIG dropping client connection " << link->returnSocket() << '.' << std::endl;
+                    closeConnection(link, true);
+                    link = nullptr;
+                }
+            }
+            if (my_tcpSocketServer.returnSocket() == ready_fd) {
+                Debug(D, pdCom) << "New client" << std::endl;
+                openConnection(my_tcpSocketServer);
+            }
+            if (my_localSocketServer.isLocal() && my_localSocketServer.returnSocket() == ready_fd) {
+                Debug(D, pdCom) << "New local client" << std::endl;
+                openConnection(my_localSocketServer);
+            }
+        }
+#endif
 
 #endif // #if _WIN32
     }
@@ -400,6 +501,63 @@ void RTIG::createSocketServers()
         my_udpSocketServer.createServer(my_udpPort, my_listeningIPAddress);
         my_tcpSocketServer.createServer(my_tcpPort, my_listeningIPAddress);
     }
+
+#ifdef SOCKTCP_LOCAL_SOCKET
+    // the RTIAs of this host connect there rather than through the loopback
+    auto local_socket = getenv(localSocketEnvironmentVariable);
+    if (!local_socket || std::string(local_socket) != "off") {
+        try {
+            my_localSocketServer.createLocalServer(localRTIGName(my_tcpPort));
+            Debug(D, pdInit) << "Local RTIAs accepted on " << localRTIGName(my_tcpPort) << std::endl;
+        }
+        catch (NetworkError& e) {
+            // the RTIAs of this host use TCP then
+            Debug(D, pdError) << "No local socket: " << e.reason() << std::endl;
+        }
+    }
+#endif
+
+    if (auto max_datagram = getenv(maxDatagramEnvironmentVariable)) {
+        my_udpSocketServer.setMaxDatagramSize(strtoul(max_datagram, nullptr, 10));
+    }
+
+    if (auto multicast_address = getenv(multicastAddressEnvironmentVariable)) {
+        in_addr_t base;
+        Socket::host2addr(multicast_address, base);
+        if (!IN_MULTICAST(ntohl(base))) {
+            throw NetworkError(std::string(multicast_address) + " is not a multicast address");
+        }
+        if (!SocketMC::hasGroup(base, 0)) {
+            throw NetworkError(std::string(multicast_address) + " leaves no room for the groups in 224.0.0.0/4");
+        }
+
+        unsigned int port = SocketMC::defaultPort;
+        if (auto multicast_port = getenv(multicastPortEnvironmentVariable)) {
+            port = strtoul(multicast_port, nullptr, 10);
+        }
+
+        unsigned int threshold = defaultMulticastThreshold;
+        if (auto multicast_threshold = getenv(multicastThresholdEnvironmentVariable)) {
+            threshold = std::max(1ul, strtoul(multicast_threshold, nullptr, 10));
+        }
+
+        if (auto multicast_interface = getenv(multicastInterfaceEnvironmentVariable)) {
+            in_addr_t interface;
+            Socket::host2addr(multicast_interface, interface);
+            SocketMC::setSendInterface(my_udpSocketServer, interface);
+        }
+
+        my_socketServer.enableMulticast(base, port, threshold);
+        Debug(D, pdInit) << "Heavily subscribed classes are sent to the groups from " << Socket::addr2string(base)
+                         << ":" << port << ", up to class handle " << SocketMC::lastGroupHandle(base) << std::endl;
+    }
+
+    if (auto peer_to_peer = getenv(peerToPeerEnvironmentVariable)) {
+        if (std::string(peer_to_peer) == "on") {
+            my_socketServer.enablePeerToPeer();
+            Debug(D, pdInit) << "The RTIAs send the updates without time stamp to each other" << std::endl;
+        }
+    }
 }
 
 Socket* RTIG::processIncomingMessage(Socket* link)
@@ -438,10 +596,17 @@ Socket* RTIG::processIncomingMessage(Socket* link)
             closeConnection(link, false);
             link = nullptr;
         }
+        else if (messageType == NetworkMessage::Type::SHM_RINGS) {
+            openRings(link, static_cast<NM_Shm_Rings*>(msg.message()));
+        }
         else {
             auto responses = my_processor.processEvent(std::move(msg));
 
             Debug(D, pdDebug) << responses.size() << " responses" << std::endl;
+#ifdef CERTI_RTIG_USE_IO_URING
+            // the answers to the TCP links are written all at once, after the loop
+            try {
+#endif
             for (auto& response : responses) {
                 Debug(D, pdDebug) << "Send back " << response.message()->getMessageName() << " to " << response.sockets().size() << " federates" << std::endl;
                 for (const auto& socket: response.sockets()) {
@@ -452,8 +617,21 @@ Socket* RTIG::processIncomingMessage(Socket* link)
                         Debug(D, pdDebug) << "to nullptr" << std::endl;
                     }
                 }
+#ifdef CERTI_RTIG_USE_IO_URING
+                my_socketServer.queueSend(response.message(), response.sockets());
+#else
                 response.message()->send(response.sockets(), my_NM_msgBufSend); // send answer to RTIA
+#endif
+            }
+#ifdef CERTI_RTIG_USE_IO_URING
+            }
+            catch (...) {
+                // the queued messages reference the responses, the lost links are closed later
+                my_socketServer.flushSends();
+                throw;
             }
+            link = flushSends(link);
+#endif
         }
 
         my_auditServer.endLine(AuditLine::Status(Exception::Type::NO_EXCEPTION), " - OK");
@@ -464,6 +642,7 @@ Socket* RTIG::processIncomingMessage(Socket* link)
         the_timings[messageType].push_back(end - start);
 #endif
 
+        flushBestEffort(link);
         Debug(G, pdGendoc) << "exit  RTIG::processIncomingMessage" << std::endl;
         return link;
     }
@@ -472,6 +651,7 @@ Socket* RTIG::processIncomingMessage(Socket* link)
     catch (NetworkError& e) {
         my_auditServer.setLevel(AuditLine::Level(10));
         my_auditServer.endLine(AuditLine::Status(e.type()), e.reason() + " - NetworkError");
+        my_socketServer.flushBestEffort();
         throw;
     }
 
@@ -501,15 +681,23 @@ Socket* RTIG::processIncomingMessage(Socket* link)
         the_timings[messageType].push_back(end - start);
 #endif
 
+        flushBestEffort(link);
         Debug(G, pdGendoc) << "exit  RTIG::processIncomingMessage" << std::endl;
         return link;
     }
 }
 
-void RTIG::openConnection()
+void RTIG::flushBestEffort(Socket* link)
+{
+    if (!link || !link->isDataReady()) {
+        my_socketServer.flushBestEffort();
+    }
+}
+
+void RTIG::openConnection(SocketTCP& server)
 {
     try {
-        my_socketServer.open();
+        my_socketServer.open(&server);
         Debug(D, pdInit) << "Accepting new connection" << std::endl;
     }
     catch (RTIinternalError& e) {
@@ -517,6 +705,41 @@ void RTIG::openConnection()
     }
 }
 
+void RTIG::openRings(Socket* link, NM_Shm_Rings* request)
+{
+    NM_Shm_Rings answer;
+
+#ifdef SOCKTCP_LOCAL_SOCKET
+    auto local_link = dynamic_cast<SocketTCPSHMRing*>(link);
+    if (local_link) {
+        try {
+            local_link->attach(request->getName());
+            answer.setName(request->getName());
+        }
+        catch (NetworkError& e) {
+            Debug(D, pdError) << e.reason() << ", keeping the socket" << std::endl;
+        }
+    }
+#else
+    (void) request;
+#endif
+
+    // still on the socket, the RTIA waits for it to switch
+    answer.send(link, my_NM_msgBufSend);
+
+#ifdef SOCKTCP_LOCAL_SOCKET
+    if (!answer.getName().empty()) {
+        int timeout = defaultShmSendTimeout;
+        if (auto shm_send_timeout = getenv(shmSendTimeoutEnvironmentVariable)) {
+            timeout = atoi(shm_send_timeout);
+        }
+        local_link->setSendTimeout(timeout);
+        local_link->activate();
+        Debug(D, pdInit) << "Link " << link->returnSocket() << " goes through shared memory" << std::endl;
+    }
+#endif
+}
+
 void RTIG::closeConnection(Socket* link, bool emergency)
 {
     FederationHandle federation(0);
@@ -532,15 +755,42 @@ void RTIG::closeConnection(Socket* link, bool emergency)
 
     if (emergency) {
         Debug(D, pdExcept) << "Killing Federate(" << federation << ", " << federate << ")..." << std::endl;
+#ifdef CERTI_RTIG_USE_IO_URING
+        // the links lost meanwhile are closed by the next flushSends(link)
+        auto responses = my_federations.killFederate(federation, federate);
+        for (auto& response : responses) {
+            my_socketServer.queueSend(response.message(), response.sockets());
+        }
+        my_socketServer.flushSends();
+#else
         for (auto& response : my_federations.killFederate(federation, federate)) {
             response.message()->send(response.sockets(), my_NM_msgBufSend);
         }
+#endif
         Debug(D, pdExcept) << "Federate(" << federation << ", " << federate << ") killed" << std::endl;
     }
 
     Debug(G, pdGendoc) << "exit  RTIG::closeConnection" << std::endl;
 }
 
+#ifdef CERTI_RTIG_USE_IO_URING
+Socket* RTIG::flushSends(Socket* link)
+{
+    my_socketServer.flushSends();
+
+    // a link which missed a part of a frame is of no use any more; killing its
+    // federate may lose more links, they are closed in turn
+    while (Socket* lost = my_socketServer.popLostLink()) {
+        std::cout << "RTIG dropping client connection " << lost->returnSocket() << '.' << std::endl;
+        if (lost == link) {
+            link = nullptr;
+        }
+        closeConnection(lost, true);
+    }
+    return link;
+}
+#endif
+
 int RTIG::inferTcpPort()
 {
     auto tcp_port_s = getenv(tcpPortEnvironmentVariable);
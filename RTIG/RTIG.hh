@@ -85,12 +85,24 @@ private:
          * But if an exception occurs while processing a message, the exception is
          * caught by this module. Then a message, similar to the received one is sent
          * on the link. This message only holds the exception.
+         * The best effort messages are queued and sent once no more message
+         * is buffered on the link.
          * 
          * @return the socket, because it may have been closed & deleted in the meantime
          */
     Socket* processIncomingMessage(Socket*);
 
-    void openConnection();
+    /// Send the queued best effort messages unless more messages wait on link.
+    void flushBestEffort(Socket* link);
+
+    /// Accept a new RTIA on server, the TCP server socket or the local one.
+    void openConnection(SocketTCP& server);
+
+    /** Answer the NM_Shm_Rings of an RTIA of this host: the link goes
+     * through the shared memory it created if it can be mapped, through the
+     * socket otherwise.
+     */
+    void openRings(Socket* link, NM_Shm_Rings* request);
 
     /** closeConnection
          * 
@@ -99,6 +111,14 @@ private:
          */
     void closeConnection(Socket*, bool emergency);
 
+#ifdef CERTI_RTIG_USE_IO_URING
+    /** Write the answers queued by SocketServer::queueSend, and close in
+     * emergency the links which could not be written to.
+     * @return link, or nullptr if it was one of them
+     */
+    Socket* flushSends(Socket* link);
+#endif
+
 private:
     static int inferTcpPort();
     static int inferUdpPort();
@@ -109,6 +129,8 @@ private:
     in_addr_t my_listeningIPAddress;
     HandleManager<Handle> my_federationHandles;
     SocketTCP my_tcpSocketServer;
+    /// RTIAs of this host, see SocketTCP::createLocalServer
+    SocketTCP my_localSocketServer;
     SocketUDP my_udpSocketServer;
     SocketServer my_socketServer;
     AuditFile my_auditServer;
@@ -30,6 +30,18 @@
 /* Define to 1 if you have the <sys/select.h> header file. */
 #cmakedefine HAVE_SYS_SELECT_H 1
 
+/* Define to 1 if you have the <sys/epoll.h> header file. */
+#cmakedefine HAVE_SYS_EPOLL_H 1
+
+/* Define to 1 if you have the <linux/io_uring.h> header file. */
+#cmakedefine HAVE_LINUX_IO_URING_H 1
+
+/* Define to 1 if you have the `sendmmsg' function. */
+#cmakedefine HAVE_SENDMMSG 1
+
+/* Define to 1 if you have the `recvmmsg' function. */
+#cmakedefine HAVE_RECVMMSG 1
+
 /* Define to 1 if you have the <sys/socket.h> header file. */
 #cmakedefine HAVE_SYS_SOCKET_H 1
 
@@ -31,6 +31,11 @@ using std::endl;
 
 static PrettyDebug D("MESSAGE", __FILE__);
 
+/* presence bits of the compact encoding */
+static constexpr uint8_t datedFlag = 0x01;
+static constexpr uint8_t labelledFlag = 0x02;
+static constexpr uint8_t taggedFlag = 0x04;
+
 namespace certi {
 
 BasicMessage::BasicMessage() : _isDated(false), _isTagged(false), _isLabelled(false)
@@ -87,22 +92,51 @@ void BasicMessage::serialize(MessageBuffer& msgBuffer)
 	 * The subclass may chose in the constructor the variable part.
 	 * isDated may be chosen on Message instance basis
 	 * (same message may Dated or Not Dated)
+	 * The compact encoding packs the three presence flags in one byte.
 	 */
-    msgBuffer.write_bool(_isDated);
+    if (msgBuffer.isCompact()) {
+        msgBuffer.write_uint8((_isDated ? datedFlag : 0) | (_isLabelled ? labelledFlag : 0)
+                              | (_isTagged ? taggedFlag : 0));
+    }
+    else {
+        msgBuffer.write_bool(_isDated);
+    }
     if (_isDated) {
         msgBuffer.write_double(date.getTime());
         Debug(D, pdDebug) << "Sent Message date: " << date.getTime() << std::endl;
     }
-    msgBuffer.write_bool(_isLabelled);
+    if (!msgBuffer.isCompact()) {
+        msgBuffer.write_bool(_isLabelled);
+    }
     if (_isLabelled) {
         msgBuffer.write_string(label);
     }
-    msgBuffer.write_bool(_isTagged);
+    if (!msgBuffer.isCompact()) {
+        msgBuffer.write_bool(_isTagged);
+    }
     if (_isTagged) {
         msgBuffer.write_string(tag);
     }
 } /* end of serialize */
 
+uint32_t BasicMessage::serializedSize() const
+{
+    /* same fields as serialize() (fixed size encoding) */
+    uint32_t size = 1;
+    if (_isDated) {
+        size += 8;
+    }
+    size += 1;
+    if (_isLabelled) {
+        size += 4 + label.size();
+    }
+    size += 1;
+    if (_isTagged) {
+        size += 4 + tag.size();
+    }
+    return size;
+} /* end of serializedSize */
+
 void BasicMessage::deserialize(MessageBuffer& msgBuffer)
 {
     /* We serialize the common Basic message part
@@ -116,16 +150,23 @@ void BasicMessage::deserialize(MessageBuffer& msgBuffer)
 	 * isDated may be chosen on Message instance basis
 	 * (same message may Dated or Not Dated)
 	 */
-    _isDated = msgBuffer.read_bool();
+    uint8_t flags = 0;
+    if (msgBuffer.isCompact()) {
+        flags = msgBuffer.read_uint8();
+        _isDated = flags & datedFlag;
+    }
+    else {
+        _isDated = msgBuffer.read_bool();
+    }
     if (_isDated) {
         date = msgBuffer.read_double();
         Debug(D, pdDebug) << "Received Message date: " << date.getTime() << std::endl;
     }
-    _isLabelled = msgBuffer.read_bool();
+    _isLabelled = msgBuffer.isCompact() ? (flags & labelledFlag) != 0 : msgBuffer.read_bool();
     if (_isLabelled) {
         setLabel(msgBuffer.read_string());
     }
-    _isTagged = msgBuffer.read_bool();
+    _isTagged = msgBuffer.isCompact() ? (flags & taggedFlag) != 0 : msgBuffer.read_bool();
     if (_isTagged) {
         setTag(msgBuffer.read_string());
     }
@@ -24,6 +24,7 @@
 #ifndef LIBCERTI_BASIC_MESSAGE
 #define LIBCERTI_BASIC_MESSAGE
 
+#include <libHLA/BlockPool.hh>
 #include <libHLA/MessageBuffer.hh>
 using libhla::MessageBuffer;
 #include "BaseRegion.hh"
@@ -118,6 +119,19 @@ public:
 
     virtual std::ostream& show(std::ostream& out);
 
+    /**
+	 * Messages are recycled through per size class free lists:
+	 * every received message is allocated and deleted once.
+	 */
+    static void* operator new(size_t size)
+    {
+        return libhla::BlockPool::allocate(size);
+    }
+    static void operator delete(void* block, size_t size)
+    {
+        libhla::BlockPool::release(block, size);
+    }
+
 protected:
     BasicMessage();
     virtual ~BasicMessage();
@@ -134,6 +148,12 @@ protected:
 	 */
     virtual void deserialize(MessageBuffer& msgBuffer);
 
+    /**
+	 * Number of bytes serialize() will write with the fixed size
+	 * encoding, so that the buffer may be sized once before serializing.
+	 */
+    virtual uint32_t serializedSize() const;
+
     /**
 	 * Serialize the message into a buffer
 	 * @param[in] msgBuffer the serialization buffer
@@ -150,7 +150,18 @@ Responses Interaction::broadcastInteractionMessage(InteractionBroadcastList* ibL
     // 3. Add Interaction subscribers to the list.
     addFederatesIfOverlap(*ibList, region);
 
-    // 4. Send pending messages.
+    // 4. Send pending messages, a timestamped interaction must not
+    // overtake the reliable messages which advance time.
+    if (transport == BEST_EFFORT && (!ibList->getMessage().isDated() || order == RECEIVE)) {
+        ibList->setTransport(BEST_EFFORT);
+    }
+
+    // the group only carries the interactions matching every subscription of the class
+    SocketUDP* group = nullptr;
+    if (transport == BEST_EFFORT && !region && server) {
+        group = server->getMulticastLink(SocketMC::Group::InteractionClass, handle);
+    }
+    ibList->setMulticastGroup(group, my_multicast_members, server ? server->getMulticastThreshold() : 0);
     Debug(D, pdDebug) << "Calling SendPendingMessage..." << std::endl;
     auto ret = ibList->preparePendingMessage(*server);
 
@@ -320,6 +331,22 @@ void Interaction::killFederate(FederateHandle the_federate) noexcept
     }
     catch (SecurityError& e) {
     }
+    my_multicast_members.erase(the_federate);
+}
+
+void Interaction::setMulticastMember(FederateHandle federate, bool member)
+{
+    if (member) {
+        my_multicast_members.insert(federate);
+    }
+    else {
+        my_multicast_members.erase(federate);
+    }
+}
+
+bool Interaction::isMulticastMember(FederateHandle federate) const
+{
+    return my_multicast_members.count(federate) != 0;
 }
 
 // ----------------------------------------------------------------------------
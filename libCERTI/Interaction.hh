@@ -166,6 +166,10 @@ public:
 
     void killFederate(FederateHandle theFederate) noexcept;
 
+    /// Whether the RTIA of federate receives the interactions sent to the multicast group of this class.
+    void setMulticastMember(FederateHandle federate, bool member);
+    bool isMulticastMember(FederateHandle federate) const;
+
     // -- Transport and Ordering --
     void changeTransportationType(TransportType new_type, FederateHandle the_handle);
 
@@ -248,6 +252,9 @@ private:
 
     typedef std::set<FederateHandle> PublishersList;
     PublishersList publishers;
+
+    /// Subscribers which joined the multicast group of this class.
+    std::set<FederateHandle> my_multicast_members;
 };
 
 } // namespace
@@ -62,7 +62,7 @@ Responses InteractionBroadcastList::preparePendingMessage(SecurityServer& server
 {
     Debug(G, pdGendoc) << "enter InteractionBroadcastList::preparePendingMessage" << std::endl;
 
-    Responses ret;
+    Responses ret = prepareMulticastMessage();
 
     std::vector<Socket*> sockets;
     for (auto& pair : my_lines) {
@@ -71,11 +71,7 @@ Responses InteractionBroadcastList::preparePendingMessage(SecurityServer& server
             Debug(D, pdProtocol) << "Broadcasting message to Federate " << pair.first << std::endl;
 
             try {
-#ifdef HLA_USES_UDP
-                sockets.push_back(server.getSocketLink(pair.first, BEST_EFFORT));
-#else
-                sockets.push_back(server.getSocketLink(pair.first));
-#endif
+                sockets.push_back(server.getSocketLink(pair.first, my_transport));
             }
             catch (Exception& e) {
                 Debug(D, pdExcept) << "Reference to a killed Federate while broadcasting." << std::endl;
@@ -101,4 +97,64 @@ NM_Receive_Interaction& InteractionBroadcastList::getMessage()
     return my_message;
 }
 
+void InteractionBroadcastList::setTransport(TransportType transport)
+{
+    my_transport = transport;
+}
+
+void InteractionBroadcastList::setMulticastGroup(SocketUDP* group,
+                                                 const std::set<FederateHandle>& members,
+                                                 unsigned int threshold)
+{
+    my_multicast_link = group;
+    my_multicast_members = &members;
+    my_multicast_threshold = threshold;
+}
+
+Responses InteractionBroadcastList::prepareMulticastMessage()
+{
+    Responses ret;
+
+    if (!my_multicast_link || my_transport != BEST_EFFORT) {
+        return ret;
+    }
+
+    std::vector<FederateHandle> members;
+    for (const auto& pair : my_lines) {
+        if (pair.first == my_message.getFederate()) {
+            continue;
+        }
+        if (pair.second == State::Sent) {
+            // reached through a subclass, it would get the interaction twice from the group
+            return ret;
+        }
+        if (pair.second == State::Waiting && my_multicast_members->count(pair.first)) {
+            members.push_back(pair.first);
+        }
+    }
+
+    if (members.empty() || members.size() < my_multicast_threshold) {
+        return ret;
+    }
+
+    auto groupMessage = make_unique<NM_Receive_Interaction>(my_message);
+    groupMessage->setMulticast(true);
+    // the groups get the fixed size encoding, whose size this is
+    if (groupMessage->serializedSize() + MessageBuffer::reservedBytes > my_multicast_link->getMaxDatagramSize()) {
+        return ret;
+    }
+
+    Debug(D, pdProtocol) << "Broadcasting interaction to the group of class " << my_message.getInteractionClass()
+                         << " for " << members.size() << " federates" << std::endl;
+
+    for (auto federate : members) {
+        my_lines[federate] = State::Sent;
+    }
+
+    std::vector<Socket*> sockets{my_multicast_link};
+    ret.emplace_back(sockets, std::move(groupMessage));
+
+    return ret;
+}
+
 } // namespace certi
@@ -28,6 +28,7 @@
 #include "SecurityServer.hh"
 #include <include/certi.hh>
 
+#include <set>
 #include <unordered_map>
 
 namespace certi {
@@ -44,12 +45,32 @@ public:
 
     NM_Receive_Interaction& getMessage();
 
+    /// Transport used for the message, BEST_EFFORT when it may be lost or reordered.
+    void setTransport(TransportType transport);
+
+    /** Send a best effort interaction once to the multicast group of the
+     * class instead of once to each member of the group waiting for it,
+     * when there are at least threshold of them.
+     * @param group link to the group of the class, NULL to send to each federate
+     * @param members federates which joined the group
+     */
+    void setMulticastGroup(SocketUDP* group, const std::set<FederateHandle>& members, unsigned int threshold);
+
 private:
+    /// Send the message to the multicast group and mark the members reached as Sent, if worth it.
+    Responses prepareMulticastMessage();
+
     enum class State { Sent, Waiting, NotSub };
 
     NM_Receive_Interaction my_message;
 
     std::unordered_map<FederateHandle, State> my_lines;
+
+    TransportType my_transport{RELIABLE};
+
+    SocketUDP* my_multicast_link{nullptr};
+    const std::set<FederateHandle>* my_multicast_members{nullptr};
+    unsigned int my_multicast_threshold{0};
 };
 }
 
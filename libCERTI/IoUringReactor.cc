@@ -0,0 +1,831 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#include "IoUringReactor.hh"
+#include "Exception.hh"
+#include "PrettyDebug.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <endian.h>
+#include <limits.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace certi {
+
+static PrettyDebug D("IOURING", "(IoUringReactor) ");
+
+constexpr unsigned IoUringReactor::defaultEntries;
+
+namespace {
+/// user_data of the send requests, with the index of the link in my_sends
+constexpr uint64_t send_tag = 1ull << 63;
+/// user_data of the poll removals and cancellations, whose completion is ignored
+constexpr uint64_t remove_tag = 1ull << 62;
+/// the accept requests, whose late completions bring descriptors to close
+constexpr uint64_t accept_tag = 1ull << 61;
+/// the watch requests have the generation of the watch in bits 32-60
+constexpr uint32_t generation_mask = (1u << 29) - 1;
+
+uint64_t requestTag(int fd, uint32_t generation, bool accept)
+{
+    return (accept ? accept_tag : 0) | (static_cast<uint64_t>(generation) << 32) | static_cast<uint32_t>(fd);
+}
+
+/// Buffers provided for the multishot receptions (a power of 2), and their size.
+constexpr unsigned received_buffers = 128;
+constexpr unsigned received_buffer_size = 16 * 1024;
+constexpr uint16_t buffer_group = 0;
+
+/// Buffer registered for the sends, and the largest frames of a link copied into it.
+constexpr size_t send_arena_size = 256 * 1024;
+constexpr size_t fixed_send_max = 64 * 1024;
+
+/// The parts of the frames not written yet.
+std::vector<libhla::MessageBuffer::Segment> remainder(const std::vector<struct iovec>& iov, size_t written)
+{
+    std::vector<libhla::MessageBuffer::Segment> segments;
+    for (const auto& part : iov) {
+        if (written >= part.iov_len) {
+            written -= part.iov_len;
+            continue;
+        }
+        segments.push_back({static_cast<const uint8_t*>(part.iov_base) + written,
+                            static_cast<uint32_t>(part.iov_len - written)});
+        written = 0;
+    }
+    return segments;
+}
+}
+
+/// The queues shared with the kernel.
+struct IoUringReactor::Ring {
+    static std::unique_ptr<Ring> create(unsigned entries);
+    ~Ring();
+
+    /// Provide the buffers of the multishot receptions, if the kernel has them.
+    bool setupBuffers();
+    void setupSendArena();
+
+    /// Give a buffer (back) to the kernel.
+    void provide(uint16_t buffer);
+    unsigned char* bufferData(uint16_t buffer)
+    {
+        return buffer_data + buffer * received_buffer_size;
+    }
+
+    int fd {-1};
+
+    void* sq_map {MAP_FAILED};
+    size_t sq_map_size {0};
+    void* cq_map {MAP_FAILED};
+    size_t cq_map_size {0};
+    io_uring_sqe* sqes {static_cast<io_uring_sqe*>(MAP_FAILED)};
+    size_t sqes_size {0};
+
+    unsigned* sq_head;
+    unsigned* sq_tail;
+    unsigned sq_mask;
+    unsigned sq_entries;
+
+    unsigned* cq_head;
+    unsigned* cq_tail;
+    unsigned cq_mask;
+    io_uring_cqe* cqes;
+
+    /// tail of the requests being written, published by enter()
+    unsigned local_tail {0};
+
+    /// ring of the buffers provided for the receptions, NULL without multishot requests
+    struct io_uring_buf_ring* buffers {nullptr};
+    /// the buffers themselves, after their ring in the same mapping
+    unsigned char* buffer_data {nullptr};
+    size_t buffers_size {0};
+    uint16_t buffers_tail {0};
+
+    /// registered buffer of the sends, NULL if the registration failed
+    unsigned char* send_arena {nullptr};
+};
+
+std::unique_ptr<IoUringReactor::Ring> IoUringReactor::Ring::create(unsigned entries)
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    std::unique_ptr<Ring> ring(new Ring);
+    ring->fd = syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->fd < 0) {
+        Debug(D, pdInit) << "No io_uring: " << strerror(errno) << std::endl;
+        return nullptr;
+    }
+    // sendmsg and the completions which are never dropped came with 5.5
+    if (!(params.features & IORING_FEAT_NODROP)) {
+        Debug(D, pdInit) << "No io_uring: kernel too old" << std::endl;
+        return nullptr;
+    }
+
+    ring->sq_map_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_map_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_map = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_map) {
+        ring->sq_map_size = ring->cq_map_size = std::max(ring->sq_map_size, ring->cq_map_size);
+    }
+
+    ring->sq_map = mmap(nullptr, ring->sq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                        IORING_OFF_SQ_RING);
+    if (ring->sq_map == MAP_FAILED) {
+        return nullptr;
+    }
+    if (single_map) {
+        ring->cq_map = ring->sq_map;
+    }
+    else {
+        ring->cq_map = mmap(nullptr, ring->cq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                            IORING_OFF_CQ_RING);
+        if (ring->cq_map == MAP_FAILED) {
+            return nullptr;
+        }
+    }
+    ring->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    ring->sqes = static_cast<io_uring_sqe*>(mmap(
+        nullptr, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES));
+    if (ring->sqes == MAP_FAILED) {
+        return nullptr;
+    }
+
+    char* sq = static_cast<char*>(ring->sq_map);
+    ring->sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    ring->sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    ring->sq_mask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    ring->sq_entries = params.sq_entries;
+    ring->local_tail = *ring->sq_tail;
+
+    // request i always sits in slot i
+    unsigned* array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    for (unsigned i = 0; i < params.sq_entries; ++i) {
+        array[i] = i;
+    }
+
+    char* cq = static_cast<char*>(ring->cq_map);
+    ring->cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    ring->cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    ring->cq_mask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    ring->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+    Debug(D, pdInit) << "io_uring with " << params.sq_entries << " entries" << std::endl;
+    ring->setupBuffers();
+    ring->setupSendArena();
+    return ring;
+}
+
+bool IoUringReactor::Ring::setupBuffers()
+{
+#ifdef IORING_RECV_MULTISHOT
+    // the multishot receptions came with the zero copy sends, in 6.0
+    std::vector<char> storage(sizeof(io_uring_probe) + IORING_OP_LAST * sizeof(io_uring_probe_op), 0);
+    auto probe = reinterpret_cast<io_uring_probe*>(storage.data());
+    if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, IORING_OP_LAST) < 0
+        || probe->last_op < IORING_OP_SEND_ZC || !(probe->ops[IORING_OP_SEND_ZC].flags & IO_URING_OP_SUPPORTED)) {
+        Debug(D, pdInit) << "No multishot requests: kernel too old" << std::endl;
+        return false;
+    }
+
+    const size_t ring_size = received_buffers * sizeof(io_uring_buf);
+    buffers_size = ring_size + received_buffers * received_buffer_size;
+    void* memory = mmap(nullptr, buffers_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        return false;
+    }
+
+    struct io_uring_buf_reg registration;
+    memset(&registration, 0, sizeof(registration));
+    registration.ring_addr = reinterpret_cast<uint64_t>(memory);
+    registration.ring_entries = received_buffers;
+    registration.bgid = buffer_group;
+    if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_PBUF_RING, &registration, 1) < 0) {
+        Debug(D, pdInit) << "No multishot requests: " << strerror(errno) << std::endl;
+        munmap(memory, buffers_size);
+        return false;
+    }
+
+    buffers = static_cast<io_uring_buf_ring*>(memory);
+    buffer_data = static_cast<unsigned char*>(memory) + ring_size;
+    for (unsigned buffer = 0; buffer < received_buffers; ++buffer) {
+        provide(buffer);
+    }
+    Debug(D, pdInit) << "Multishot requests, " << received_buffers << " buffers of " << received_buffer_size
+                     << " bytes" << std::endl;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void IoUringReactor::Ring::setupSendArena()
+{
+    void* memory = mmap(nullptr, send_arena_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        return;
+    }
+
+    // the kernel maps it once for all, instead of at each send
+    struct iovec arena = {memory, send_arena_size};
+    if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_BUFFERS, &arena, 1) < 0) {
+        Debug(D, pdInit) << "No registered send buffer: " << strerror(errno) << std::endl;
+        munmap(memory, send_arena_size);
+        return;
+    }
+    send_arena = static_cast<unsigned char*>(memory);
+}
+
+void IoUringReactor::Ring::provide(uint16_t buffer)
+{
+#ifdef IORING_RECV_MULTISHOT
+    // the entries start with the ring, its tail overlaps the first one (in C++
+    // the empty struct of __DECLARE_FLEX_ARRAY shifts bufs)
+    io_uring_buf& entry = reinterpret_cast<io_uring_buf*>(buffers)[buffers_tail & (received_buffers - 1)];
+    entry.addr = reinterpret_cast<uint64_t>(bufferData(buffer));
+    entry.len = received_buffer_size;
+    entry.bid = buffer;
+    ++buffers_tail;
+    __atomic_store_n(&buffers->tail, buffers_tail, __ATOMIC_RELEASE);
+#else
+    (void) buffer;
+#endif
+}
+
+IoUringReactor::Ring::~Ring()
+{
+    if (sqes != MAP_FAILED) {
+        munmap(sqes, sqes_size);
+    }
+    if (cq_map != MAP_FAILED && cq_map != sq_map) {
+        munmap(cq_map, cq_map_size);
+    }
+    if (sq_map != MAP_FAILED) {
+        munmap(sq_map, sq_map_size);
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+    // the kernel let them go with the ring
+    if (buffers) {
+        munmap(buffers, buffers_size);
+    }
+    if (send_arena) {
+        munmap(send_arena, send_arena_size);
+    }
+}
+
+IoUringReactor::IoUringReactor(unsigned entries)
+{
+    const char* io_uring = getenv("CERTI_IO_URING");
+    if (io_uring && strcmp(io_uring, "off") == 0) {
+        Debug(D, pdInit) << "io_uring disabled, using poll()" << std::endl;
+        return;
+    }
+    my_ring = Ring::create(entries);
+}
+
+IoUringReactor::~IoUringReactor() = default;
+
+bool IoUringReactor::usesIoUring() const
+{
+    return my_ring != nullptr;
+}
+
+bool IoUringReactor::usesMultishot() const
+{
+    return my_ring && my_ring->buffers;
+}
+
+io_uring_sqe* IoUringReactor::nextRequest()
+{
+    Ring& ring = *my_ring;
+
+    while (ring.local_tail - __atomic_load_n(ring.sq_head, __ATOMIC_ACQUIRE) >= ring.sq_entries) {
+        // the queue is full: submit it
+        if (enter(0) < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            throw NetworkError(std::string("io_uring_enter: ") + strerror(errno));
+        }
+        reap(nullptr);
+    }
+
+    io_uring_sqe* request = &ring.sqes[ring.local_tail & ring.sq_mask];
+    memset(request, 0, sizeof(*request));
+    ++ring.local_tail;
+    return request;
+}
+
+int IoUringReactor::enter(unsigned wait_count)
+{
+    Ring& ring = *my_ring;
+
+    const unsigned to_submit = ring.local_tail - *ring.sq_tail;
+    __atomic_store_n(ring.sq_tail, ring.local_tail, __ATOMIC_RELEASE);
+
+    return syscall(
+        __NR_io_uring_enter, ring.fd, to_submit, wait_count, wait_count ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+}
+
+void IoUringReactor::reap(std::vector<int>* ready)
+{
+    Ring& ring = *my_ring;
+
+    unsigned head = *ring.cq_head;
+    const unsigned tail = __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE);
+
+    for (; head != tail; ++head) {
+        const io_uring_cqe& completion = ring.cqes[head & ring.cq_mask];
+        const uint64_t tag = completion.user_data;
+
+        if (tag & send_tag) {
+            my_sends[tag & ~send_tag].result = completion.res;
+            --my_sends_in_flight;
+            continue;
+        }
+        if (tag & remove_tag) {
+            continue;
+        }
+
+        const int fd = static_cast<int>(tag & 0xffffffff);
+        auto watch = my_watches.find(fd);
+        if (watch == my_watches.end()
+            || requestTag(fd, watch->second.generation, watch->second.kind == Kind::Accept) != tag) {
+            // completion of a descriptor no longer watched: give back what it brings
+            if (completion.flags & IORING_CQE_F_BUFFER) {
+                ring.provide(completion.flags >> IORING_CQE_BUFFER_SHIFT);
+            }
+            if ((tag & accept_tag) && completion.res >= 0) {
+                ::close(completion.res);
+            }
+            continue;
+        }
+
+        if (watch->second.kind != Kind::Poll) {
+            complete(watch->second, fd, completion.res, completion.flags);
+            continue;
+        }
+
+        watch->second.armed = false;
+        my_rearm.push_back(fd);
+        if (completion.res < 0) {
+            Debug(D, pdError) << "Poll of " << fd << " failed: " << strerror(-completion.res) << std::endl;
+        }
+        else if (ready) {
+            ready->push_back(fd);
+        }
+    }
+
+    __atomic_store_n(ring.cq_head, head, __ATOMIC_RELEASE);
+}
+
+void IoUringReactor::complete(Watch& watch, int fd, int result, uint32_t flags)
+{
+#ifdef IORING_RECV_MULTISHOT
+    if (watch.kind == Kind::Receive) {
+        if (result > 0) {
+            watch.received.push_back(
+                {static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT), 0, static_cast<uint32_t>(result)});
+        }
+        else if (result == 0) {
+            watch.closed = true;
+        }
+        else if (result != -ENOBUFS) {
+            // (without buffer, the reception goes on once they are given back)
+            Debug(D, pdError) << "Reception on " << fd << " failed: " << strerror(-result) << std::endl;
+            watch.closed = true;
+            watch.error = result;
+        }
+    }
+    else if (result >= 0) {
+        watch.accepted.push_back(result);
+    }
+    else {
+        Debug(D, pdError) << "Accept on " << fd << " failed: " << strerror(-result) << std::endl;
+    }
+
+    if (!(flags & IORING_CQE_F_MORE)) {
+        watch.armed = false;
+        if (!watch.closed) {
+            my_rearm.push_back(fd);
+        }
+    }
+#else
+    (void) watch;
+    (void) fd;
+    (void) result;
+    (void) flags;
+#endif
+}
+
+void IoUringReactor::arm(int fd)
+{
+    auto watch = my_watches.find(fd);
+    if (watch == my_watches.end() || watch->second.armed || watch->second.closed) {
+        return;
+    }
+
+    io_uring_sqe* request = nextRequest();
+    request->fd = fd;
+    request->user_data = requestTag(fd, watch->second.generation, watch->second.kind == Kind::Accept);
+    switch (watch->second.kind) {
+    case Kind::Poll:
+        request->opcode = IORING_OP_POLL_ADD;
+#if __BYTE_ORDER == __BIG_ENDIAN
+        // the kernel reads the 16 bits events of older versions first
+        request->poll32_events = static_cast<uint32_t>(POLLIN) << 16;
+#else
+        request->poll32_events = POLLIN;
+#endif
+        break;
+#ifdef IORING_RECV_MULTISHOT
+    case Kind::Receive:
+        // into the provided buffers, until they run out
+        request->opcode = IORING_OP_RECV;
+        request->flags = IOSQE_BUFFER_SELECT;
+        request->buf_group = buffer_group;
+        request->ioprio = IORING_RECV_MULTISHOT;
+        break;
+    case Kind::Accept:
+        request->opcode = IORING_OP_ACCEPT;
+        request->ioprio = IORING_ACCEPT_MULTISHOT;
+        break;
+#else
+    default:
+        break;
+#endif
+    }
+    watch->second.armed = true;
+}
+
+void IoUringReactor::cancel(uint64_t tag, Kind kind)
+{
+    io_uring_sqe* request = nextRequest();
+    request->opcode = kind == Kind::Poll ? IORING_OP_POLL_REMOVE : IORING_OP_ASYNC_CANCEL;
+    request->fd = -1;
+    request->addr = tag;
+    request->user_data = remove_tag;
+    while (enter(0) < 0 && (errno == EINTR || errno == EAGAIN || errno == EBUSY)) {
+        reap(nullptr);
+    }
+}
+
+void IoUringReactor::watch(int fd)
+{
+    watch(fd, Kind::Poll, nullptr);
+}
+
+void IoUringReactor::watch(SocketTCP* link)
+{
+    if (usesMultishot()) {
+        watch(link->returnSocket(), Kind::Receive, link);
+    }
+    else {
+        watch(link->returnSocket(), Kind::Poll, nullptr);
+    }
+}
+
+void IoUringReactor::watchServer(SocketTCP* server)
+{
+    if (usesMultishot()) {
+        watch(server->returnSocket(), Kind::Accept, server);
+    }
+    else {
+        watch(server->returnSocket(), Kind::Poll, nullptr);
+    }
+}
+
+void IoUringReactor::watch(int fd, Kind kind, SocketTCP* socket)
+{
+    my_generation = (my_generation + 1) & generation_mask;
+    my_watches[fd] = Watch{my_generation, false, kind, socket, {}, {}, false, 0};
+    if (socket) {
+        socket->my_reactor = this;
+    }
+
+    if (my_ring) {
+        // submitted by the next wait()
+        my_rearm.push_back(fd);
+    }
+}
+
+void IoUringReactor::unwatch(int fd)
+{
+    auto watch = my_watches.find(fd);
+    if (watch == my_watches.end()) {
+        return;
+    }
+
+    Watch& unwatched = watch->second;
+    const bool armed = unwatched.armed;
+    const Kind kind = unwatched.kind;
+    const uint64_t tag = requestTag(fd, unwatched.generation, kind == Kind::Accept);
+    for (const auto& chunk : unwatched.received) {
+        my_ring->provide(chunk.buffer);
+    }
+    for (int accepted : unwatched.accepted) {
+        ::close(accepted);
+    }
+    if (unwatched.socket) {
+        unwatched.socket->my_reactor = nullptr;
+    }
+    my_watches.erase(watch);
+    my_rearm.erase(std::remove(my_rearm.begin(), my_rearm.end(), fd), my_rearm.end());
+
+    if (my_ring && armed) {
+        // the request holds the socket: remove it now, before the socket is closed
+        cancel(tag, kind);
+    }
+}
+
+long IoUringReactor::receive(SocketTCP* link, void* buffer, size_t size)
+{
+    const int fd = link->returnSocket();
+    Watch& watch = my_watches.at(fd);
+
+    while (watch.received.empty() && !watch.closed) {
+        if (!watch.armed) {
+            // nothing is received for the link meanwhile (the buffers ran out): read it directly
+            return recv(fd, buffer, size, 0);
+        }
+        // the other completions are kept for wait()
+        if (enter(1) < 0 && errno != EAGAIN && errno != EBUSY) {
+            return -1;
+        }
+        reap(nullptr);
+    }
+
+    size_t copied = 0;
+    while (copied < size && !watch.received.empty()) {
+        Chunk& chunk = watch.received.front();
+        const size_t length = std::min<size_t>(size - copied, chunk.length);
+        memcpy(static_cast<char*>(buffer) + copied, my_ring->bufferData(chunk.buffer) + chunk.offset, length);
+        chunk.offset += length;
+        chunk.length -= length;
+        copied += length;
+        if (chunk.length == 0) {
+            my_ring->provide(chunk.buffer);
+            watch.received.pop_front();
+        }
+    }
+    if (copied > 0) {
+        return copied;
+    }
+
+    if (watch.error) {
+        errno = -watch.error;
+        return -1;
+    }
+    return 0;
+}
+
+bool IoUringReactor::hasReceived(SocketTCP* link) const
+{
+    auto watch = my_watches.find(link->returnSocket());
+    return watch != my_watches.end() && watch->second.socket == link
+           && (!watch->second.received.empty() || watch->second.closed);
+}
+
+int IoUringReactor::accept(SocketTCP* server)
+{
+    auto watch = my_watches.find(server->returnSocket());
+    if (watch != my_watches.end() && !watch->second.accepted.empty()) {
+        const int fd = watch->second.accepted.front();
+        watch->second.accepted.pop_front();
+        return fd;
+    }
+    // none accepted yet, the multishot request may as well take the next one
+    return ::accept(server->returnSocket(), nullptr, nullptr);
+}
+
+void IoUringReactor::collect(std::vector<int>& ready) const
+{
+    for (const auto& watch : my_watches) {
+        const Watch& candidate = watch.second;
+        if ((candidate.kind == Kind::Receive && (!candidate.received.empty() || candidate.closed))
+            || (candidate.kind == Kind::Accept && !candidate.accepted.empty())) {
+            ready.push_back(watch.first);
+        }
+    }
+}
+
+int IoUringReactor::wait(std::vector<int>& ready)
+{
+    ready.clear();
+
+    if (!my_ring) {
+        return waitWithPoll(ready);
+    }
+
+    // the data may have been read since these completions: poll again
+    reap(nullptr);
+    std::vector<int> rearm;
+    rearm.swap(my_rearm);
+    for (int fd : rearm) {
+        arm(fd);
+    }
+
+    for (;;) {
+        // the links with data left, and the connections not taken yet
+        collect(ready);
+        if (!ready.empty()) {
+            break;
+        }
+
+        // submits the requests and waits with the same system call
+        const int submitted = enter(1);
+        if (submitted < 0) {
+            if (errno == EINTR) {
+                return -1;
+            }
+            if (errno != EAGAIN && errno != EBUSY) {
+                throw NetworkError(std::string("io_uring_enter: ") + strerror(errno));
+            }
+        }
+
+        const bool completed = *my_ring->cq_head != __atomic_load_n(my_ring->cq_tail, __ATOMIC_ACQUIRE);
+        reap(&ready);
+        if (!completed && submitted >= 0) {
+            // a signal ended the wait, after the submission
+            errno = EINTR;
+            return -1;
+        }
+    }
+
+    if (my_ring->local_tail != *my_ring->sq_tail) {
+        // the requests armed again, not submitted by a wait
+        enter(0);
+    }
+    return ready.size();
+}
+
+int IoUringReactor::waitWithPoll(std::vector<int>& ready)
+{
+    std::vector<struct pollfd> fds;
+    fds.reserve(my_watches.size());
+    for (const auto& watch : my_watches) {
+        fds.push_back({watch.first, POLLIN, 0});
+    }
+
+    if (::poll(fds.data(), fds.size(), -1) < 0) {
+        if (errno == EINTR) {
+            return -1;
+        }
+        throw NetworkError(std::string("poll: ") + strerror(errno));
+    }
+
+    for (const auto& fd : fds) {
+        if (fd.revents & (POLLIN | POLLHUP | POLLERR)) {
+            ready.push_back(fd.fd);
+        }
+    }
+    return ready.size();
+}
+
+void IoUringReactor::queueSend(SocketTCP* socket, libhla::MessageBuffer& frame)
+{
+    if (!my_ring) {
+        if (std::find(my_lost.begin(), my_lost.end(), socket) != my_lost.end()) {
+            return;
+        }
+        try {
+            if (frame.hasSegments()) {
+                socket->sendSegments(frame.segments());
+            }
+            else {
+                socket->send(static_cast<unsigned char*>(frame(0)), frame.size());
+            }
+        }
+        catch (NetworkError& e) {
+            Debug(D, pdExcept) << "Lost link " << socket->returnSocket() << ": " << e.reason() << std::endl;
+            my_lost.push_back(socket);
+        }
+        return;
+    }
+
+    auto send = std::find_if(my_sends.begin(), my_sends.end(), [socket](const Send& s) { return s.socket == socket; });
+    if (send == my_sends.end()) {
+        send = my_sends.insert(my_sends.end(), Send{socket, {}, 0, {}, 0});
+    }
+
+    if (frame.hasSegments()) {
+        for (const auto& segment : frame.segments()) {
+            if (segment.length > 0) {
+                send->iov.push_back({const_cast<uint8_t*>(segment.data), segment.length});
+                send->size += segment.length;
+            }
+        }
+    }
+    else {
+        send->iov.push_back({frame(0), frame.size()});
+        send->size += frame.size();
+    }
+}
+
+void IoUringReactor::flushSends(std::vector<SocketTCP*>& lost)
+{
+    lost.insert(lost.end(), my_lost.begin(), my_lost.end());
+    my_lost.clear();
+    if (my_sends.empty()) {
+        return;
+    }
+
+    size_t arena_used = 0;
+    for (size_t i = 0; i < my_sends.size(); ++i) {
+        Send& send = my_sends[i];
+        const bool fixed = my_ring->send_arena && send.size <= fixed_send_max
+                           && arena_used + send.size <= send_arena_size;
+        if (!fixed && send.iov.size() > IOV_MAX) {
+            // written below, in several calls
+            continue;
+        }
+
+        io_uring_sqe* request = nextRequest();
+        request->fd = send.socket->returnSocket();
+        request->user_data = send_tag | i;
+        if (fixed) {
+            // copied into the registered buffer: no iovec to read, no page to map
+            unsigned char* data = my_ring->send_arena + arena_used;
+            size_t offset = 0;
+            for (const auto& part : send.iov) {
+                memcpy(data + offset, part.iov_base, part.iov_len);
+                offset += part.iov_len;
+            }
+            send.iov.assign(1, iovec{data, send.size});
+            arena_used += send.size;
+
+            request->opcode = IORING_OP_WRITE_FIXED;
+            request->addr = reinterpret_cast<uint64_t>(data);
+            request->len = send.size;
+            request->buf_index = 0;
+        }
+        else {
+            memset(&send.header, 0, sizeof(send.header));
+            send.header.msg_iov = send.iov.data();
+            send.header.msg_iovlen = send.iov.size();
+
+            request->opcode = IORING_OP_SENDMSG;
+            request->addr = reinterpret_cast<uint64_t>(&send.header);
+            request->len = 1;
+            request->msg_flags = MSG_NOSIGNAL;
+        }
+        ++my_sends_in_flight;
+    }
+
+    // the kernel reads the frames until the last completion
+    while (my_sends_in_flight > 0) {
+        if (enter(1) < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            throw NetworkError(std::string("io_uring_enter: ") + strerror(errno));
+        }
+        reap(nullptr);
+    }
+
+    std::vector<Send> sends;
+    sends.swap(my_sends);
+
+    for (auto& send : sends) {
+        if (send.result < 0) {
+            Debug(D, pdExcept) << "Error while sending on TCP socket " << send.socket->returnSocket() << ": "
+                               << strerror(-send.result) << std::endl;
+            lost.push_back(send.socket);
+            continue;
+        }
+        send.socket->SentBytesCount += send.result;
+        if (static_cast<size_t>(send.result) < send.size) {
+            // the socket buffer was full: write the rest the usual way
+            try {
+                send.socket->sendSegments(remainder(send.iov, send.result));
+            }
+            catch (NetworkError& e) {
+                Debug(D, pdExcept) << "Lost link " << send.socket->returnSocket() << ": " << e.reason() << std::endl;
+                lost.push_back(send.socket);
+            }
+        }
+    }
+}
+
+} // namespace certi
@@ -0,0 +1,198 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_IO_URING_REACTOR_HH
+#define CERTI_IO_URING_REACTOR_HH
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <sys/socket.h>
+
+#include <include/certi.hh>
+#include <libHLA/MessageBuffer.hh>
+
+#include "SocketTCP.hh"
+
+struct io_uring_sqe;
+
+namespace certi {
+
+/**
+ * Linux io_uring event loop of the RTIG (CERTI_RTIG_USE_IO_URING).
+ *
+ * The plain TCP links and the listening sockets are served by multishot
+ * requests (kernel 6.0 or later): the data of a link is received into a ring
+ * of buffers provided to the kernel once for all, as it comes, and
+ * SocketTCP::receive() copies it from there; the connections are accepted as
+ * they come, and SocketTCP::accept() takes them. A link stays reported by
+ * wait() until its received data is consumed. When the buffers run out, the
+ * reception of a link stops until they are given back, and SocketTCP reads
+ * the link itself meanwhile.
+ *
+ * The other sockets (local links which may go through shared memory, secured
+ * links, or all of them on older kernels) are watched with one shot polls,
+ * re-armed by the next wait(): the re-arming requests are submitted by the very
+ * system call which waits. As with poll() and epoll, such a socket stays
+ * readable until all its data has been read. Only the polls completed during
+ * the wait are reported: the data of the earlier ones may have been read since,
+ * they are armed again.
+ *
+ * The frames sent to the links are queued (queueSend) and written together
+ * by flushSends(): one request per link, gathering all its frames, all
+ * submitted and waited for with a single system call. The frames of a link
+ * which fit are copied into a buffer registered with the kernel and written
+ * from there, the larger ones are gathered with sendmsg.
+ *
+ * If the kernel refuses io_uring (older than 5.5, or forbidden by a seccomp
+ * profile), or if CERTI_IO_URING is "off", poll() and plain writes are used.
+ */
+class CERTI_EXPORT IoUringReactor {
+public:
+    static constexpr unsigned defaultEntries = 256;
+
+    /// @param entries size of the submission queue
+    explicit IoUringReactor(unsigned entries = defaultEntries);
+    ~IoUringReactor();
+
+    IoUringReactor(const IoUringReactor&) = delete;
+    IoUringReactor& operator=(const IoUringReactor&) = delete;
+
+    /// Whether io_uring is used, or poll() and plain writes.
+    bool usesIoUring() const;
+
+    /// Whether the links and servers watched as such get multishot requests.
+    bool usesMultishot() const;
+
+    /// Report fd by wait() when it is readable.
+    void watch(int fd);
+
+    /** Report link by wait() when it has data. Every read of the link must go
+     * through SocketTCP::receive(), which takes the data received by io_uring.
+     */
+    void watch(SocketTCP* link);
+
+    /// Report server by wait() when a connection is pending, SocketTCP::accept() takes it.
+    void watchServer(SocketTCP* server);
+
+    /// Stop watching fd. Must be called before it is closed.
+    void unwatch(int fd);
+
+    /** Wait until some watched descriptors are readable (or closed).
+     * @param[out] ready the readable descriptors
+     * @return their number, -1 if a signal interrupted the wait (errno is EINTR)
+     */
+    int wait(std::vector<int>& ready);
+
+    /** Queue a frame to be written to socket by flushSends(). The frame is not
+     * copied: the buffer, and the values it references, must live until then.
+     * Without io_uring, the frame is written at once.
+     */
+    void queueSend(SocketTCP* socket, libhla::MessageBuffer& frame);
+
+    /** Write the queued frames. A link which fails is not written to any more
+     * until then, and it is reported: it may have missed a part of a frame.
+     * @param[out] lost receives the links which could not be written to
+     * @throw NetworkError if io_uring fails
+     */
+    void flushSends(std::vector<SocketTCP*>& lost);
+
+private:
+    struct Ring;
+
+    enum class Kind { Poll, Receive, Accept };
+
+    /// part of a provided buffer not received yet
+    struct Chunk {
+        uint16_t buffer;
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    /// watched descriptor
+    struct Watch {
+        /// distinguishes the completions of a closed descriptor from those of its successor
+        uint32_t generation;
+        /// a request is submitted, or about to be
+        bool armed;
+        Kind kind;
+        /// the link or server, for the multishot requests
+        SocketTCP* socket;
+        /// data received and not consumed yet, in order
+        std::deque<Chunk> received;
+        /// connections accepted and not taken yet
+        std::deque<int> accepted;
+        /// end of file reached (error is then 0) or reception failed (negative errno)
+        bool closed;
+        int error;
+    };
+
+    /// frames queued for one link
+    struct Send {
+        SocketTCP* socket;
+        std::vector<struct iovec> iov;
+        size_t size;
+        struct msghdr header;
+        int result;
+    };
+
+    /// SocketTCP::receive() and accept() take the data and the connections
+    friend class SocketTCP;
+
+    /// As recv(): bytes copied, 0 at the end of file, -1 with errno set.
+    long receive(SocketTCP* link, void* buffer, size_t size);
+    /// Whether receive() returns at once.
+    bool hasReceived(SocketTCP* link) const;
+    /// As accept(), the address is not given.
+    int accept(SocketTCP* server);
+
+    void watch(int fd, Kind kind, SocketTCP* socket);
+
+    io_uring_sqe* nextRequest();
+    int enter(unsigned wait_count);
+    /// @param ready receives the descriptors found readable, NULL if the completions may be stale
+    void reap(std::vector<int>* ready);
+    void complete(Watch& watch, int fd, int result, uint32_t flags);
+    void arm(int fd);
+    void cancel(uint64_t tag, Kind kind);
+    /// Add the multishot watches with something to take to ready.
+    void collect(std::vector<int>& ready) const;
+    int waitWithPoll(std::vector<int>& ready);
+
+    /// NULL when poll() is used
+    std::unique_ptr<Ring> my_ring;
+
+    std::map<int, Watch> my_watches;
+    uint32_t my_generation {0};
+    /// descriptors whose request completed, to be armed again by the next wait()
+    std::vector<int> my_rearm;
+
+    /// queued frames, one entry per link in first queueSend() order
+    std::vector<Send> my_sends;
+    unsigned my_sends_in_flight {0};
+    /// links which failed since the last flushSends()
+    std::vector<SocketTCP*> my_lost;
+};
+
+} // namespace certi
+
+#endif // CERTI_IO_URING_REACTOR_HH
@@ -1,4 +1,4 @@
-// Generated on 2018 April Fri, 13 at 11:41:23 by the CERTI message generator
+// Generated on 2026 October Mon, 19 at 07:33:19 by the CERTI message generator
 #include <string>
 #include <vector>
 #include "M_Classes.hh"
@@ -41,6 +41,15 @@ void EventRetraction::deserialize(libhla::MessageBuffer& msgBuffer)
     SN = msgBuffer.read_uint64();
 }
 
+uint32_t EventRetraction::serializedSize() const
+{
+    uint32_t size = 0;
+    // Specific fields
+    size += 4;
+    size += 8;
+    return size;
+}
+
 const FederateHandle& EventRetraction::getSendingFederate() const
 {
     return sendingFederate;
@@ -86,6 +95,10 @@ void M_Open_Connexion::serialize(libhla::MessageBuffer& msgBuffer)
     // Specific serialization code
     msgBuffer.write_uint32(versionMajor);
     msgBuffer.write_uint32(versionMinor);
+    msgBuffer.write_bool(_hasShmRingName);
+    if (_hasShmRingName) {
+        msgBuffer.write_string(shmRingName);
+    }
 }
 
 void M_Open_Connexion::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -95,6 +108,24 @@ void M_Open_Connexion::deserialize(libhla::MessageBuffer& msgBuffer)
     // Specific deserialization code
     versionMajor = msgBuffer.read_uint32();
     versionMinor = msgBuffer.read_uint32();
+    _hasShmRingName = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
+    if (_hasShmRingName) {
+        msgBuffer.read_string(shmRingName);
+    }
+}
+
+uint32_t M_Open_Connexion::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 1;
+    if (_hasShmRingName) {
+        size += 4 + shmRingName.size();
+    }
+    return size;
 }
 
 const uint32_t& M_Open_Connexion::getVersionMajor() const
@@ -117,6 +148,22 @@ void M_Open_Connexion::setVersionMinor(const uint32_t& newVersionMinor)
     versionMinor = newVersionMinor;
 }
 
+const std::string& M_Open_Connexion::getShmRingName() const
+{
+    return shmRingName;
+}
+
+void M_Open_Connexion::setShmRingName(const std::string& newShmRingName)
+{
+    _hasShmRingName = true;
+    shmRingName = newShmRingName;
+}
+
+bool M_Open_Connexion::hasShmRingName() const
+{
+    return _hasShmRingName;
+}
+
 std::ostream& operator<<(std::ostream& os, const M_Open_Connexion& msg)
 {
     os << "[M_Open_Connexion - Begin]" << std::endl;
@@ -126,6 +173,7 @@ std::ostream& operator<<(std::ostream& os, const M_Open_Connexion& msg)
     // Specific display
     os << "  versionMajor = " << msg.versionMajor << std::endl;
     os << "  versionMinor = " << msg.versionMinor << std::endl;
+    os << "  (opt) shmRingName =" << msg.shmRingName << std::endl;
     
     os << "[M_Open_Connexion - End]" << std::endl;
     return os;
@@ -161,6 +209,16 @@ void M_Create_Federation_Execution::deserialize(libhla::MessageBuffer& msgBuffer
     msgBuffer.read_string(FEDid);
 }
 
+uint32_t M_Create_Federation_Execution::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + federationName.size();
+    size += 4 + FEDid.size();
+    return size;
+}
+
 const std::string& M_Create_Federation_Execution::getFederationName() const
 {
     return federationName;
@@ -235,16 +293,38 @@ void M_Create_Federation_Execution_V4::deserialize(libhla::MessageBuffer& msgBuf
     for (uint32_t i = 0; i < fomModuleDesignatorsSize; ++i) {
         msgBuffer.read_string(fomModuleDesignators[i]);
     }
-    _hasMimDesignator = msgBuffer.read_bool();
+    _hasMimDesignator = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasMimDesignator) {
         msgBuffer.read_string(mimDesignator);
     }
-    _hasLogicalTimeRepresentation = msgBuffer.read_bool();
+    _hasLogicalTimeRepresentation = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasLogicalTimeRepresentation) {
         msgBuffer.read_string(logicalTimeRepresentation);
     }
 }
 
+uint32_t M_Create_Federation_Execution_V4::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + federationExecutionName.size();
+    size += 1;
+    size += 4;
+    for (const auto& element : fomModuleDesignators) {
+        size += 4 + element.size();
+    }
+    size += 1;
+    if (_hasMimDesignator) {
+        size += 4 + mimDesignator.size();
+    }
+    size += 1;
+    if (_hasLogicalTimeRepresentation) {
+        size += 4 + logicalTimeRepresentation.size();
+    }
+    return size;
+}
+
 const std::string& M_Create_Federation_Execution_V4::getFederationExecutionName() const
 {
     return federationExecutionName;
@@ -375,6 +455,15 @@ void M_Destroy_Federation_Execution::deserialize(libhla::MessageBuffer& msgBuffe
     msgBuffer.read_string(federationName);
 }
 
+uint32_t M_Destroy_Federation_Execution::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + federationName.size();
+    return size;
+}
+
 const std::string& M_Destroy_Federation_Execution::getFederationName() const
 {
     return federationName;
@@ -424,6 +513,17 @@ void M_Join_Federation_Execution::deserialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.read_string(federateName);
 }
 
+uint32_t M_Join_Federation_Execution::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 + federationName.size();
+    size += 4 + federateName.size();
+    return size;
+}
+
 const FederateHandle& M_Join_Federation_Execution::getFederate() const
 {
     return federate;
@@ -501,7 +601,7 @@ void M_Join_Federation_Execution_V4::deserialize(libhla::MessageBuffer& msgBuffe
     Super::deserialize(msgBuffer);
     // Specific deserialization code
     federate = static_cast<FederateHandle>(msgBuffer.read_uint32());
-    _hasFederateName = msgBuffer.read_bool();
+    _hasFederateName = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasFederateName) {
         msgBuffer.read_string(federateName);
     }
@@ -515,6 +615,26 @@ void M_Join_Federation_Execution_V4::deserialize(libhla::MessageBuffer& msgBuffe
     }
 }
 
+uint32_t M_Join_Federation_Execution_V4::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 1;
+    if (_hasFederateName) {
+        size += 4 + federateName.size();
+    }
+    size += 4 + federateType.size();
+    size += 1;
+    size += 4 + federationExecutionName.size();
+    size += 4;
+    for (const auto& element : additionalFomModules) {
+        size += 4 + element.size();
+    }
+    return size;
+}
+
 const FederateHandle& M_Join_Federation_Execution_V4::getFederate() const
 {
     return federate;
@@ -650,6 +770,15 @@ void M_Resign_Federation_Execution::deserialize(libhla::MessageBuffer& msgBuffer
     resignAction = static_cast<ResignAction>(msgBuffer.read_uint16());
 }
 
+uint32_t M_Resign_Federation_Execution::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 2;
+    return size;
+}
+
 const ResignAction& M_Resign_Federation_Execution::getResignAction() const
 {
     return resignAction;
@@ -686,9 +815,7 @@ void M_Register_Federation_Synchronization_Point::serialize(libhla::MessageBuffe
     // Specific serialization code
     uint32_t federateSetSize = federateSet.size();
     msgBuffer.write_uint32(federateSetSize);
-    for (uint32_t i = 0; i < federateSetSize; ++i) {
-        msgBuffer.write_uint32(federateSet[i]);
-    }
+    msgBuffer.write_uint32s(federateSet.data(), federateSetSize);
 }
 
 void M_Register_Federation_Synchronization_Point::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -698,9 +825,17 @@ void M_Register_Federation_Synchronization_Point::deserialize(libhla::MessageBuf
     // Specific deserialization code
     uint32_t federateSetSize = msgBuffer.read_uint32();
     federateSet.resize(federateSetSize);
-    for (uint32_t i = 0; i < federateSetSize; ++i) {
-        federateSet[i] = static_cast<FederateHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(federateSet.data(), federateSetSize);
+}
+
+uint32_t M_Register_Federation_Synchronization_Point::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 * federateSet.size();
+    return size;
 }
 
 uint32_t M_Register_Federation_Synchronization_Point::getFederateSetSize() const
@@ -855,6 +990,15 @@ void M_Request_Federation_Restore_Failed::deserialize(libhla::MessageBuffer& msg
     msgBuffer.read_string(reason);
 }
 
+uint32_t M_Request_Federation_Restore_Failed::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + reason.size();
+    return size;
+}
+
 const std::string& M_Request_Federation_Restore_Failed::getReason() const
 {
     return reason;
@@ -906,6 +1050,15 @@ void M_Initiate_Federate_Restore::deserialize(libhla::MessageBuffer& msgBuffer)
     federate = static_cast<FederateHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Initiate_Federate_Restore::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const FederateHandle& M_Initiate_Federate_Restore::getFederate() const
 {
     return federate;
@@ -973,9 +1126,7 @@ void M_Publish_Object_Class::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(objectClass);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Publish_Object_Class::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -986,9 +1137,18 @@ void M_Publish_Object_Class::deserialize(libhla::MessageBuffer& msgBuffer)
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Publish_Object_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectClassHandle& M_Publish_Object_Class::getObjectClass() const
@@ -1076,6 +1236,15 @@ void M_Unpublish_Object_Class::deserialize(libhla::MessageBuffer& msgBuffer)
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Unpublish_Object_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const ObjectClassHandle& M_Unpublish_Object_Class::getObjectClass() const
 {
     return objectClass;
@@ -1121,6 +1290,15 @@ void M_Publish_Interaction_Class::deserialize(libhla::MessageBuffer& msgBuffer)
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Publish_Interaction_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const InteractionClassHandle& M_Publish_Interaction_Class::getInteractionClass() const
 {
     return interactionClass;
@@ -1166,6 +1344,15 @@ void M_Unpublish_Interaction_Class::deserialize(libhla::MessageBuffer& msgBuffer
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Unpublish_Interaction_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const InteractionClassHandle& M_Unpublish_Interaction_Class::getInteractionClass() const
 {
     return interactionClass;
@@ -1203,9 +1390,7 @@ void M_Subscribe_Object_Class_Attributes::serialize(libhla::MessageBuffer& msgBu
     msgBuffer.write_uint32(objectClass);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     msgBuffer.write_bool(active);
 }
 
@@ -1217,12 +1402,22 @@ void M_Subscribe_Object_Class_Attributes::deserialize(libhla::MessageBuffer& msg
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     active = msgBuffer.read_bool();
 }
 
+uint32_t M_Subscribe_Object_Class_Attributes::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    size += 1;
+    return size;
+}
+
 const ObjectClassHandle& M_Subscribe_Object_Class_Attributes::getObjectClass() const
 {
     return objectClass;
@@ -1319,6 +1514,15 @@ void M_Unsubscribe_Object_Class::deserialize(libhla::MessageBuffer& msgBuffer)
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Unsubscribe_Object_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const ObjectClassHandle& M_Unsubscribe_Object_Class::getObjectClass() const
 {
     return objectClass;
@@ -1364,6 +1568,15 @@ void M_Subscribe_Interaction_Class::deserialize(libhla::MessageBuffer& msgBuffer
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Subscribe_Interaction_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const InteractionClassHandle& M_Subscribe_Interaction_Class::getInteractionClass() const
 {
     return interactionClass;
@@ -1409,6 +1622,15 @@ void M_Unsubscribe_Interaction_Class::deserialize(libhla::MessageBuffer& msgBuff
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Unsubscribe_Interaction_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const InteractionClassHandle& M_Unsubscribe_Interaction_Class::getInteractionClass() const
 {
     return interactionClass;
@@ -1454,6 +1676,15 @@ void M_Start_Registration_For_Object_Class::deserialize(libhla::MessageBuffer& m
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Start_Registration_For_Object_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const ObjectClassHandle& M_Start_Registration_For_Object_Class::getObjectClass() const
 {
     return objectClass;
@@ -1499,6 +1730,15 @@ void M_Stop_Registration_For_Object_Class::deserialize(libhla::MessageBuffer& ms
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Stop_Registration_For_Object_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const ObjectClassHandle& M_Stop_Registration_For_Object_Class::getObjectClass() const
 {
     return objectClass;
@@ -1544,6 +1784,15 @@ void M_Turn_Interactions_On::deserialize(libhla::MessageBuffer& msgBuffer)
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Turn_Interactions_On::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const InteractionClassHandle& M_Turn_Interactions_On::getInteractionClass() const
 {
     return interactionClass;
@@ -1589,6 +1838,15 @@ void M_Turn_Interactions_Off::deserialize(libhla::MessageBuffer& msgBuffer)
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Turn_Interactions_Off::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const InteractionClassHandle& M_Turn_Interactions_Off::getInteractionClass() const
 {
     return interactionClass;
@@ -1638,12 +1896,26 @@ void M_Register_Object_Instance::deserialize(libhla::MessageBuffer& msgBuffer)
     // Specific deserialization code
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    _hasObjectName = msgBuffer.read_bool();
+    _hasObjectName = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasObjectName) {
         msgBuffer.read_string(objectName);
     }
 }
 
+uint32_t M_Register_Object_Instance::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 1;
+    if (_hasObjectName) {
+        size += 4 + objectName.size();
+    }
+    return size;
+}
+
 const ObjectClassHandle& M_Register_Object_Instance::getObjectClass() const
 {
     return objectClass;
@@ -1710,15 +1982,13 @@ void M_Update_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     uint32_t valuesSize = values.size();
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
         msgBuffer.write_uint32(values[i].size());
-        msgBuffer.write_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.write_bytes(values[i].data(), values[i].size());
     }
     msgBuffer.write_bool(_hasEventRetraction);
     if (_hasEventRetraction) {
@@ -1735,22 +2005,40 @@ void M_Update_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
-        msgBuffer.read_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.read_bytes(values[i].data(), values[i].size());
     }
-    _hasEventRetraction = msgBuffer.read_bool();
+    _hasEventRetraction = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasEventRetraction) {
         eventRetraction.deserialize(msgBuffer);
     }
 }
 
+uint32_t M_Update_Attribute_Values::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    size += 4;
+    for (const auto& element : values) {
+        size += 4 + element.size();
+    }
+    size += 1;
+    if (_hasEventRetraction) {
+        size += eventRetraction.serializedSize();
+    }
+    return size;
+}
+
 const ObjectClassHandle& M_Update_Attribute_Values::getObjectClass() const
 {
     return objectClass;
@@ -1911,12 +2199,27 @@ void M_Discover_Object_Instance::deserialize(libhla::MessageBuffer& msgBuffer)
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     msgBuffer.read_string(objectName);
-    _hasEventRetraction = msgBuffer.read_bool();
+    _hasEventRetraction = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasEventRetraction) {
         eventRetraction.deserialize(msgBuffer);
     }
 }
 
+uint32_t M_Discover_Object_Instance::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 + objectName.size();
+    size += 1;
+    if (_hasEventRetraction) {
+        size += eventRetraction.serializedSize();
+    }
+    return size;
+}
+
 const ObjectClassHandle& M_Discover_Object_Instance::getObjectClass() const
 {
     return objectClass;
@@ -1994,15 +2297,13 @@ void M_Reflect_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     uint32_t valuesSize = values.size();
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
         msgBuffer.write_uint32(values[i].size());
-        msgBuffer.write_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.write_bytes(values[i].data(), values[i].size());
     }
     msgBuffer.write_bool(_hasEventRetraction);
     if (_hasEventRetraction) {
@@ -2019,22 +2320,40 @@ void M_Reflect_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
-        msgBuffer.read_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.read_bytes(values[i].data(), values[i].size());
     }
-    _hasEventRetraction = msgBuffer.read_bool();
+    _hasEventRetraction = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasEventRetraction) {
         eventRetraction.deserialize(msgBuffer);
     }
 }
 
+uint32_t M_Reflect_Attribute_Values::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    size += 4;
+    for (const auto& element : values) {
+        size += 4 + element.size();
+    }
+    size += 1;
+    if (_hasEventRetraction) {
+        size += eventRetraction.serializedSize();
+    }
+    return size;
+}
+
 const ObjectClassHandle& M_Reflect_Attribute_Values::getObjectClass() const
 {
     return objectClass;
@@ -2181,15 +2500,13 @@ void M_Send_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(interactionClass);
     uint32_t parametersSize = parameters.size();
     msgBuffer.write_uint32(parametersSize);
-    for (uint32_t i = 0; i < parametersSize; ++i) {
-        msgBuffer.write_uint32(parameters[i]);
-    }
+    msgBuffer.write_uint32s(parameters.data(), parametersSize);
     uint32_t valuesSize = values.size();
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
         msgBuffer.write_uint32(values[i].size());
-        msgBuffer.write_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.write_bytes(values[i].data(), values[i].size());
     }
     msgBuffer.write_uint32(region);
     msgBuffer.write_bool(_hasEventRetraction);
@@ -2206,23 +2523,41 @@ void M_Send_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
     uint32_t parametersSize = msgBuffer.read_uint32();
     parameters.resize(parametersSize);
-    for (uint32_t i = 0; i < parametersSize; ++i) {
-        parameters[i] = static_cast<ParameterHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(parameters.data(), parametersSize);
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
-        msgBuffer.read_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.read_bytes(values[i].data(), values[i].size());
     }
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
-    _hasEventRetraction = msgBuffer.read_bool();
+    _hasEventRetraction = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasEventRetraction) {
         eventRetraction.deserialize(msgBuffer);
     }
 }
 
+uint32_t M_Send_Interaction::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * parameters.size();
+    size += 4;
+    for (const auto& element : values) {
+        size += 4 + element.size();
+    }
+    size += 4;
+    size += 1;
+    if (_hasEventRetraction) {
+        size += eventRetraction.serializedSize();
+    }
+    return size;
+}
+
 const InteractionClassHandle& M_Send_Interaction::getInteractionClass() const
 {
     return interactionClass;
@@ -2369,15 +2704,13 @@ void M_Receive_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(interactionClass);
     uint32_t parametersSize = parameters.size();
     msgBuffer.write_uint32(parametersSize);
-    for (uint32_t i = 0; i < parametersSize; ++i) {
-        msgBuffer.write_uint32(parameters[i]);
-    }
+    msgBuffer.write_uint32s(parameters.data(), parametersSize);
     uint32_t valuesSize = values.size();
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
         msgBuffer.write_uint32(values[i].size());
-        msgBuffer.write_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.write_bytes(values[i].data(), values[i].size());
     }
     msgBuffer.write_uint32(region);
     msgBuffer.write_bool(_hasEventRetraction);
@@ -2394,23 +2727,41 @@ void M_Receive_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
     uint32_t parametersSize = msgBuffer.read_uint32();
     parameters.resize(parametersSize);
-    for (uint32_t i = 0; i < parametersSize; ++i) {
-        parameters[i] = static_cast<ParameterHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(parameters.data(), parametersSize);
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
-        msgBuffer.read_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.read_bytes(values[i].data(), values[i].size());
     }
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
-    _hasEventRetraction = msgBuffer.read_bool();
+    _hasEventRetraction = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasEventRetraction) {
         eventRetraction.deserialize(msgBuffer);
     }
 }
 
+uint32_t M_Receive_Interaction::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * parameters.size();
+    size += 4;
+    for (const auto& element : values) {
+        size += 4 + element.size();
+    }
+    size += 4;
+    size += 1;
+    if (_hasEventRetraction) {
+        size += eventRetraction.serializedSize();
+    }
+    return size;
+}
+
 const InteractionClassHandle& M_Receive_Interaction::getInteractionClass() const
 {
     return interactionClass;
@@ -2571,12 +2922,27 @@ void M_Delete_Object_Instance::deserialize(libhla::MessageBuffer& msgBuffer)
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     msgBuffer.read_string(objectName);
-    _hasEventRetraction = msgBuffer.read_bool();
+    _hasEventRetraction = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasEventRetraction) {
         eventRetraction.deserialize(msgBuffer);
     }
 }
 
+uint32_t M_Delete_Object_Instance::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 + objectName.size();
+    size += 1;
+    if (_hasEventRetraction) {
+        size += eventRetraction.serializedSize();
+    }
+    return size;
+}
+
 const ObjectClassHandle& M_Delete_Object_Instance::getObjectClass() const
 {
     return objectClass;
@@ -2661,6 +3027,15 @@ void M_Local_Delete_Object_Instance::deserialize(libhla::MessageBuffer& msgBuffe
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Local_Delete_Object_Instance::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const ObjectHandle& M_Local_Delete_Object_Instance::getObject() const
 {
     return object;
@@ -2712,12 +3087,27 @@ void M_Remove_Object_Instance::deserialize(libhla::MessageBuffer& msgBuffer)
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     msgBuffer.read_string(objectName);
-    _hasEventRetraction = msgBuffer.read_bool();
+    _hasEventRetraction = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasEventRetraction) {
         eventRetraction.deserialize(msgBuffer);
     }
 }
 
+uint32_t M_Remove_Object_Instance::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 + objectName.size();
+    size += 1;
+    if (_hasEventRetraction) {
+        size += eventRetraction.serializedSize();
+    }
+    return size;
+}
+
 const ObjectClassHandle& M_Remove_Object_Instance::getObjectClass() const
 {
     return objectClass;
@@ -2796,9 +3186,7 @@ void M_Change_Attribute_Transportation_Type::serialize(libhla::MessageBuffer& ms
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Change_Attribute_Transportation_Type::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -2811,9 +3199,20 @@ void M_Change_Attribute_Transportation_Type::deserialize(libhla::MessageBuffer&
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Change_Attribute_Transportation_Type::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 1;
+    size += 1;
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const TransportType& M_Change_Attribute_Transportation_Type::getTransportationType() const
@@ -2927,6 +3326,17 @@ void M_Change_Interaction_Transportation_Type::deserialize(libhla::MessageBuffer
     orderType = static_cast<OrderType>(msgBuffer.read_uint8());
 }
 
+uint32_t M_Change_Interaction_Transportation_Type::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 1;
+    size += 1;
+    return size;
+}
+
 const InteractionClassHandle& M_Change_Interaction_Transportation_Type::getInteractionClass() const
 {
     return interactionClass;
@@ -2986,9 +3396,7 @@ void M_Request_Object_Attribute_Value_Update::serialize(libhla::MessageBuffer& m
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Request_Object_Attribute_Value_Update::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -2999,9 +3407,18 @@ void M_Request_Object_Attribute_Value_Update::deserialize(libhla::MessageBuffer&
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Request_Object_Attribute_Value_Update::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Request_Object_Attribute_Value_Update::getObject() const
@@ -3081,9 +3498,7 @@ void M_Request_Class_Attribute_Value_Update::serialize(libhla::MessageBuffer& ms
     msgBuffer.write_uint32(objectClass);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Request_Class_Attribute_Value_Update::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -3094,9 +3509,18 @@ void M_Request_Class_Attribute_Value_Update::deserialize(libhla::MessageBuffer&
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Request_Class_Attribute_Value_Update::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectClassHandle& M_Request_Class_Attribute_Value_Update::getObjectClass() const
@@ -3176,9 +3600,7 @@ void M_Provide_Attribute_Value_Update::serialize(libhla::MessageBuffer& msgBuffe
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Provide_Attribute_Value_Update::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -3189,9 +3611,18 @@ void M_Provide_Attribute_Value_Update::deserialize(libhla::MessageBuffer& msgBuf
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Provide_Attribute_Value_Update::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Provide_Attribute_Value_Update::getObject() const
@@ -3271,9 +3702,7 @@ void M_Attributes_In_Scope::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Attributes_In_Scope::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -3284,9 +3713,18 @@ void M_Attributes_In_Scope::deserialize(libhla::MessageBuffer& msgBuffer)
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Attributes_In_Scope::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Attributes_In_Scope::getObject() const
@@ -3366,9 +3804,7 @@ void M_Attributes_Out_Of_Scope::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Attributes_Out_Of_Scope::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -3379,9 +3815,18 @@ void M_Attributes_Out_Of_Scope::deserialize(libhla::MessageBuffer& msgBuffer)
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Attributes_Out_Of_Scope::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Attributes_Out_Of_Scope::getObject() const
@@ -3461,9 +3906,7 @@ void M_Turn_Updates_On_For_Object_Instance::serialize(libhla::MessageBuffer& msg
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Turn_Updates_On_For_Object_Instance::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -3474,9 +3917,18 @@ void M_Turn_Updates_On_For_Object_Instance::deserialize(libhla::MessageBuffer& m
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Turn_Updates_On_For_Object_Instance::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Turn_Updates_On_For_Object_Instance::getObject() const
@@ -3556,9 +4008,7 @@ void M_Turn_Updates_Off_For_Object_Instance::serialize(libhla::MessageBuffer& ms
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Turn_Updates_Off_For_Object_Instance::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -3569,9 +4019,18 @@ void M_Turn_Updates_Off_For_Object_Instance::deserialize(libhla::MessageBuffer&
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Turn_Updates_Off_For_Object_Instance::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Turn_Updates_Off_For_Object_Instance::getObject() const
@@ -3657,9 +4116,7 @@ void M_Request_Attribute_Ownership_Assumption::serialize(libhla::MessageBuffer&
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Request_Attribute_Ownership_Assumption::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -3670,9 +4127,18 @@ void M_Request_Attribute_Ownership_Assumption::deserialize(libhla::MessageBuffer
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Request_Attribute_Ownership_Assumption::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Request_Attribute_Ownership_Assumption::getObject() const
@@ -3752,9 +4218,7 @@ void M_Negotiated_Attribute_Ownership_Divestiture::serialize(libhla::MessageBuff
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Negotiated_Attribute_Ownership_Divestiture::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -3765,9 +4229,18 @@ void M_Negotiated_Attribute_Ownership_Divestiture::deserialize(libhla::MessageBu
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Negotiated_Attribute_Ownership_Divestiture::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Negotiated_Attribute_Ownership_Divestiture::getObject() const
@@ -3847,9 +4320,7 @@ void M_Attribute_Ownership_Divestiture_Notification::serialize(libhla::MessageBu
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Attribute_Ownership_Divestiture_Notification::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -3860,9 +4331,18 @@ void M_Attribute_Ownership_Divestiture_Notification::deserialize(libhla::Message
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Attribute_Ownership_Divestiture_Notification::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Attribute_Ownership_Divestiture_Notification::getObject() const
@@ -3942,9 +4422,7 @@ void M_Attribute_Ownership_Acquisition_Notification::serialize(libhla::MessageBu
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Attribute_Ownership_Acquisition_Notification::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -3955,9 +4433,18 @@ void M_Attribute_Ownership_Acquisition_Notification::deserialize(libhla::Message
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Attribute_Ownership_Acquisition_Notification::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Attribute_Ownership_Acquisition_Notification::getObject() const
@@ -4037,9 +4524,7 @@ void M_Request_Attribute_Ownership_Acquisition::serialize(libhla::MessageBuffer&
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Request_Attribute_Ownership_Acquisition::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -4050,9 +4535,18 @@ void M_Request_Attribute_Ownership_Acquisition::deserialize(libhla::MessageBuffe
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Request_Attribute_Ownership_Acquisition::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Request_Attribute_Ownership_Acquisition::getObject() const
@@ -4132,9 +4626,7 @@ void M_Request_Attribute_Ownership_Release::serialize(libhla::MessageBuffer& msg
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Request_Attribute_Ownership_Release::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -4145,9 +4637,18 @@ void M_Request_Attribute_Ownership_Release::deserialize(libhla::MessageBuffer& m
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Request_Attribute_Ownership_Release::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Request_Attribute_Ownership_Release::getObject() const
@@ -4237,6 +4738,16 @@ void M_Query_Attribute_Ownership::deserialize(libhla::MessageBuffer& msgBuffer)
     attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Query_Attribute_Ownership::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const ObjectHandle& M_Query_Attribute_Ownership::getObject() const
 {
     return object;
@@ -4297,6 +4808,17 @@ void M_Inform_Attribute_Ownership::deserialize(libhla::MessageBuffer& msgBuffer)
     federate = static_cast<FederateHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Inform_Attribute_Ownership::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const ObjectHandle& M_Inform_Attribute_Ownership::getObject() const
 {
     return object;
@@ -4366,6 +4888,16 @@ void M_Is_Attribute_Owned_By_Federate::deserialize(libhla::MessageBuffer& msgBuf
     attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Is_Attribute_Owned_By_Federate::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const ObjectHandle& M_Is_Attribute_Owned_By_Federate::getObject() const
 {
     return object;
@@ -4426,6 +4958,17 @@ void M_Attribute_Is_Not_Owned::deserialize(libhla::MessageBuffer& msgBuffer)
     federate = static_cast<FederateHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Attribute_Is_Not_Owned::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const ObjectHandle& M_Attribute_Is_Not_Owned::getObject() const
 {
     return object;
@@ -4491,9 +5034,7 @@ void M_Attribute_Ownership_Acquisition_If_Available::serialize(libhla::MessageBu
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Attribute_Ownership_Acquisition_If_Available::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -4504,9 +5045,18 @@ void M_Attribute_Ownership_Acquisition_If_Available::deserialize(libhla::Message
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Attribute_Ownership_Acquisition_If_Available::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Attribute_Ownership_Acquisition_If_Available::getObject() const
@@ -4586,9 +5136,7 @@ void M_Attribute_Ownership_Unavailable::serialize(libhla::MessageBuffer& msgBuff
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Attribute_Ownership_Unavailable::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -4599,9 +5147,18 @@ void M_Attribute_Ownership_Unavailable::deserialize(libhla::MessageBuffer& msgBu
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Attribute_Ownership_Unavailable::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Attribute_Ownership_Unavailable::getObject() const
@@ -4681,9 +5238,7 @@ void M_Unconditional_Attribute_Ownership_Divestiture::serialize(libhla::MessageB
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Unconditional_Attribute_Ownership_Divestiture::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -4694,9 +5249,18 @@ void M_Unconditional_Attribute_Ownership_Divestiture::deserialize(libhla::Messag
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Unconditional_Attribute_Ownership_Divestiture::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Unconditional_Attribute_Ownership_Divestiture::getObject() const
@@ -4776,9 +5340,7 @@ void M_Attribute_Ownership_Acquisition::serialize(libhla::MessageBuffer& msgBuff
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Attribute_Ownership_Acquisition::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -4789,9 +5351,18 @@ void M_Attribute_Ownership_Acquisition::deserialize(libhla::MessageBuffer& msgBu
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Attribute_Ownership_Acquisition::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Attribute_Ownership_Acquisition::getObject() const
@@ -4871,9 +5442,7 @@ void M_Cancel_Negotiated_Attribute_Ownership_Divestiture::serialize(libhla::Mess
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Cancel_Negotiated_Attribute_Ownership_Divestiture::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -4884,9 +5453,18 @@ void M_Cancel_Negotiated_Attribute_Ownership_Divestiture::deserialize(libhla::Me
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Cancel_Negotiated_Attribute_Ownership_Divestiture::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Cancel_Negotiated_Attribute_Ownership_Divestiture::getObject() const
@@ -4966,9 +5544,7 @@ void M_Attribute_Ownership_Release_Response::serialize(libhla::MessageBuffer& ms
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Attribute_Ownership_Release_Response::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -4979,9 +5555,18 @@ void M_Attribute_Ownership_Release_Response::deserialize(libhla::MessageBuffer&
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Attribute_Ownership_Release_Response::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Attribute_Ownership_Release_Response::getObject() const
@@ -5061,9 +5646,7 @@ void M_Cancel_Attribute_Ownership_Acquisition::serialize(libhla::MessageBuffer&
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Cancel_Attribute_Ownership_Acquisition::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -5074,9 +5657,18 @@ void M_Cancel_Attribute_Ownership_Acquisition::deserialize(libhla::MessageBuffer
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Cancel_Attribute_Ownership_Acquisition::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Cancel_Attribute_Ownership_Acquisition::getObject() const
@@ -5156,9 +5748,7 @@ void M_Confirm_Attribute_Ownership_Acquisition_Cancellation::serialize(libhla::M
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Confirm_Attribute_Ownership_Acquisition_Cancellation::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -5169,9 +5759,18 @@ void M_Confirm_Attribute_Ownership_Acquisition_Cancellation::deserialize(libhla:
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Confirm_Attribute_Ownership_Acquisition_Cancellation::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Confirm_Attribute_Ownership_Acquisition_Cancellation::getObject() const
@@ -5253,9 +5852,7 @@ void M_Change_Attribute_Order_Type::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Change_Attribute_Order_Type::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -5268,9 +5865,20 @@ void M_Change_Attribute_Order_Type::deserialize(libhla::MessageBuffer& msgBuffer
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Change_Attribute_Order_Type::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 1;
+    size += 1;
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const TransportType& M_Change_Attribute_Order_Type::getTransport() const
@@ -5384,6 +5992,17 @@ void M_Change_Interaction_Order_Type::deserialize(libhla::MessageBuffer& msgBuff
     order = static_cast<OrderType>(msgBuffer.read_uint8());
 }
 
+uint32_t M_Change_Interaction_Order_Type::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 1;
+    size += 1;
+    return size;
+}
+
 const InteractionClassHandle& M_Change_Interaction_Order_Type::getInteractionClass() const
 {
     return interactionClass;
@@ -5451,6 +6070,15 @@ void M_Enable_Time_Regulation::deserialize(libhla::MessageBuffer& msgBuffer)
     lookahead = msgBuffer.read_double();
 }
 
+uint32_t M_Enable_Time_Regulation::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 8;
+    return size;
+}
+
 const double& M_Enable_Time_Regulation::getLookahead() const
 {
     return lookahead;
@@ -5496,6 +6124,15 @@ void M_Disable_Time_Regulation::deserialize(libhla::MessageBuffer& msgBuffer)
     lookahead = msgBuffer.read_double();
 }
 
+uint32_t M_Disable_Time_Regulation::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 8;
+    return size;
+}
+
 const double& M_Disable_Time_Regulation::getLookahead() const
 {
     return lookahead;
@@ -5571,6 +6208,15 @@ void M_Modify_Lookahead::deserialize(libhla::MessageBuffer& msgBuffer)
     lookahead = msgBuffer.read_double();
 }
 
+uint32_t M_Modify_Lookahead::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 8;
+    return size;
+}
+
 const double& M_Modify_Lookahead::getLookahead() const
 {
     return lookahead;
@@ -5616,6 +6262,15 @@ void M_Query_Lookahead::deserialize(libhla::MessageBuffer& msgBuffer)
     lookahead = msgBuffer.read_double();
 }
 
+uint32_t M_Query_Lookahead::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 8;
+    return size;
+}
+
 const double& M_Query_Lookahead::getLookahead() const
 {
     return lookahead;
@@ -5661,6 +6316,15 @@ void M_Retract::deserialize(libhla::MessageBuffer& msgBuffer)
     eventRetraction.deserialize(msgBuffer);
 }
 
+uint32_t M_Retract::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += eventRetraction.serializedSize();
+    return size;
+}
+
 const EventRetraction& M_Retract::getEventRetraction() const
 {
     return eventRetraction;
@@ -5788,6 +6452,17 @@ void M_Ddm_Create_Region::deserialize(libhla::MessageBuffer& msgBuffer)
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Ddm_Create_Region::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const SpaceHandle& M_Ddm_Create_Region::getSpace() const
 {
     return space;
@@ -5899,6 +6574,16 @@ void M_Ddm_Modify_Region::deserialize(libhla::MessageBuffer& msgBuffer)
     }
 }
 
+uint32_t M_Ddm_Modify_Region::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const RegionHandle& M_Ddm_Modify_Region::getRegion() const
 {
     return region;
@@ -5985,6 +6670,15 @@ void M_Ddm_Delete_Region::deserialize(libhla::MessageBuffer& msgBuffer)
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Ddm_Delete_Region::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const RegionHandle& M_Ddm_Delete_Region::getRegion() const
 {
     return region;
@@ -6027,9 +6721,7 @@ void M_Ddm_Register_Object::serialize(libhla::MessageBuffer& msgBuffer)
     }
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Ddm_Register_Object::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -6039,15 +6731,29 @@ void M_Ddm_Register_Object::deserialize(libhla::MessageBuffer& msgBuffer)
     // Specific deserialization code
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    _hasObjectInstanceName = msgBuffer.read_bool();
+    _hasObjectInstanceName = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasObjectInstanceName) {
         msgBuffer.read_string(objectInstanceName);
     }
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Ddm_Register_Object::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 1;
+    if (_hasObjectInstanceName) {
+        size += 4 + objectInstanceName.size();
     }
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectClassHandle& M_Ddm_Register_Object::getObjectClass() const
@@ -6156,9 +6862,7 @@ void M_Ddm_Associate_Region::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(region);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Ddm_Associate_Region::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -6170,9 +6874,19 @@ void M_Ddm_Associate_Region::deserialize(libhla::MessageBuffer& msgBuffer)
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Ddm_Associate_Region::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& M_Ddm_Associate_Region::getObject() const
@@ -6273,6 +6987,16 @@ void M_Ddm_Unassociate_Region::deserialize(libhla::MessageBuffer& msgBuffer)
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Ddm_Unassociate_Region::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const ObjectHandle& M_Ddm_Unassociate_Region::getObject() const
 {
     return object;
@@ -6323,9 +7047,7 @@ void M_Ddm_Subscribe_Attributes::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_bool(passive);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Ddm_Subscribe_Attributes::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -6338,9 +7060,20 @@ void M_Ddm_Subscribe_Attributes::deserialize(libhla::MessageBuffer& msgBuffer)
     passive = msgBuffer.read_bool();
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Ddm_Subscribe_Attributes::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 1;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectClassHandle& M_Ddm_Subscribe_Attributes::getObjectClass() const
@@ -6457,6 +7190,16 @@ void M_Ddm_Unsubscribe_Attributes::deserialize(libhla::MessageBuffer& msgBuffer)
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Ddm_Unsubscribe_Attributes::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const ObjectClassHandle& M_Ddm_Unsubscribe_Attributes::getObjectClass() const
 {
     return objectClass;
@@ -6517,6 +7260,17 @@ void M_Ddm_Subscribe_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
     passive = msgBuffer.read_bool();
 }
 
+uint32_t M_Ddm_Subscribe_Interaction::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 1;
+    return size;
+}
+
 const InteractionClassHandle& M_Ddm_Subscribe_Interaction::getInteractionClass() const
 {
     return interactionClass;
@@ -6593,6 +7347,17 @@ void M_Ddm_Unsubscribe_Interaction::deserialize(libhla::MessageBuffer& msgBuffer
     passive = msgBuffer.read_bool();
 }
 
+uint32_t M_Ddm_Unsubscribe_Interaction::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 1;
+    return size;
+}
+
 const InteractionClassHandle& M_Ddm_Unsubscribe_Interaction::getInteractionClass() const
 {
     return interactionClass;
@@ -6658,9 +7423,7 @@ void M_Ddm_Request_Update::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(region);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void M_Ddm_Request_Update::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -6672,9 +7435,19 @@ void M_Ddm_Request_Update::deserialize(libhla::MessageBuffer& msgBuffer)
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t M_Ddm_Request_Update::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectClassHandle& M_Ddm_Request_Update::getObjectClass() const
@@ -6775,6 +7548,16 @@ void M_Get_Object_Class_Handle::deserialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.read_string(className);
 }
 
+uint32_t M_Get_Object_Class_Handle::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 + className.size();
+    return size;
+}
+
 const ObjectClassHandle& M_Get_Object_Class_Handle::getObjectClass() const
 {
     return objectClass;
@@ -6833,6 +7616,16 @@ void M_Get_Object_Class_Name::deserialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.read_string(className);
 }
 
+uint32_t M_Get_Object_Class_Name::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 + className.size();
+    return size;
+}
+
 const ObjectClassHandle& M_Get_Object_Class_Name::getObjectClass() const
 {
     return objectClass;
@@ -6893,6 +7686,17 @@ void M_Get_Attribute_Handle::deserialize(libhla::MessageBuffer& msgBuffer)
     attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Get_Attribute_Handle::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 + attributeName.size();
+    size += 4;
+    return size;
+}
+
 const ObjectClassHandle& M_Get_Attribute_Handle::getObjectClass() const
 {
     return objectClass;
@@ -6964,6 +7768,17 @@ void M_Get_Attribute_Name::deserialize(libhla::MessageBuffer& msgBuffer)
     attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Get_Attribute_Name::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 + attributeName.size();
+    size += 4;
+    return size;
+}
+
 const ObjectClassHandle& M_Get_Attribute_Name::getObjectClass() const
 {
     return objectClass;
@@ -7033,6 +7848,16 @@ void M_Get_Interaction_Class_Handle::deserialize(libhla::MessageBuffer& msgBuffe
     msgBuffer.read_string(className);
 }
 
+uint32_t M_Get_Interaction_Class_Handle::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 + className.size();
+    return size;
+}
+
 const InteractionClassHandle& M_Get_Interaction_Class_Handle::getInteractionClass() const
 {
     return interactionClass;
@@ -7091,6 +7916,16 @@ void M_Get_Interaction_Class_Name::deserialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.read_string(className);
 }
 
+uint32_t M_Get_Interaction_Class_Name::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 + className.size();
+    return size;
+}
+
 const InteractionClassHandle& M_Get_Interaction_Class_Name::getInteractionClass() const
 {
     return interactionClass;
@@ -7151,6 +7986,17 @@ void M_Get_Parameter_Handle::deserialize(libhla::MessageBuffer& msgBuffer)
     parameter = static_cast<ParameterHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Get_Parameter_Handle::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 + parameterName.size();
+    size += 4;
+    return size;
+}
+
 const InteractionClassHandle& M_Get_Parameter_Handle::getInteractionClass() const
 {
     return interactionClass;
@@ -7222,6 +8068,17 @@ void M_Get_Parameter_Name::deserialize(libhla::MessageBuffer& msgBuffer)
     parameter = static_cast<ParameterHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Get_Parameter_Name::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 + parameterName.size();
+    size += 4;
+    return size;
+}
+
 const InteractionClassHandle& M_Get_Parameter_Name::getInteractionClass() const
 {
     return interactionClass;
@@ -7291,6 +8148,16 @@ void M_Get_Object_Instance_Handle::deserialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.read_string(objectInstanceName);
 }
 
+uint32_t M_Get_Object_Instance_Handle::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 + objectInstanceName.size();
+    return size;
+}
+
 const ObjectHandle& M_Get_Object_Instance_Handle::getObject() const
 {
     return object;
@@ -7349,6 +8216,16 @@ void M_Get_Object_Instance_Name::deserialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.read_string(objectInstanceName);
 }
 
+uint32_t M_Get_Object_Instance_Name::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 + objectInstanceName.size();
+    return size;
+}
+
 const ObjectHandle& M_Get_Object_Instance_Name::getObject() const
 {
     return object;
@@ -7407,6 +8284,16 @@ void M_Get_Space_Handle::deserialize(libhla::MessageBuffer& msgBuffer)
     space = static_cast<SpaceHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Get_Space_Handle::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + spaceName.size();
+    size += 4;
+    return size;
+}
+
 const std::string& M_Get_Space_Handle::getSpaceName() const
 {
     return spaceName;
@@ -7465,6 +8352,16 @@ void M_Get_Space_Name::deserialize(libhla::MessageBuffer& msgBuffer)
     space = static_cast<SpaceHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Get_Space_Name::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + spaceName.size();
+    size += 4;
+    return size;
+}
+
 const std::string& M_Get_Space_Name::getSpaceName() const
 {
     return spaceName;
@@ -7525,6 +8422,17 @@ void M_Get_Dimension_Handle::deserialize(libhla::MessageBuffer& msgBuffer)
     dimension = static_cast<DimensionHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Get_Dimension_Handle::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + dimensionName.size();
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const std::string& M_Get_Dimension_Handle::getDimensionName() const
 {
     return dimensionName;
@@ -7596,6 +8504,17 @@ void M_Get_Dimension_Name::deserialize(libhla::MessageBuffer& msgBuffer)
     dimension = static_cast<DimensionHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Get_Dimension_Name::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + dimensionName.size();
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const std::string& M_Get_Dimension_Name::getDimensionName() const
 {
     return dimensionName;
@@ -7667,6 +8586,17 @@ void M_Get_Attribute_Space_Handle::deserialize(libhla::MessageBuffer& msgBuffer)
     space = static_cast<SpaceHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Get_Attribute_Space_Handle::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const ObjectClassHandle& M_Get_Attribute_Space_Handle::getObjectClass() const
 {
     return objectClass;
@@ -7736,6 +8666,16 @@ void M_Get_Object_Class::deserialize(libhla::MessageBuffer& msgBuffer)
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Get_Object_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const ObjectClassHandle& M_Get_Object_Class::getObjectClass() const
 {
     return objectClass;
@@ -7794,6 +8734,16 @@ void M_Get_Interaction_Space_Handle::deserialize(libhla::MessageBuffer& msgBuffe
     space = static_cast<SpaceHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t M_Get_Interaction_Space_Handle::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const InteractionClassHandle& M_Get_Interaction_Space_Handle::getInteractionClass() const
 {
     return interactionClass;
@@ -7852,6 +8802,16 @@ void M_Get_Transportation_Handle::deserialize(libhla::MessageBuffer& msgBuffer)
     transportation = static_cast<TransportType>(msgBuffer.read_uint8());
 }
 
+uint32_t M_Get_Transportation_Handle::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + transportationName.size();
+    size += 1;
+    return size;
+}
+
 const std::string& M_Get_Transportation_Handle::getTransportationName() const
 {
     return transportationName;
@@ -7910,6 +8870,16 @@ void M_Get_Transportation_Name::deserialize(libhla::MessageBuffer& msgBuffer)
     transportation = static_cast<TransportType>(msgBuffer.read_uint8());
 }
 
+uint32_t M_Get_Transportation_Name::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + transportationName.size();
+    size += 1;
+    return size;
+}
+
 const std::string& M_Get_Transportation_Name::getTransportationName() const
 {
     return transportationName;
@@ -7968,6 +8938,16 @@ void M_Get_Ordering_Handle::deserialize(libhla::MessageBuffer& msgBuffer)
     ordering = static_cast<OrderType>(msgBuffer.read_uint8());
 }
 
+uint32_t M_Get_Ordering_Handle::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + orderingName.size();
+    size += 1;
+    return size;
+}
+
 const std::string& M_Get_Ordering_Handle::getOrderingName() const
 {
     return orderingName;
@@ -8026,6 +9006,16 @@ void M_Get_Ordering_Name::deserialize(libhla::MessageBuffer& msgBuffer)
     ordering = static_cast<OrderType>(msgBuffer.read_uint8());
 }
 
+uint32_t M_Get_Ordering_Name::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + orderingName.size();
+    size += 1;
+    return size;
+}
+
 const std::string& M_Get_Ordering_Name::getOrderingName() const
 {
     return orderingName;
@@ -8134,6 +9124,17 @@ void M_Tick_Request::deserialize(libhla::MessageBuffer& msgBuffer)
     maxTickTime = msgBuffer.read_double();
 }
 
+uint32_t M_Tick_Request::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 1;
+    size += 8;
+    size += 8;
+    return size;
+}
+
 const bool& M_Tick_Request::getMultiple() const
 {
     return multiple;
@@ -8213,6 +9214,15 @@ void M_Reserve_Object_Instance_Name::deserialize(libhla::MessageBuffer& msgBuffe
     msgBuffer.read_string(objectName);
 }
 
+uint32_t M_Reserve_Object_Instance_Name::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + objectName.size();
+    return size;
+}
+
 const std::string& M_Reserve_Object_Instance_Name::getObjectName() const
 {
     return objectName;
@@ -8710,16 +9720,18 @@ Message* M_Factory::create(M_Type type) throw (NetworkError ,NetworkSignal) {
 } /* end of M_Factory::create */
 
 Message* M_Factory::receive(MStreamType stream) throw (NetworkError ,NetworkSignal) { 
-    // FIXME This is not thread safe
-    static libhla::MessageBuffer msgBuffer;
-    Message  msgGen;
-    Message* msg;
-
-    // receive generic message 
-    msgGen.receive(stream,msgBuffer);
-    // create specific message from type 
-    msg = M_Factory::create(msgGen.getMessageType());
-    msgBuffer.assumeSizeFromReservedBytes();
+    // one buffer per thread: links may be read concurrently
+    static thread_local libhla::MessageBuffer msgBuffer;
+    return M_Factory::receive(stream, msgBuffer);
+} /* end of M_Factory::receive */
+
+Message* M_Factory::receive(MStreamType stream, libhla::MessageBuffer& msgBuffer) throw (NetworkError ,NetworkSignal) { 
+    // receive the whole message 
+    Message::receiveBuffer(stream, msgBuffer);
+    // peek the type (first field after the header) 
+    Message* msg = M_Factory::create(static_cast<M_Type>(msgBuffer.read_int32()));
+    // and deserialize once into the specific message 
+    msgBuffer.rewind();
     msg->deserialize(msgBuffer);
     return msg;
 } /* end of M_Factory::receive */ 
@@ -1,4 +1,4 @@
-// Generated on 2018 April Fri, 13 at 11:41:23 by the CERTI message generator
+// Generated on 2026 October Mon, 19 at 13:09:51 by the CERTI message generator
 #ifndef M_CLASSES_HH
 #define M_CLASSES_HH
 // ****-**** Global System includes ****-****
@@ -66,6 +66,9 @@ public:
     
     void serialize(libhla::MessageBuffer& msgBuffer);
     void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const FederateHandle& getSendingFederate() const;
@@ -91,6 +94,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const uint32_t& getVersionMajor() const;
@@ -99,12 +105,18 @@ public:
     const uint32_t& getVersionMinor() const;
     void setVersionMinor(const uint32_t& newVersionMinor);
     
+    const std::string& getShmRingName() const;
+    void setShmRingName(const std::string& newShmRingName);
+    bool hasShmRingName() const;
+    
     using Super = Message;
     friend std::ostream& operator<<(std::ostream& os, const M_Open_Connexion& msg);
 
 protected:
     uint32_t versionMajor;
     uint32_t versionMinor;
+    std::string shmRingName;// shared memory ring transport, see SocketSHMRing
+    bool _hasShmRingName {false};
 };
 
 std::ostream& operator<<(std::ostream& os, const M_Open_Connexion& msg);
@@ -125,6 +137,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getFederationName() const;
@@ -151,6 +166,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getFederationExecutionName() const;
@@ -198,6 +216,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getFederationName() const;
@@ -220,6 +241,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const FederateHandle& getFederate() const;
@@ -250,6 +274,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const FederateHandle& getFederate() const;
@@ -299,6 +326,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ResignAction& getResignAction() const;
@@ -321,6 +351,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     uint32_t getFederateSetSize() const;
@@ -452,6 +485,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getReason() const;
@@ -482,6 +518,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const FederateHandle& getFederate() const;
@@ -544,6 +583,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -575,6 +617,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -597,6 +642,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -619,6 +667,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -641,6 +692,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -676,6 +730,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -698,6 +755,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -720,6 +780,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -742,6 +805,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -764,6 +830,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -786,6 +855,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -808,6 +880,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -830,6 +905,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -862,6 +940,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -912,6 +993,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -948,6 +1032,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -998,6 +1085,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -1048,6 +1138,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -1098,6 +1191,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -1134,6 +1230,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1156,6 +1255,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -1192,6 +1294,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const TransportType& getTransportationType() const;
@@ -1231,6 +1336,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -1261,6 +1369,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1292,6 +1403,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -1323,6 +1437,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1354,6 +1471,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1385,6 +1505,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1416,6 +1539,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1447,6 +1573,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1486,6 +1615,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1517,6 +1649,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1548,6 +1683,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1579,6 +1717,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1610,6 +1751,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1641,6 +1785,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1672,6 +1819,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1698,6 +1848,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1728,6 +1881,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1754,6 +1910,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1792,6 +1951,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1823,6 +1985,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1854,6 +2019,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1885,6 +2053,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1916,6 +2087,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1947,6 +2121,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1978,6 +2155,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -2009,6 +2189,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -2040,6 +2223,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const TransportType& getTransport() const;
@@ -2079,6 +2265,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -2109,6 +2298,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const double& getLookahead() const;
@@ -2131,6 +2323,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const double& getLookahead() const;
@@ -2193,6 +2388,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const double& getLookahead() const;
@@ -2215,6 +2413,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const double& getLookahead() const;
@@ -2237,6 +2438,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const EventRetraction& getEventRetraction() const;
@@ -2347,6 +2551,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const SpaceHandle& getSpace() const;
@@ -2382,6 +2589,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const RegionHandle& getRegion() const;
@@ -2413,6 +2623,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const RegionHandle& getRegion() const;
@@ -2435,6 +2648,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -2476,6 +2692,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -2511,6 +2730,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -2537,6 +2759,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -2577,6 +2802,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -2603,6 +2831,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -2634,6 +2865,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -2665,6 +2899,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -2700,6 +2937,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -2726,6 +2966,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -2752,6 +2995,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -2782,6 +3028,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -2812,6 +3061,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -2838,6 +3090,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -2864,6 +3119,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -2894,6 +3152,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -2924,6 +3185,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -2950,6 +3214,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -2976,6 +3243,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getSpaceName() const;
@@ -3002,6 +3272,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getSpaceName() const;
@@ -3028,6 +3301,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getDimensionName() const;
@@ -3058,6 +3334,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getDimensionName() const;
@@ -3088,6 +3367,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -3118,6 +3400,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -3144,6 +3429,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -3170,6 +3458,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getTransportationName() const;
@@ -3196,6 +3487,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getTransportationName() const;
@@ -3222,6 +3516,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getOrderingName() const;
@@ -3248,6 +3545,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getOrderingName() const;
@@ -3338,6 +3638,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const bool& getMultiple() const;
@@ -3384,6 +3687,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getObjectName() const;
@@ -3419,6 +3725,7 @@ class CERTI_EXPORT M_Factory {
     public:
         static Message* create(M_Type type) throw (NetworkError ,NetworkSignal); 
         static Message* receive(MStreamType stream) throw (NetworkError ,NetworkSignal); 
+        static Message* receive(MStreamType stream, libhla::MessageBuffer& msgBuffer) throw (NetworkError ,NetworkSignal); 
     protected:
     private:
 };
@@ -251,6 +251,11 @@ public:
 	 */
     virtual void deserialize(MessageBuffer& msgBuffer);
 
+    /**
+	 * Number of bytes serialize() will write
+	 */
+    virtual uint32_t serializedSize() const;
+
     /**
 	 * Send a serialized message on a socket.
 	 * @param[in] socket the socket that should be used to send the message
@@ -265,6 +270,14 @@ public:
 	 */
     void receive(SocketUN* socket, MessageBuffer& msgBuffer);
 
+    /**
+	 * Receive the raw bytes of the next message from the socket,
+	 * ready to be deserialized.
+	 * @param[in] socket the socket used to received the message from
+	 * @param[out] msgBuffer the buffer were the read message will be written
+	 */
+    static void receiveBuffer(SocketUN* socket, MessageBuffer& msgBuffer);
+
     void setException(const Exception::Type, const std::string& the_reason = "");
     Exception::Type getExceptionType() const
     {
@@ -232,6 +232,19 @@ void Message::serialize(MessageBuffer& msgBuffer)
     Debug(G, pdGendoc) << "exit Message::serialize" << std::endl;
 } /* end of serialize */
 
+uint32_t Message::serializedSize() const
+{
+    /* type and exception */
+    uint32_t size = 4 + 4;
+    if (exception != Exception::Type::NO_EXCEPTION) {
+        size += 4 + exceptionReason.size();
+    }
+    else {
+        size += BasicMessage::serializedSize();
+    }
+    return size;
+} /* end of serializedSize */
+
 void Message::deserialize(MessageBuffer& msgBuffer)
 {
     Debug(G, pdGendoc) << "enter Message::deserialize" << std::endl;
@@ -254,8 +267,9 @@ void Message::deserialize(MessageBuffer& msgBuffer)
 void Message::send(SocketUN* socket, MessageBuffer& msgBuffer)
 {
     Debug(G, pdGendoc) << "enter Message::send" << std::endl;
-    /* 0- reset send buffer */
+    /* 0- reset send buffer and size it once for the whole message */
     msgBuffer.reset();
+    msgBuffer.resize(msgBuffer.reservedBytes + serializedSize());
     /* 1- serialize the message
 	 * This is a polymorphic call
 	 * which may specialized in a daughter class
@@ -274,6 +288,17 @@ void Message::send(SocketUN* socket, MessageBuffer& msgBuffer)
 void Message::receive(SocketUN* socket, MessageBuffer& msgBuffer)
 {
     Debug(G, pdGendoc) << "enter Message::receive" << std::endl;
+    receiveBuffer(socket, msgBuffer);
+    /* deserialize the message
+	 * This is a polymorphic call
+	 * which may specialized in a daughter class
+	 */
+    deserialize(msgBuffer);
+    Debug(G, pdGendoc) << "exit  Message::receive" << std::endl;
+} /* end of receive */
+
+void Message::receiveBuffer(SocketUN* socket, MessageBuffer& msgBuffer)
+{
     /* 0- Reset receive buffer */
     /* FIXME this reset may not be necessary since we do
 	 * raw-receive + assume-size
@@ -290,13 +315,7 @@ void Message::receive(SocketUN* socket, MessageBuffer& msgBuffer)
     /* 3- receive the rest of the message */
     socket->receive(static_cast<const unsigned char*>(msgBuffer(msgBuffer.reservedBytes)),
                     msgBuffer.size() - msgBuffer.reservedBytes);
-    /* 4- deserialize the message
-	 * This is a polymorphic call
-	 * which may specialized in a daughter class
-	 */
-    deserialize(msgBuffer);
-    Debug(G, pdGendoc) << "exit  Message::receive" << std::endl;
-} /* end of receive */
+} /* end of receiveBuffer */
 
 /*
 void
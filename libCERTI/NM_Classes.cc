@@ -1,4 +1,4 @@
-// Generated on 2018 April Fri, 13 at 11:41:23 by the CERTI message generator
+// Generated on 2026 October Mon, 19 at 13:21:58 by the CERTI message generator
 #include <string>
 #include <vector>
 #include "NM_Classes.hh"
@@ -41,6 +41,15 @@ void NM_FOM_Dimension::deserialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.read_string(name);
 }
 
+uint32_t NM_FOM_Dimension::serializedSize() const
+{
+    uint32_t size = 0;
+    // Specific fields
+    size += 4;
+    size += 4 + name.size();
+    return size;
+}
+
 const DimensionHandle& NM_FOM_Dimension::getHandle() const
 {
     return handle;
@@ -97,6 +106,19 @@ void NM_FOM_Routing_Space::deserialize(libhla::MessageBuffer& msgBuffer)
     }
 }
 
+uint32_t NM_FOM_Routing_Space::serializedSize() const
+{
+    uint32_t size = 0;
+    // Specific fields
+    size += 4;
+    size += 4 + name.size();
+    size += 4;
+    for (const auto& element : dimensions) {
+        size += element.serializedSize();
+    }
+    return size;
+}
+
 const SpaceHandle& NM_FOM_Routing_Space::getSpace() const
 {
     return space;
@@ -189,6 +211,18 @@ void NM_FOM_Attribute::deserialize(libhla::MessageBuffer& msgBuffer)
     transport = static_cast<TransportType>(msgBuffer.read_uint8());
 }
 
+uint32_t NM_FOM_Attribute::serializedSize() const
+{
+    uint32_t size = 0;
+    // Specific fields
+    size += 4;
+    size += 4 + name.size();
+    size += 4;
+    size += 1;
+    size += 1;
+    return size;
+}
+
 const AttributeHandle& NM_FOM_Attribute::getHandle() const
 {
     return handle;
@@ -280,6 +314,20 @@ void NM_FOM_Object_Class::deserialize(libhla::MessageBuffer& msgBuffer)
     }
 }
 
+uint32_t NM_FOM_Object_Class::serializedSize() const
+{
+    uint32_t size = 0;
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 + name.size();
+    size += 4;
+    for (const auto& element : attributes) {
+        size += element.serializedSize();
+    }
+    return size;
+}
+
 const ObjectClassHandle& NM_FOM_Object_Class::getHandle() const
 {
     return handle;
@@ -377,6 +425,15 @@ void NM_FOM_Parameter::deserialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.read_string(name);
 }
 
+uint32_t NM_FOM_Parameter::serializedSize() const
+{
+    uint32_t size = 0;
+    // Specific fields
+    size += 4;
+    size += 4 + name.size();
+    return size;
+}
+
 const ParameterHandle& NM_FOM_Parameter::getHandle() const
 {
     return handle;
@@ -441,6 +498,23 @@ void NM_FOM_Interaction_Class::deserialize(libhla::MessageBuffer& msgBuffer)
     }
 }
 
+uint32_t NM_FOM_Interaction_Class::serializedSize() const
+{
+    uint32_t size = 0;
+    // Specific fields
+    size += 4;
+    size += 4 + name.size();
+    size += 4;
+    size += 4;
+    size += 1;
+    size += 1;
+    size += 4;
+    for (const auto& element : parameters) {
+        size += element.serializedSize();
+    }
+    return size;
+}
+
 const InteractionClassHandle& NM_FOM_Interaction_Class::getInteractionClass() const
 {
     return interactionClass;
@@ -605,12 +679,30 @@ void NM_Create_Federation_Execution::deserialize(libhla::MessageBuffer& msgBuffe
     for (uint32_t i = 0; i < fomModuleDesignatorsSize; ++i) {
         msgBuffer.read_string(fomModuleDesignators[i]);
     }
-    _hasMimDesignator = msgBuffer.read_bool();
+    _hasMimDesignator = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasMimDesignator) {
         msgBuffer.read_string(mimDesignator);
     }
 }
 
+uint32_t NM_Create_Federation_Execution::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + federationExecutionName.size();
+    size += 1;
+    size += 4;
+    for (const auto& element : fomModuleDesignators) {
+        size += 4 + element.size();
+    }
+    size += 1;
+    if (_hasMimDesignator) {
+        size += 4 + mimDesignator.size();
+    }
+    return size;
+}
+
 const std::string& NM_Create_Federation_Execution::getFederationExecutionName() const
 {
     return federationExecutionName;
@@ -724,6 +816,15 @@ void NM_Destroy_Federation_Execution::deserialize(libhla::MessageBuffer& msgBuff
     msgBuffer.read_string(federationName);
 }
 
+uint32_t NM_Destroy_Federation_Execution::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + federationName.size();
+    return size;
+}
+
 const std::string& NM_Destroy_Federation_Execution::getFederationName() const
 {
     return federationName;
@@ -774,6 +875,23 @@ void NM_Join_Federation_Execution::serialize(libhla::MessageBuffer& msgBuffer)
     for (uint32_t i = 0; i < additionalFomModulesSize; ++i) {
         msgBuffer.write_string(additionalFomModules[i]);
     }
+    serializeFOMDescription(msgBuffer);
+    msgBuffer.write_bool(_hasWireFormat);
+    if (_hasWireFormat) {
+        msgBuffer.write_uint32(wireFormat);
+    }
+    msgBuffer.write_bool(_hasMulticastPort);
+    if (_hasMulticastPort) {
+        msgBuffer.write_uint32(multicastPort);
+    }
+    msgBuffer.write_bool(_hasPeerPort);
+    if (_hasPeerPort) {
+        msgBuffer.write_uint32(peerPort);
+    }
+}
+
+void NM_Join_Federation_Execution::serializeFOMDescription(libhla::MessageBuffer& msgBuffer)
+{
     uint32_t routingSpacesSize = routingSpaces.size();
     msgBuffer.write_uint32(routingSpacesSize);
     for (uint32_t i = 0; i < routingSpacesSize; ++i) {
@@ -801,7 +919,7 @@ void NM_Join_Federation_Execution::deserialize(libhla::MessageBuffer& msgBuffer)
     bestEffortAddress = msgBuffer.read_uint32();
     bestEffortPeer = msgBuffer.read_uint32();
     msgBuffer.read_string(federationExecutionName);
-    _hasFederateName = msgBuffer.read_bool();
+    _hasFederateName = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasFederateName) {
         msgBuffer.read_string(federateName);
     }
@@ -827,6 +945,72 @@ void NM_Join_Federation_Execution::deserialize(libhla::MessageBuffer& msgBuffer)
     for (uint32_t i = 0; i < interactionClassesSize; ++i) {
         interactionClasses[i].deserialize(msgBuffer);
     }
+    _hasWireFormat = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
+    if (_hasWireFormat) {
+        wireFormat = msgBuffer.read_uint32();
+    }
+    _hasMulticastPort = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
+    if (_hasMulticastPort) {
+        multicastPort = msgBuffer.read_uint32();
+    }
+    _hasPeerPort = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
+    if (_hasPeerPort) {
+        peerPort = msgBuffer.read_uint32();
+    }
+}
+
+uint32_t NM_Join_Federation_Execution::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4;
+    size += 4;
+    size += 4 + federationExecutionName.size();
+    size += 1;
+    if (_hasFederateName) {
+        size += 4 + federateName.size();
+    }
+    size += 1;
+    size += 4 + federateType.size();
+    size += 4;
+    for (const auto& element : additionalFomModules) {
+        size += 4 + element.size();
+    }
+    size += serializedFOMDescriptionSize();
+    size += 1;
+    if (_hasWireFormat) {
+        size += 4;
+    }
+    size += 1;
+    if (_hasMulticastPort) {
+        size += 4;
+    }
+    size += 1;
+    if (_hasPeerPort) {
+        size += 4;
+    }
+    return size;
+}
+
+uint32_t NM_Join_Federation_Execution::serializedFOMDescriptionSize() const
+{
+    uint32_t size = 0;
+    size += 4;
+    for (const auto& element : routingSpaces) {
+        size += element.serializedSize();
+    }
+    size += 4;
+    for (const auto& element : objectClasses) {
+        size += element.serializedSize();
+    }
+    size += 4;
+    for (const auto& element : interactionClasses) {
+        size += element.serializedSize();
+    }
+    return size;
 }
 
 const int32_t& NM_Join_Federation_Execution::getNumberOfRegulators() const
@@ -1055,6 +1239,54 @@ void NM_Join_Federation_Execution::removeInteractionClasses(uint32_t rank)
     interactionClasses.erase(interactionClasses.begin() + rank);
 }
 
+const uint32_t& NM_Join_Federation_Execution::getWireFormat() const
+{
+    return wireFormat;
+}
+
+void NM_Join_Federation_Execution::setWireFormat(const uint32_t& newWireFormat)
+{
+    _hasWireFormat = true;
+    wireFormat = newWireFormat;
+}
+
+bool NM_Join_Federation_Execution::hasWireFormat() const
+{
+    return _hasWireFormat;
+}
+
+const uint32_t& NM_Join_Federation_Execution::getMulticastPort() const
+{
+    return multicastPort;
+}
+
+void NM_Join_Federation_Execution::setMulticastPort(const uint32_t& newMulticastPort)
+{
+    _hasMulticastPort = true;
+    multicastPort = newMulticastPort;
+}
+
+bool NM_Join_Federation_Execution::hasMulticastPort() const
+{
+    return _hasMulticastPort;
+}
+
+const uint32_t& NM_Join_Federation_Execution::getPeerPort() const
+{
+    return peerPort;
+}
+
+void NM_Join_Federation_Execution::setPeerPort(const uint32_t& newPeerPort)
+{
+    _hasPeerPort = true;
+    peerPort = newPeerPort;
+}
+
+bool NM_Join_Federation_Execution::hasPeerPort() const
+{
+    return _hasPeerPort;
+}
+
 std::ostream& operator<<(std::ostream& os, const NM_Join_Federation_Execution& msg)
 {
     os << "[NM_Join_Federation_Execution - Begin]" << std::endl;
@@ -1090,6 +1322,9 @@ std::ostream& operator<<(std::ostream& os, const NM_Join_Federation_Execution& m
         os << element;
     }
     os << std::endl;
+    os << "  (opt) wireFormat =" << msg.wireFormat << std::endl;
+    os << "  (opt) multicastPort =" << msg.multicastPort << std::endl;
+    os << "  (opt) peerPort =" << msg.peerPort << std::endl;
     
     os << "[NM_Join_Federation_Execution - End]" << std::endl;
     return os;
@@ -1145,6 +1380,26 @@ void NM_Additional_Fom_Module::deserialize(libhla::MessageBuffer& msgBuffer)
     }
 }
 
+uint32_t NM_Additional_Fom_Module::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    for (const auto& element : routingSpaces) {
+        size += element.serializedSize();
+    }
+    size += 4;
+    for (const auto& element : objectClasses) {
+        size += element.serializedSize();
+    }
+    size += 4;
+    for (const auto& element : interactionClasses) {
+        size += element.serializedSize();
+    }
+    return size;
+}
+
 uint32_t NM_Additional_Fom_Module::getRoutingSpacesSize() const
 {
     return routingSpaces.size();
@@ -1305,6 +1560,15 @@ void NM_Set_Time_Regulating::deserialize(libhla::MessageBuffer& msgBuffer)
     regulator = msgBuffer.read_bool();
 }
 
+uint32_t NM_Set_Time_Regulating::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 1;
+    return size;
+}
+
 void NM_Set_Time_Regulating::regulatorOn()
 {
     regulator = true;
@@ -1355,6 +1619,15 @@ void NM_Set_Time_Constrained::deserialize(libhla::MessageBuffer& msgBuffer)
     constrained = msgBuffer.read_bool();
 }
 
+uint32_t NM_Set_Time_Constrained::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 1;
+    return size;
+}
+
 void NM_Set_Time_Constrained::constrainedOn()
 {
     constrained = true;
@@ -1417,6 +1690,15 @@ void NM_Set_Class_Relevance_Advisory_Switch::deserialize(libhla::MessageBuffer&
     classRelevanceAdvisorySwitch = msgBuffer.read_bool();
 }
 
+uint32_t NM_Set_Class_Relevance_Advisory_Switch::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 1;
+    return size;
+}
+
 void NM_Set_Class_Relevance_Advisory_Switch::classRelevanceAdvisorySwitchOn()
 {
     classRelevanceAdvisorySwitch = true;
@@ -1467,6 +1749,15 @@ void NM_Set_Interaction_Relevance_Advisory_Switch::deserialize(libhla::MessageBu
     interactionRelevanceAdvisorySwitch = msgBuffer.read_bool();
 }
 
+uint32_t NM_Set_Interaction_Relevance_Advisory_Switch::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 1;
+    return size;
+}
+
 void NM_Set_Interaction_Relevance_Advisory_Switch::interactionRelevanceAdvisorySwitchOn()
 {
     interactionRelevanceAdvisorySwitch = true;
@@ -1517,6 +1808,15 @@ void NM_Set_Attribute_Relevance_Advisory_Switch::deserialize(libhla::MessageBuff
     attributeRelevanceAdvisorySwitch = msgBuffer.read_bool();
 }
 
+uint32_t NM_Set_Attribute_Relevance_Advisory_Switch::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 1;
+    return size;
+}
+
 void NM_Set_Attribute_Relevance_Advisory_Switch::attributeRelevanceAdvisorySwitchOn()
 {
     attributeRelevanceAdvisorySwitch = true;
@@ -1567,6 +1867,15 @@ void NM_Set_Attribute_Scope_Advisory_Switch::deserialize(libhla::MessageBuffer&
     attributeScopeAdvisorySwitch = msgBuffer.read_bool();
 }
 
+uint32_t NM_Set_Attribute_Scope_Advisory_Switch::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 1;
+    return size;
+}
+
 void NM_Set_Attribute_Scope_Advisory_Switch::attributeScopeAdvisorySwitchOn()
 {
     attributeScopeAdvisorySwitch = true;
@@ -1609,9 +1918,7 @@ void NM_Register_Federation_Synchronization_Point::serialize(libhla::MessageBuff
     msgBuffer.write_bool(exists);
     uint32_t federatesSize = federates.size();
     msgBuffer.write_uint32(federatesSize);
-    for (uint32_t i = 0; i < federatesSize; ++i) {
-        msgBuffer.write_uint32(federates[i]);
-    }
+    msgBuffer.write_uint32s(federates.data(), federatesSize);
 }
 
 void NM_Register_Federation_Synchronization_Point::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -1622,9 +1929,18 @@ void NM_Register_Federation_Synchronization_Point::deserialize(libhla::MessageBu
     exists = msgBuffer.read_bool();
     uint32_t federatesSize = msgBuffer.read_uint32();
     federates.resize(federatesSize);
-    for (uint32_t i = 0; i < federatesSize; ++i) {
-        federates[i] = static_cast<FederateHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(federates.data(), federatesSize);
+}
+
+uint32_t NM_Register_Federation_Synchronization_Point::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 1;
+    size += 4;
+    size += 4 * federates.size();
+    return size;
 }
 
 const bool& NM_Register_Federation_Synchronization_Point::getExists() const
@@ -1714,12 +2030,25 @@ void NM_Confirm_Synchronization_Point_Registration::deserialize(libhla::MessageB
     Super::deserialize(msgBuffer);
     // Specific deserialization code
     successIndicator = msgBuffer.read_bool();
-    _hasFailureReason = msgBuffer.read_bool();
+    _hasFailureReason = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasFailureReason) {
         msgBuffer.read_string(failureReason);
     }
 }
 
+uint32_t NM_Confirm_Synchronization_Point_Registration::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 1;
+    size += 1;
+    if (_hasFailureReason) {
+        size += 4 + failureReason.size();
+    }
+    return size;
+}
+
 const bool& NM_Confirm_Synchronization_Point_Registration::getSuccessIndicator() const
 {
     return successIndicator;
@@ -1888,9 +2217,7 @@ void NM_Publish_Object_Class::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(objectClass);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void NM_Publish_Object_Class::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -1901,9 +2228,18 @@ void NM_Publish_Object_Class::deserialize(libhla::MessageBuffer& msgBuffer)
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t NM_Publish_Object_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectClassHandle& NM_Publish_Object_Class::getObjectClass() const
@@ -1997,6 +2333,15 @@ void NM_Publish_Interaction_Class::deserialize(libhla::MessageBuffer& msgBuffer)
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t NM_Publish_Interaction_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const InteractionClassHandle& NM_Publish_Interaction_Class::getInteractionClass() const
 {
     return interactionClass;
@@ -2040,8 +2385,10 @@ void NM_Subscribe_Object_Class::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(objectClass);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
+    msgBuffer.write_bool(_hasMulticast);
+    if (_hasMulticast) {
+        msgBuffer.write_bool(multicast);
     }
 }
 
@@ -2053,9 +2400,26 @@ void NM_Subscribe_Object_Class::deserialize(libhla::MessageBuffer& msgBuffer)
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+    _hasMulticast = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
+    if (_hasMulticast) {
+        multicast = msgBuffer.read_bool();
+    }
+}
+
+uint32_t NM_Subscribe_Object_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    size += 1;
+    if (_hasMulticast) {
+        size += 1;
     }
+    return size;
 }
 
 const ObjectClassHandle& NM_Subscribe_Object_Class::getObjectClass() const
@@ -2103,6 +2467,22 @@ void NM_Subscribe_Object_Class::removeAttributes(uint32_t rank)
     attributes.erase(attributes.begin() + rank);
 }
 
+const bool& NM_Subscribe_Object_Class::getMulticast() const
+{
+    return multicast;
+}
+
+void NM_Subscribe_Object_Class::setMulticast(const bool& newMulticast)
+{
+    _hasMulticast = true;
+    multicast = newMulticast;
+}
+
+bool NM_Subscribe_Object_Class::hasMulticast() const
+{
+    return _hasMulticast;
+}
+
 std::ostream& operator<<(std::ostream& os, const NM_Subscribe_Object_Class& msg)
 {
     os << "[NM_Subscribe_Object_Class - Begin]" << std::endl;
@@ -2116,6 +2496,7 @@ std::ostream& operator<<(std::ostream& os, const NM_Subscribe_Object_Class& msg)
         os << element;
     }
     os << std::endl;
+    os << "  (opt) multicast =" << msg.multicast << std::endl;
     
     os << "[NM_Subscribe_Object_Class - End]" << std::endl;
     return os;
@@ -2133,6 +2514,69 @@ NM_Subscribe_Interaction_Class::NM_Subscribe_Interaction_Class()
     this->type = NetworkMessage::Type::SUBSCRIBE_INTERACTION_CLASS;
 }
 
+void NM_Subscribe_Interaction_Class::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_bool(_hasMulticast);
+    if (_hasMulticast) {
+        msgBuffer.write_bool(multicast);
+    }
+}
+
+void NM_Subscribe_Interaction_Class::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    _hasMulticast = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
+    if (_hasMulticast) {
+        multicast = msgBuffer.read_bool();
+    }
+}
+
+uint32_t NM_Subscribe_Interaction_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 1;
+    if (_hasMulticast) {
+        size += 1;
+    }
+    return size;
+}
+
+const bool& NM_Subscribe_Interaction_Class::getMulticast() const
+{
+    return multicast;
+}
+
+void NM_Subscribe_Interaction_Class::setMulticast(const bool& newMulticast)
+{
+    _hasMulticast = true;
+    multicast = newMulticast;
+}
+
+bool NM_Subscribe_Interaction_Class::hasMulticast() const
+{
+    return _hasMulticast;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Subscribe_Interaction_Class& msg)
+{
+    os << "[NM_Subscribe_Interaction_Class - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Subscribe_Interaction_Class::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  (opt) multicast =" << msg.multicast << std::endl;
+    
+    os << "[NM_Subscribe_Interaction_Class - End]" << std::endl;
+    return os;
+}
+
 NM_Unsubscribe_Interaction_Class::NM_Unsubscribe_Interaction_Class()
 {
     this->messageName = "NM_Unsubscribe_Interaction_Class";
@@ -2176,13 +2620,27 @@ void NM_Register_Object::deserialize(libhla::MessageBuffer& msgBuffer)
     Super::deserialize(msgBuffer);
     // Specific deserialization code
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
-    _hasObjectName = msgBuffer.read_bool();
+    _hasObjectName = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasObjectName) {
         msgBuffer.read_string(objectName);
     }
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t NM_Register_Object::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 1;
+    if (_hasObjectName) {
+        size += 4 + objectName.size();
+    }
+    size += 4;
+    return size;
+}
+
 const ObjectClassHandle& NM_Register_Object::getObjectClass() const
 {
     return objectClass;
@@ -2258,6 +2716,16 @@ void NM_Discover_Object::deserialize(libhla::MessageBuffer& msgBuffer)
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t NM_Discover_Object::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const ObjectClassHandle& NM_Discover_Object::getObjectClass() const
 {
     return objectClass;
@@ -2306,19 +2774,21 @@ void NM_Update_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     uint32_t valuesSize = values.size();
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
         msgBuffer.write_uint32(values[i].size());
-        msgBuffer.write_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.write_bytes(values[i].data(), values[i].size());
     }
     msgBuffer.write_bool(_hasEvent);
     if (_hasEvent) {
             }
+    msgBuffer.write_bool(_hasSequence);
+    if (_hasSequence) {
+        msgBuffer.write_uint32(sequence);
+    }
 }
 
 void NM_Update_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -2329,19 +2799,41 @@ void NM_Update_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
-        msgBuffer.read_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.read_bytes(values[i].data(), values[i].size());
     }
-    _hasEvent = msgBuffer.read_bool();
+    _hasEvent = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasEvent) {
             }
+    _hasSequence = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
+    if (_hasSequence) {
+        sequence = msgBuffer.read_uint32();
+    }
+}
+
+uint32_t NM_Update_Attribute_Values::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    size += 4;
+    for (const auto& element : values) {
+        size += 4 + element.size();
+    }
+    size += 1;
+    size += 1;
+    if (_hasSequence) {
+        size += 4;
+    }
+    return size;
 }
 
 const ObjectHandle& NM_Update_Attribute_Values::getObject() const
@@ -2440,6 +2932,22 @@ bool NM_Update_Attribute_Values::hasEvent() const
     return _hasEvent;
 }
 
+const uint32_t& NM_Update_Attribute_Values::getSequence() const
+{
+    return sequence;
+}
+
+void NM_Update_Attribute_Values::setSequence(const uint32_t& newSequence)
+{
+    _hasSequence = true;
+    sequence = newSequence;
+}
+
+bool NM_Update_Attribute_Values::hasSequence() const
+{
+    return _hasSequence;
+}
+
 std::ostream& operator<<(std::ostream& os, const NM_Update_Attribute_Values& msg)
 {
     os << "[NM_Update_Attribute_Values - Begin]" << std::endl;
@@ -2460,6 +2968,7 @@ std::ostream& operator<<(std::ostream& os, const NM_Update_Attribute_Values& msg
     }
     os << std::endl;
     os << "  (opt) event =" << "// TODO field <event> of type <EventRetractionHandle>" << std::endl;
+    os << "  (opt) sequence =" << msg.sequence << std::endl;
     
     os << "[NM_Update_Attribute_Values - End]" << std::endl;
     return os;
@@ -2479,19 +2988,29 @@ void NM_Reflect_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     uint32_t valuesSize = values.size();
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
         msgBuffer.write_uint32(values[i].size());
-        msgBuffer.write_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.write_bytes(values[i].data(), values[i].size());
     }
     msgBuffer.write_bool(_hasEvent);
     if (_hasEvent) {
             }
+    msgBuffer.write_bool(_hasMulticastClass);
+    if (_hasMulticastClass) {
+        msgBuffer.write_uint32(multicastClass);
+    }
+    msgBuffer.write_bool(_hasPeer);
+    if (_hasPeer) {
+        msgBuffer.write_bool(peer);
+    }
+    msgBuffer.write_bool(_hasSequence);
+    if (_hasSequence) {
+        msgBuffer.write_uint32(sequence);
+    }
 }
 
 void NM_Reflect_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -2502,19 +3021,57 @@ void NM_Reflect_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
-        msgBuffer.read_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.read_bytes(values[i].data(), values[i].size());
     }
-    _hasEvent = msgBuffer.read_bool();
+    _hasEvent = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasEvent) {
             }
+    _hasMulticastClass = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
+    if (_hasMulticastClass) {
+        multicastClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
+    }
+    _hasPeer = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
+    if (_hasPeer) {
+        peer = msgBuffer.read_bool();
+    }
+    _hasSequence = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
+    if (_hasSequence) {
+        sequence = msgBuffer.read_uint32();
+    }
+}
+
+uint32_t NM_Reflect_Attribute_Values::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    size += 4;
+    for (const auto& element : values) {
+        size += 4 + element.size();
+    }
+    size += 1;
+    size += 1;
+    if (_hasMulticastClass) {
+        size += 4;
+    }
+    size += 1;
+    if (_hasPeer) {
+        size += 1;
+    }
+    size += 1;
+    if (_hasSequence) {
+        size += 4;
+    }
+    return size;
 }
 
 const ObjectHandle& NM_Reflect_Attribute_Values::getObject() const
@@ -2613,6 +3170,54 @@ bool NM_Reflect_Attribute_Values::hasEvent() const
     return _hasEvent;
 }
 
+const ObjectClassHandle& NM_Reflect_Attribute_Values::getMulticastClass() const
+{
+    return multicastClass;
+}
+
+void NM_Reflect_Attribute_Values::setMulticastClass(const ObjectClassHandle& newMulticastClass)
+{
+    _hasMulticastClass = true;
+    multicastClass = newMulticastClass;
+}
+
+bool NM_Reflect_Attribute_Values::hasMulticastClass() const
+{
+    return _hasMulticastClass;
+}
+
+const bool& NM_Reflect_Attribute_Values::getPeer() const
+{
+    return peer;
+}
+
+void NM_Reflect_Attribute_Values::setPeer(const bool& newPeer)
+{
+    _hasPeer = true;
+    peer = newPeer;
+}
+
+bool NM_Reflect_Attribute_Values::hasPeer() const
+{
+    return _hasPeer;
+}
+
+const uint32_t& NM_Reflect_Attribute_Values::getSequence() const
+{
+    return sequence;
+}
+
+void NM_Reflect_Attribute_Values::setSequence(const uint32_t& newSequence)
+{
+    _hasSequence = true;
+    sequence = newSequence;
+}
+
+bool NM_Reflect_Attribute_Values::hasSequence() const
+{
+    return _hasSequence;
+}
+
 std::ostream& operator<<(std::ostream& os, const NM_Reflect_Attribute_Values& msg)
 {
     os << "[NM_Reflect_Attribute_Values - Begin]" << std::endl;
@@ -2633,6 +3238,9 @@ std::ostream& operator<<(std::ostream& os, const NM_Reflect_Attribute_Values& ms
     }
     os << std::endl;
     os << "  (opt) event =" << "// TODO field <event> of type <EventRetractionHandle>" << std::endl;
+    os << "  (opt) multicastClass =" << msg.multicastClass << std::endl;
+    os << "  (opt) peer =" << msg.peer << std::endl;
+    os << "  (opt) sequence =" << msg.sequence << std::endl;
     
     os << "[NM_Reflect_Attribute_Values - End]" << std::endl;
     return os;
@@ -2652,15 +3260,13 @@ void NM_Send_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(interactionClass);
     uint32_t parametersSize = parameters.size();
     msgBuffer.write_uint32(parametersSize);
-    for (uint32_t i = 0; i < parametersSize; ++i) {
-        msgBuffer.write_uint32(parameters[i]);
-    }
+    msgBuffer.write_uint32s(parameters.data(), parametersSize);
     uint32_t valuesSize = values.size();
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
         msgBuffer.write_uint32(values[i].size());
-        msgBuffer.write_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.write_bytes(values[i].data(), values[i].size());
     }
     msgBuffer.write_uint32(region);
 }
@@ -2673,19 +3279,33 @@ void NM_Send_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
     uint32_t parametersSize = msgBuffer.read_uint32();
     parameters.resize(parametersSize);
-    for (uint32_t i = 0; i < parametersSize; ++i) {
-        parameters[i] = static_cast<ParameterHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(parameters.data(), parametersSize);
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
-        msgBuffer.read_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.read_bytes(values[i].data(), values[i].size());
     }
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t NM_Send_Interaction::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * parameters.size();
+    size += 4;
+    for (const auto& element : values) {
+        size += 4 + element.size();
+    }
+    size += 4;
+    return size;
+}
+
 const InteractionClassHandle& NM_Send_Interaction::getInteractionClass() const
 {
     return interactionClass;
@@ -2815,19 +3435,21 @@ void NM_Receive_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(interactionClass);
     uint32_t parametersSize = parameters.size();
     msgBuffer.write_uint32(parametersSize);
-    for (uint32_t i = 0; i < parametersSize; ++i) {
-        msgBuffer.write_uint32(parameters[i]);
-    }
+    msgBuffer.write_uint32s(parameters.data(), parametersSize);
     uint32_t valuesSize = values.size();
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
         msgBuffer.write_uint32(values[i].size());
-        msgBuffer.write_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.write_bytes(values[i].data(), values[i].size());
     }
     msgBuffer.write_bool(_hasEvent);
     if (_hasEvent) {
             }
+    msgBuffer.write_bool(_hasMulticast);
+    if (_hasMulticast) {
+        msgBuffer.write_bool(multicast);
+    }
 }
 
 void NM_Receive_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -2838,19 +3460,41 @@ void NM_Receive_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
     uint32_t parametersSize = msgBuffer.read_uint32();
     parameters.resize(parametersSize);
-    for (uint32_t i = 0; i < parametersSize; ++i) {
-        parameters[i] = static_cast<ParameterHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(parameters.data(), parametersSize);
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
-        msgBuffer.read_bytes(&(values[i][0]),values[i].size());
+        msgBuffer.read_bytes(values[i].data(), values[i].size());
     }
-    _hasEvent = msgBuffer.read_bool();
+    _hasEvent = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasEvent) {
             }
+    _hasMulticast = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
+    if (_hasMulticast) {
+        multicast = msgBuffer.read_bool();
+    }
+}
+
+uint32_t NM_Receive_Interaction::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * parameters.size();
+    size += 4;
+    for (const auto& element : values) {
+        size += 4 + element.size();
+    }
+    size += 1;
+    size += 1;
+    if (_hasMulticast) {
+        size += 1;
+    }
+    return size;
 }
 
 const InteractionClassHandle& NM_Receive_Interaction::getInteractionClass() const
@@ -2940,13 +3584,29 @@ const EventRetractionHandle& NM_Receive_Interaction::getEvent() const
 
 void NM_Receive_Interaction::setEvent(const EventRetractionHandle& newEvent)
 {
-    _hasEvent = true;
-    event = newEvent;
+    _hasEvent = true;
+    event = newEvent;
+}
+
+bool NM_Receive_Interaction::hasEvent() const
+{
+    return _hasEvent;
+}
+
+const bool& NM_Receive_Interaction::getMulticast() const
+{
+    return multicast;
+}
+
+void NM_Receive_Interaction::setMulticast(const bool& newMulticast)
+{
+    _hasMulticast = true;
+    multicast = newMulticast;
 }
 
-bool NM_Receive_Interaction::hasEvent() const
+bool NM_Receive_Interaction::hasMulticast() const
 {
-    return _hasEvent;
+    return _hasMulticast;
 }
 
 std::ostream& operator<<(std::ostream& os, const NM_Receive_Interaction& msg)
@@ -2969,6 +3629,7 @@ std::ostream& operator<<(std::ostream& os, const NM_Receive_Interaction& msg)
     }
     os << std::endl;
     os << "  (opt) event =" << "// TODO field <event> of type <EventRetractionHandle>" << std::endl;
+    os << "  (opt) multicast =" << msg.multicast << std::endl;
     
     os << "[NM_Receive_Interaction - End]" << std::endl;
     return os;
@@ -2997,11 +3658,21 @@ void NM_Delete_Object::deserialize(libhla::MessageBuffer& msgBuffer)
     Super::deserialize(msgBuffer);
     // Specific deserialization code
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    _hasEvent = msgBuffer.read_bool();
+    _hasEvent = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasEvent) {
             }
 }
 
+uint32_t NM_Delete_Object::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 1;
+    return size;
+}
+
 const ObjectHandle& NM_Delete_Object::getObject() const
 {
     return object;
@@ -3067,11 +3738,22 @@ void NM_Remove_Object::deserialize(libhla::MessageBuffer& msgBuffer)
     // Specific deserialization code
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
-    _hasEvent = msgBuffer.read_bool();
+    _hasEvent = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasEvent) {
             }
 }
 
+uint32_t NM_Remove_Object::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 1;
+    return size;
+}
+
 const ObjectHandle& NM_Remove_Object::getObject() const
 {
     return object;
@@ -3137,9 +3819,7 @@ void NM_Change_Attribute_Transport_Type::serialize(libhla::MessageBuffer& msgBuf
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     msgBuffer.write_uint8(transport);
 }
 
@@ -3151,12 +3831,22 @@ void NM_Change_Attribute_Transport_Type::deserialize(libhla::MessageBuffer& msgB
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     transport = static_cast<TransportType>(msgBuffer.read_uint8());
 }
 
+uint32_t NM_Change_Attribute_Transport_Type::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    size += 1;
+    return size;
+}
+
 const ObjectHandle& NM_Change_Attribute_Transport_Type::getObject() const
 {
     return object;
@@ -3245,9 +3935,7 @@ void NM_Change_Attribute_Order_Type::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     msgBuffer.write_uint8(order);
 }
 
@@ -3259,12 +3947,22 @@ void NM_Change_Attribute_Order_Type::deserialize(libhla::MessageBuffer& msgBuffe
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     order = static_cast<OrderType>(msgBuffer.read_uint8());
 }
 
+uint32_t NM_Change_Attribute_Order_Type::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    size += 1;
+    return size;
+}
+
 const ObjectHandle& NM_Change_Attribute_Order_Type::getObject() const
 {
     return object;
@@ -3363,6 +4061,16 @@ void NM_Change_Interaction_Transport_Type::deserialize(libhla::MessageBuffer& ms
     transport = static_cast<TransportType>(msgBuffer.read_uint8());
 }
 
+uint32_t NM_Change_Interaction_Transport_Type::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 1;
+    return size;
+}
+
 const InteractionClassHandle& NM_Change_Interaction_Transport_Type::getInteractionClass() const
 {
     return interactionClass;
@@ -3421,6 +4129,16 @@ void NM_Change_Interaction_Order_Type::deserialize(libhla::MessageBuffer& msgBuf
     order = static_cast<OrderType>(msgBuffer.read_uint8());
 }
 
+uint32_t NM_Change_Interaction_Order_Type::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 1;
+    return size;
+}
+
 const InteractionClassHandle& NM_Change_Interaction_Order_Type::getInteractionClass() const
 {
     return interactionClass;
@@ -3469,9 +4187,7 @@ void NM_Request_Class_Attribute_Value_Update::serialize(libhla::MessageBuffer& m
     msgBuffer.write_uint32(objectClass);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void NM_Request_Class_Attribute_Value_Update::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -3482,9 +4198,18 @@ void NM_Request_Class_Attribute_Value_Update::deserialize(libhla::MessageBuffer&
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t NM_Request_Class_Attribute_Value_Update::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectClassHandle& NM_Request_Class_Attribute_Value_Update::getObjectClass() const
@@ -3564,9 +4289,7 @@ void NM_Request_Object_Attribute_Value_Update::serialize(libhla::MessageBuffer&
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void NM_Request_Object_Attribute_Value_Update::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -3577,9 +4300,18 @@ void NM_Request_Object_Attribute_Value_Update::deserialize(libhla::MessageBuffer
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t NM_Request_Object_Attribute_Value_Update::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& NM_Request_Object_Attribute_Value_Update::getObject() const
@@ -3669,6 +4401,16 @@ void NM_Is_Attribute_Owned_By_Federate::deserialize(libhla::MessageBuffer& msgBu
     attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t NM_Is_Attribute_Owned_By_Federate::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const ObjectHandle& NM_Is_Attribute_Owned_By_Federate::getObject() const
 {
     return object;
@@ -3727,6 +4469,16 @@ void NM_Query_Attribute_Ownership::deserialize(libhla::MessageBuffer& msgBuffer)
     attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t NM_Query_Attribute_Ownership::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const ObjectHandle& NM_Query_Attribute_Ownership::getObject() const
 {
     return object;
@@ -3785,6 +4537,16 @@ void NM_Attribute_Is_Not_Owned::deserialize(libhla::MessageBuffer& msgBuffer)
     attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t NM_Attribute_Is_Not_Owned::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const ObjectHandle& NM_Attribute_Is_Not_Owned::getObject() const
 {
     return object;
@@ -3843,6 +4605,16 @@ void NM_Inform_Attribute_Ownership::deserialize(libhla::MessageBuffer& msgBuffer
     attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t NM_Inform_Attribute_Ownership::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    return size;
+}
+
 const ObjectHandle& NM_Inform_Attribute_Ownership::getObject() const
 {
     return object;
@@ -3891,9 +4663,7 @@ void NM_Attribute_Ownership_Base::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
 }
 
 void NM_Attribute_Ownership_Base::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -3904,9 +4674,18 @@ void NM_Attribute_Ownership_Base::deserialize(libhla::MessageBuffer& msgBuffer)
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
+}
+
+uint32_t NM_Attribute_Ownership_Base::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    return size;
 }
 
 const ObjectHandle& NM_Attribute_Ownership_Base::getObject() const
@@ -4063,9 +4842,7 @@ void NM_DDM_Create_Region::serialize(libhla::MessageBuffer& msgBuffer)
     // Specific serialization code
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     msgBuffer.write_bool(DDM_bool);
     msgBuffer.write_uint32(space);
     msgBuffer.write_uint32(region);
@@ -4079,15 +4856,27 @@ void NM_DDM_Create_Region::deserialize(libhla::MessageBuffer& msgBuffer)
     // Specific deserialization code
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     DDM_bool = msgBuffer.read_bool();
     space = static_cast<SpaceHandle>(msgBuffer.read_uint32());
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
     nbExtents = msgBuffer.read_uint32();
 }
 
+uint32_t NM_DDM_Create_Region::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 * attributes.size();
+    size += 1;
+    size += 4;
+    size += 4;
+    size += 4;
+    return size;
+}
+
 uint32_t NM_DDM_Create_Region::getAttributesSize() const
 {
     return attributes.size();
@@ -4197,9 +4986,7 @@ void NM_DDM_Modify_Region::serialize(libhla::MessageBuffer& msgBuffer)
     // Specific serialization code
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     msgBuffer.write_bool(DDM_bool);
     msgBuffer.write_uint32(region);
 }
@@ -4211,13 +4998,23 @@ void NM_DDM_Modify_Region::deserialize(libhla::MessageBuffer& msgBuffer)
     // Specific deserialization code
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     DDM_bool = msgBuffer.read_bool();
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t NM_DDM_Modify_Region::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 * attributes.size();
+    size += 1;
+    size += 4;
+    return size;
+}
+
 uint32_t NM_DDM_Modify_Region::getAttributesSize() const
 {
     return attributes.size();
@@ -4314,6 +5111,15 @@ void NM_DDM_Delete_Region::deserialize(libhla::MessageBuffer& msgBuffer)
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t NM_DDM_Delete_Region::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const RegionHandle& NM_DDM_Delete_Region::getRegion() const
 {
     return region;
@@ -4350,9 +5156,7 @@ void NM_DDM_Associate_Region::serialize(libhla::MessageBuffer& msgBuffer)
     // Specific serialization code
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     msgBuffer.write_bool(DDM_bool);
     msgBuffer.write_uint32(region);
     msgBuffer.write_uint32(object);
@@ -4365,14 +5169,25 @@ void NM_DDM_Associate_Region::deserialize(libhla::MessageBuffer& msgBuffer)
     // Specific deserialization code
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     DDM_bool = msgBuffer.read_bool();
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t NM_DDM_Associate_Region::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 * attributes.size();
+    size += 1;
+    size += 4;
+    size += 4;
+    return size;
+}
+
 uint32_t NM_DDM_Associate_Region::getAttributesSize() const
 {
     return attributes.size();
@@ -4471,9 +5286,7 @@ void NM_DDM_Unassociate_Region::serialize(libhla::MessageBuffer& msgBuffer)
     // Specific serialization code
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     msgBuffer.write_uint32(region);
     msgBuffer.write_uint32(object);
     msgBuffer.write_bool(DDM_bool);
@@ -4486,14 +5299,25 @@ void NM_DDM_Unassociate_Region::deserialize(libhla::MessageBuffer& msgBuffer)
     // Specific deserialization code
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     DDM_bool = msgBuffer.read_bool();
 }
 
+uint32_t NM_DDM_Unassociate_Region::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4 * attributes.size();
+    size += 4;
+    size += 4;
+    size += 1;
+    return size;
+}
+
 uint32_t NM_DDM_Unassociate_Region::getAttributesSize() const
 {
     return attributes.size();
@@ -4593,9 +5417,7 @@ void NM_DDM_Register_Object::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(objectClass);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     msgBuffer.write_uint32(region);
     msgBuffer.write_bool(_hasObjectInstanceName);
     if (_hasObjectInstanceName) {
@@ -4613,11 +5435,9 @@ void NM_DDM_Register_Object::deserialize(libhla::MessageBuffer& msgBuffer)
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
-    _hasObjectInstanceName = msgBuffer.read_bool();
+    _hasObjectInstanceName = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasObjectInstanceName) {
         msgBuffer.read_string(objectInstanceName);
     }
@@ -4625,6 +5445,24 @@ void NM_DDM_Register_Object::deserialize(libhla::MessageBuffer& msgBuffer)
     DDM_bool = msgBuffer.read_bool();
 }
 
+uint32_t NM_DDM_Register_Object::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    size += 4;
+    size += 1;
+    if (_hasObjectInstanceName) {
+        size += 4 + objectInstanceName.size();
+    }
+    size += 4;
+    size += 1;
+    return size;
+}
+
 const ObjectClassHandle& NM_DDM_Register_Object::getObjectClass() const
 {
     return objectClass;
@@ -4753,9 +5591,7 @@ void NM_DDM_Subscribe_Attributes::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(region);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     msgBuffer.write_bool(DDM_bool);
 }
 
@@ -4768,12 +5604,23 @@ void NM_DDM_Subscribe_Attributes::deserialize(libhla::MessageBuffer& msgBuffer)
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     DDM_bool = msgBuffer.read_bool();
 }
 
+uint32_t NM_DDM_Subscribe_Attributes::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    size += 1;
+    return size;
+}
+
 const ObjectClassHandle& NM_DDM_Subscribe_Attributes::getObjectClass() const
 {
     return objectClass;
@@ -4874,9 +5721,7 @@ void NM_DDM_Unsubscribe_Attributes::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(region);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    msgBuffer.write_uint32s(attributes.data(), attributesSize);
     msgBuffer.write_bool(DDM_bool);
 }
 
@@ -4889,12 +5734,23 @@ void NM_DDM_Unsubscribe_Attributes::deserialize(libhla::MessageBuffer& msgBuffer
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    msgBuffer.read_uint32s(attributes.data(), attributesSize);
     DDM_bool = msgBuffer.read_bool();
 }
 
+uint32_t NM_DDM_Unsubscribe_Attributes::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 4;
+    size += 4 * attributes.size();
+    size += 1;
+    return size;
+}
+
 const ObjectClassHandle& NM_DDM_Unsubscribe_Attributes::getObjectClass() const
 {
     return objectClass;
@@ -5006,6 +5862,17 @@ void NM_DDM_Subscribe_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
     DDM_bool = msgBuffer.read_bool();
 }
 
+uint32_t NM_DDM_Subscribe_Interaction::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    size += 1;
+    return size;
+}
+
 const InteractionClassHandle& NM_DDM_Subscribe_Interaction::getInteractionClass() const
 {
     return interactionClass;
@@ -5085,6 +5952,15 @@ void NM_Start_Registration_For_Object_Class::deserialize(libhla::MessageBuffer&
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t NM_Start_Registration_For_Object_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const ObjectClassHandle& NM_Start_Registration_For_Object_Class::getObjectClass() const
 {
     return objectClass;
@@ -5130,6 +6006,15 @@ void NM_Stop_Registration_For_Object_Class::deserialize(libhla::MessageBuffer& m
     objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
 }
 
+uint32_t NM_Stop_Registration_For_Object_Class::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    return size;
+}
+
 const ObjectClassHandle& NM_Stop_Registration_For_Object_Class::getObjectClass() const
 {
     return objectClass;
@@ -5175,6 +6060,15 @@ void NM_Reserve_Object_Instance_Name::deserialize(libhla::MessageBuffer& msgBuff
     msgBuffer.read_string(objectName);
 }
 
+uint32_t NM_Reserve_Object_Instance_Name::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + objectName.size();
+    return size;
+}
+
 const std::string& NM_Reserve_Object_Instance_Name::getObjectName() const
 {
     return objectName;
@@ -5236,6 +6130,14 @@ void NM_Message_Null_Prime::deserialize(libhla::MessageBuffer& msgBuffer)
     //probably no 'representation' given
 }
 
+uint32_t NM_Message_Null_Prime::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    return size;
+}
+
 const FederationTime& NM_Message_Null_Prime::getTimestamp() const
 {
     return timestamp;
@@ -5259,6 +6161,12 @@ std::ostream& operator<<(std::ostream& os, const NM_Message_Null_Prime& msg)
     return os;
 }
 
+NM_Message_Null_Request::NM_Message_Null_Request()
+{
+    this->messageName = "NM_Message_Null_Request";
+    this->type = NetworkMessage::Type::MESSAGE_NULL_REQUEST;
+}
+
 NM_Enable_Asynchronous_Delivery::NM_Enable_Asynchronous_Delivery()
 {
     this->messageName = "NM_Enable_Asynchronous_Delivery";
@@ -5319,6 +6227,16 @@ void NM_Mom_Status::deserialize(libhla::MessageBuffer& msgBuffer)
     updatePeriod = msgBuffer.read_uint32();
 }
 
+uint32_t NM_Mom_Status::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 1;
+    size += 4;
+    return size;
+}
+
 const bool& NM_Mom_Status::getMomState() const
 {
     return momState;
@@ -5381,6 +6299,18 @@ void NM_Time_State_Update::deserialize(libhla::MessageBuffer& msgBuffer)
     lits = msgBuffer.read_double();
 }
 
+uint32_t NM_Time_State_Update::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 8;
+    size += 1;
+    size += 8;
+    size += 8;
+    return size;
+}
+
 const double& NM_Time_State_Update::getLookahead() const
 {
     return lookahead;
@@ -5437,6 +6367,128 @@ std::ostream& operator<<(std::ostream& os, const NM_Time_State_Update& msg)
     return os;
 }
 
+NM_Peer_Route::NM_Peer_Route()
+{
+    this->messageName = "NM_Peer_Route";
+    this->type = NetworkMessage::Type::PEER_ROUTE;
+}
+
+void NM_Peer_Route::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(peerAddress);
+    msgBuffer.write_uint32(peerPort);
+}
+
+void NM_Peer_Route::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    peerAddress = msgBuffer.read_uint32();
+    peerPort = msgBuffer.read_uint32();
+}
+
+uint32_t NM_Peer_Route::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4;
+    size += 4;
+    return size;
+}
+
+const uint32_t& NM_Peer_Route::getPeerAddress() const
+{
+    return peerAddress;
+}
+
+void NM_Peer_Route::setPeerAddress(const uint32_t& newPeerAddress)
+{
+    peerAddress = newPeerAddress;
+}
+
+const uint32_t& NM_Peer_Route::getPeerPort() const
+{
+    return peerPort;
+}
+
+void NM_Peer_Route::setPeerPort(const uint32_t& newPeerPort)
+{
+    peerPort = newPeerPort;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Peer_Route& msg)
+{
+    os << "[NM_Peer_Route - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Peer_Route::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  peerAddress = " << msg.peerAddress << std::endl;
+    os << "  peerPort = " << msg.peerPort << std::endl;
+    
+    os << "[NM_Peer_Route - End]" << std::endl;
+    return os;
+}
+
+NM_Shm_Rings::NM_Shm_Rings()
+{
+    this->messageName = "NM_Shm_Rings";
+    this->type = NetworkMessage::Type::SHM_RINGS;
+}
+
+void NM_Shm_Rings::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_string(name);
+}
+
+void NM_Shm_Rings::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    msgBuffer.read_string(name);
+}
+
+uint32_t NM_Shm_Rings::serializedSize() const
+{
+    // Call parent class
+    uint32_t size = Super::serializedSize();
+    // Specific fields
+    size += 4 + name.size();
+    return size;
+}
+
+const std::string& NM_Shm_Rings::getName() const
+{
+    return name;
+}
+
+void NM_Shm_Rings::setName(const std::string& newName)
+{
+    name = newName;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Shm_Rings& msg)
+{
+    os << "[NM_Shm_Rings - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Shm_Rings::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  name = " << msg.name << std::endl;
+    
+    os << "[NM_Shm_Rings - End]" << std::endl;
+    return os;
+}
+
 void New_NetworkMessage::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Specific serialization code
@@ -5461,22 +6513,39 @@ void New_NetworkMessage::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Specific deserialization code
     type = msgBuffer.read_uint32();
-    _hasDate = msgBuffer.read_bool();
+    _hasDate = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasDate) {
         // FIXME FIXME FIXME
         //don't know how to deserialize native field <date> of type <FederationTime>
         //probably no 'representation' given
     }
-    _hasLabel = msgBuffer.read_bool();
+    _hasLabel = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasLabel) {
         msgBuffer.read_string(label);
     }
-    _hasTag = msgBuffer.read_bool();
+    _hasTag = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();
     if (_hasTag) {
         msgBuffer.read_string(tag);
     }
 }
 
+uint32_t New_NetworkMessage::serializedSize() const
+{
+    uint32_t size = 0;
+    // Specific fields
+    size += 4;
+    size += 1;
+    size += 1;
+    if (_hasLabel) {
+        size += 4 + label.size();
+    }
+    size += 1;
+    if (_hasTag) {
+        size += 4 + tag.size();
+    }
+    return size;
+}
+
 const uint32_t& New_NetworkMessage::getType() const
 {
     return type;
@@ -5841,6 +6910,9 @@ NetworkMessage* NM_Factory::create(NM_Type type) throw (NetworkError ,NetworkSig
         case NetworkMessage::Type::MESSAGE_NULL_PRIME:
             msg = new NM_Message_Null_Prime();
             break;
+        case NetworkMessage::Type::MESSAGE_NULL_REQUEST:
+            msg = new NM_Message_Null_Request();
+            break;
         case NetworkMessage::Type::ENABLE_ASYNCHRONOUS_DELIVERY:
             msg = new NM_Enable_Asynchronous_Delivery();
             break;
@@ -5865,6 +6937,12 @@ NetworkMessage* NM_Factory::create(NM_Type type) throw (NetworkError ,NetworkSig
         case NetworkMessage::Type::TIME_STATE_UPDATE:
             msg = new NM_Time_State_Update();
             break;
+        case NetworkMessage::Type::PEER_ROUTE:
+            msg = new NM_Peer_Route();
+            break;
+        case NetworkMessage::Type::SHM_RINGS:
+            msg = new NM_Shm_Rings();
+            break;
         case NetworkMessage::Type::LAST:
             throw NetworkError("LAST message type should not be used!!");
             break;
@@ -5873,16 +6951,18 @@ NetworkMessage* NM_Factory::create(NM_Type type) throw (NetworkError ,NetworkSig
 } /* end of NM_Factory::create */
 
 NetworkMessage* NM_Factory::receive(NMStreamType stream) throw (NetworkError ,NetworkSignal) { 
-    // FIXME This is not thread safe
-    static libhla::MessageBuffer msgBuffer;
-    NetworkMessage  msgGen;
-    NetworkMessage* msg;
-
-    // receive generic message 
-    msgGen.receive(stream,msgBuffer);
-    // create specific message from type 
-    msg = NM_Factory::create(msgGen.getMessageType());
-    msgBuffer.assumeSizeFromReservedBytes();
+    // one buffer per thread: links may be read concurrently
+    static thread_local libhla::MessageBuffer msgBuffer;
+    return NM_Factory::receive(stream, msgBuffer);
+} /* end of NM_Factory::receive */
+
+NetworkMessage* NM_Factory::receive(NMStreamType stream, libhla::MessageBuffer& msgBuffer) throw (NetworkError ,NetworkSignal) { 
+    // receive the whole message 
+    NetworkMessage::receiveBuffer(stream, msgBuffer);
+    // peek the type (first field after the header) 
+    NetworkMessage* msg = NM_Factory::create(static_cast<NM_Type>(msgBuffer.read_int32()));
+    // and deserialize once into the specific message 
+    msgBuffer.rewind();
     msg->deserialize(msgBuffer);
     return msg;
 } /* end of NM_Factory::receive */ 
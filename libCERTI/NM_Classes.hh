@@ -1,4 +1,4 @@
-// Generated on 2018 April Fri, 13 at 11:41:23 by the CERTI message generator
+// Generated on 2026 October Mon, 19 at 13:21:58 by the CERTI message generator
 #ifndef NM_CLASSES_HH
 #define NM_CLASSES_HH
 // ****-**** Global System includes ****-****
@@ -67,6 +67,9 @@ public:
     
     void serialize(libhla::MessageBuffer& msgBuffer);
     void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const DimensionHandle& getHandle() const;
@@ -92,6 +95,9 @@ public:
     
     void serialize(libhla::MessageBuffer& msgBuffer);
     void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const SpaceHandle& getSpace() const;
@@ -126,6 +132,9 @@ public:
     
     void serialize(libhla::MessageBuffer& msgBuffer);
     void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const AttributeHandle& getHandle() const;
@@ -163,6 +172,9 @@ public:
     
     void serialize(libhla::MessageBuffer& msgBuffer);
     void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getHandle() const;
@@ -201,6 +213,9 @@ public:
     
     void serialize(libhla::MessageBuffer& msgBuffer);
     void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ParameterHandle& getHandle() const;
@@ -226,6 +241,9 @@ public:
     
     void serialize(libhla::MessageBuffer& msgBuffer);
     void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -292,6 +310,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getFederationExecutionName() const;
@@ -333,6 +354,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getFederationName() const;
@@ -355,6 +379,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const int32_t& getNumberOfRegulators() const;
@@ -414,10 +441,27 @@ public:
     void setInteractionClasses(const NM_FOM_Interaction_Class& newInteractionClasses, uint32_t rank);
     void removeInteractionClasses(uint32_t rank);
     
+    const uint32_t& getWireFormat() const;
+    void setWireFormat(const uint32_t& newWireFormat);
+    bool hasWireFormat() const;
+    
+    const uint32_t& getMulticastPort() const;
+    void setMulticastPort(const uint32_t& newMulticastPort);
+    bool hasMulticastPort() const;
+    
+    const uint32_t& getPeerPort() const;
+    void setPeerPort(const uint32_t& newPeerPort);
+    bool hasPeerPort() const;
+    
     using Super = NetworkMessage;
     friend std::ostream& operator<<(std::ostream& os, const NM_Join_Federation_Execution& msg);
 
 protected:
+    // Serialize the FOMDescription fields, a derived class may write them its own way
+    virtual void serializeFOMDescription(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serializeFOMDescription() with the fixed size encoding
+    virtual uint32_t serializedFOMDescriptionSize() const;
+
     int32_t numberOfRegulators;
     uint32_t multicastAddress;
     uint32_t bestEffortAddress;
@@ -431,6 +475,12 @@ protected:
     std::vector<NM_FOM_Routing_Space> routingSpaces;
     std::vector<NM_FOM_Object_Class> objectClasses;
     std::vector<NM_FOM_Interaction_Class> interactionClasses;
+    uint32_t wireFormat;// highest NetworkMessage::WireFormat the sender reads
+    bool _hasWireFormat {false};
+    uint32_t multicastPort;// port of the multicastAddress groups, when the RTIG uses multicast
+    bool _hasMulticastPort {false};
+    uint32_t peerPort;// port the RTIA accepts the direct updates of the other RTIAs on, answered when the RTIG routes them
+    bool _hasPeerPort {false};
 };
 
 std::ostream& operator<<(std::ostream& os, const NM_Join_Federation_Execution& msg);
@@ -443,6 +493,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     uint32_t getRoutingSpacesSize() const;
@@ -496,6 +549,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     void regulatorOn();
@@ -519,6 +575,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     void constrainedOn();
@@ -558,6 +617,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     void classRelevanceAdvisorySwitchOn();
@@ -581,6 +643,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     void interactionRelevanceAdvisorySwitchOn();
@@ -604,6 +669,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     void attributeRelevanceAdvisorySwitchOn();
@@ -627,6 +695,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     void attributeScopeAdvisorySwitchOn();
@@ -650,6 +721,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const bool& getExists() const;
@@ -682,6 +756,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const bool& getSuccessIndicator() const;
@@ -862,6 +939,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -901,6 +981,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -931,6 +1014,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -944,12 +1030,18 @@ public:
     void setAttributes(const AttributeHandle& newAttributes, uint32_t rank);
     void removeAttributes(uint32_t rank);
     
+    const bool& getMulticast() const;
+    void setMulticast(const bool& newMulticast);
+    bool hasMulticast() const;
+    
     using Super = NetworkMessage;
     friend std::ostream& operator<<(std::ostream& os, const NM_Subscribe_Object_Class& msg);
 
 protected:
     ObjectClassHandle objectClass;
     std::vector<AttributeHandle> attributes;
+    bool multicast;// the RTIA joined the multicast group of the class
+    bool _hasMulticast {false};
 };
 
 std::ostream& operator<<(std::ostream& os, const NM_Subscribe_Object_Class& msg);
@@ -968,8 +1060,27 @@ public:
     NM_Subscribe_Interaction_Class();
     virtual ~NM_Subscribe_Interaction_Class() = default;
     
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
+
+    // Attributes accessors and mutators
+    const bool& getMulticast() const;
+    void setMulticast(const bool& newMulticast);
+    bool hasMulticast() const;
+    
+    using Super = NM_Publish_Interaction_Class;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Subscribe_Interaction_Class& msg);
+
+protected:
+    bool multicast;// the RTIA joined the multicast group of the class
+    bool _hasMulticast {false};
 };
 
+std::ostream& operator<<(std::ostream& os, const NM_Subscribe_Interaction_Class& msg);
+
 
 class CERTI_EXPORT NM_Unsubscribe_Interaction_Class : public NM_Publish_Interaction_Class {
 public:
@@ -1002,6 +1113,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -1034,6 +1148,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -1060,6 +1177,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1085,6 +1205,10 @@ public:
     void setEvent(const EventRetractionHandle& newEvent);
     bool hasEvent() const;
     
+    const uint32_t& getSequence() const;
+    void setSequence(const uint32_t& newSequence);
+    bool hasSequence() const;
+    
     using Super = NetworkMessage;
     friend std::ostream& operator<<(std::ostream& os, const NM_Update_Attribute_Values& msg);
 
@@ -1094,6 +1218,8 @@ protected:
     std::vector<AttributeValue_t> values;
     EventRetractionHandle event;
     bool _hasEvent {false};
+    uint32_t sequence;// of the updates without time stamp of the object, when the RTIA may also send them directly
+    bool _hasSequence {false};
 };
 
 std::ostream& operator<<(std::ostream& os, const NM_Update_Attribute_Values& msg);
@@ -1106,6 +1232,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1131,6 +1260,18 @@ public:
     void setEvent(const EventRetractionHandle& newEvent);
     bool hasEvent() const;
     
+    const ObjectClassHandle& getMulticastClass() const;
+    void setMulticastClass(const ObjectClassHandle& newMulticastClass);
+    bool hasMulticastClass() const;
+    
+    const bool& getPeer() const;
+    void setPeer(const bool& newPeer);
+    bool hasPeer() const;
+    
+    const uint32_t& getSequence() const;
+    void setSequence(const uint32_t& newSequence);
+    bool hasSequence() const;
+    
     using Super = NetworkMessage;
     friend std::ostream& operator<<(std::ostream& os, const NM_Reflect_Attribute_Values& msg);
 
@@ -1140,6 +1281,12 @@ protected:
     std::vector<AttributeValue_t> values;
     EventRetractionHandle event;
     bool _hasEvent {false};
+    ObjectClassHandle multicastClass;// sent to the group of this class, unfiltered
+    bool _hasMulticastClass {false};
+    bool peer;// sent directly by the RTIA of the updating federate, not by the RTIG
+    bool _hasPeer {false};
+    uint32_t sequence;// of the update, the older ones are dropped once a newer one came by the other path
+    bool _hasSequence {false};
 };
 
 std::ostream& operator<<(std::ostream& os, const NM_Reflect_Attribute_Values& msg);
@@ -1152,6 +1299,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -1196,6 +1346,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -1221,6 +1374,10 @@ public:
     void setEvent(const EventRetractionHandle& newEvent);
     bool hasEvent() const;
     
+    const bool& getMulticast() const;
+    void setMulticast(const bool& newMulticast);
+    bool hasMulticast() const;
+    
     using Super = NetworkMessage;
     friend std::ostream& operator<<(std::ostream& os, const NM_Receive_Interaction& msg);
 
@@ -1230,6 +1387,8 @@ protected:
     std::vector<ParameterValue_t> values;
     EventRetractionHandle event;
     bool _hasEvent {false};
+    bool multicast;// sent to the group of the class, unfiltered
+    bool _hasMulticast {false};
 };
 
 std::ostream& operator<<(std::ostream& os, const NM_Receive_Interaction& msg);
@@ -1242,6 +1401,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1270,6 +1432,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1302,6 +1467,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1337,6 +1505,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1372,6 +1543,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -1398,6 +1572,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -1424,6 +1601,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -1455,6 +1635,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1486,6 +1669,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1512,6 +1698,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1538,6 +1727,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1564,6 +1756,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1590,6 +1785,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectHandle& getObject() const;
@@ -1727,6 +1925,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     uint32_t getAttributesSize() const;
@@ -1770,6 +1971,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     uint32_t getAttributesSize() const;
@@ -1805,6 +2009,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const RegionHandle& getRegion() const;
@@ -1827,6 +2034,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     uint32_t getAttributesSize() const;
@@ -1866,6 +2076,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     uint32_t getAttributesSize() const;
@@ -1905,6 +2118,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -1954,6 +2170,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -1993,6 +2212,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -2032,6 +2254,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const InteractionClassHandle& getInteractionClass() const;
@@ -2078,6 +2303,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -2100,6 +2328,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const ObjectClassHandle& getObjectClass() const;
@@ -2122,6 +2353,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const std::string& getObjectName() const;
@@ -2160,6 +2394,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const FederationTime& getTimestamp() const;
@@ -2174,6 +2411,15 @@ protected:
 
 std::ostream& operator<<(std::ostream& os, const NM_Message_Null_Prime& msg);
 
+// Demand-driven NULL message protocol: a constrained federate blocked
+// at date asks the regulators holding back its LBTS for a NULL message.
+class CERTI_EXPORT NM_Message_Null_Request : public NetworkMessage {
+public:
+    NM_Message_Null_Request();
+    virtual ~NM_Message_Null_Request() = default;
+    
+};
+
 
 class CERTI_EXPORT NM_Enable_Asynchronous_Delivery : public NetworkMessage {
 public:
@@ -2230,6 +2476,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const bool& getMomState() const;
@@ -2256,6 +2505,9 @@ public:
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const double& getLookahead() const;
@@ -2282,6 +2534,64 @@ protected:
 
 std::ostream& operator<<(std::ostream& os, const NM_Time_State_Update& msg);
 
+// The attributes of objectClass the federate subscribes to, sent to every
+// RTIA when the RTIAs send the updates to each other.
+// objectClass 0: the federate left the federation.
+class CERTI_EXPORT NM_Peer_Route : public NM_Publish_Object_Class {
+public:
+    NM_Peer_Route();
+    virtual ~NM_Peer_Route() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
+
+    // Attributes accessors and mutators
+    const uint32_t& getPeerAddress() const;
+    void setPeerAddress(const uint32_t& newPeerAddress);
+    
+    const uint32_t& getPeerPort() const;
+    void setPeerPort(const uint32_t& newPeerPort);
+    
+    using Super = NM_Publish_Object_Class;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Peer_Route& msg);
+
+protected:
+    uint32_t peerAddress;// address of the RTIA of the subscriber, in network byte order
+    uint32_t peerPort;// port it accepts the direct updates on, 0 if it does not
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Peer_Route& msg);
+
+// Name of the shared memory segment offered by an RTIA of the host of the
+// RTIG. The RTIG answers with the same name if it uses the segment, with an
+// empty name if the link stays on the socket.
+class CERTI_EXPORT NM_Shm_Rings : public NetworkMessage {
+public:
+    NM_Shm_Rings();
+    virtual ~NM_Shm_Rings() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    virtual uint32_t serializedSize() const;
+
+    // Attributes accessors and mutators
+    const std::string& getName() const;
+    void setName(const std::string& newName);
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Shm_Rings& msg);
+
+protected:
+    std::string name;
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Shm_Rings& msg);
+
 
 class CERTI_EXPORT New_NetworkMessage {
 public:
@@ -2290,6 +2600,9 @@ public:
     
     void serialize(libhla::MessageBuffer& msgBuffer);
     void deserialize(libhla::MessageBuffer& msgBuffer);
+    // Bytes written by serialize() with the fixed size encoding,
+    // an upper bound of the compact one
+    uint32_t serializedSize() const;
 
     // Attributes accessors and mutators
     const uint32_t& getType() const;
@@ -2326,6 +2639,7 @@ class CERTI_EXPORT NM_Factory {
     public:
         static NetworkMessage* create(NM_Type type) throw (NetworkError ,NetworkSignal); 
         static NetworkMessage* receive(NMStreamType stream) throw (NetworkError ,NetworkSignal); 
+        static NetworkMessage* receive(NMStreamType stream, libhla::MessageBuffer& msgBuffer) throw (NetworkError ,NetworkSignal); 
     protected:
     private:
 };
@@ -169,12 +169,24 @@ std::string NetworkMessage::to_string(const NetworkMessage::Type& msg_type)
         CASE(NetworkMessage::Type::NEXT_MESSAGE_REQUEST_AVAILABLE)
         CASE(NetworkMessage::Type::TIME_STATE_UPDATE)
         CASE(NetworkMessage::Type::MOM_STATUS)
+        CASE(NetworkMessage::Type::MESSAGE_NULL_REQUEST)
+        CASE(NetworkMessage::Type::PEER_ROUTE)
+        CASE(NetworkMessage::Type::SHM_RINGS)
 //         CASE(NetworkMessage::Type::LAST)
         default:
             return "Unknown NetworkMessage::Type";
     }
 }
 
+NetworkMessage::WireFormat NetworkMessage::localWireFormat()
+{
+    static const WireFormat format = [] {
+        const char* value = getenv("CERTI_WIRE_FORMAT");
+        return (value && std::string(value) == "fixed") ? WireFormat::FIXED_SIZE : WireFormat::COMPACT;
+    }();
+    return format;
+}
+
 std::ostream& operator<<(std::ostream& os, const NetworkMessage& msg)
 {
     return const_cast<NetworkMessage&>(msg).show(os);
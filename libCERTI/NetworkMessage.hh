@@ -31,16 +31,17 @@
 #include <string>
 #include <vector>
 
-#ifdef FEDERATION_USES_MULTICAST
-#define MC_PORT 60123
-#define ADRESSE_MULTICAST "224.0.0.251"
-#endif // FEDERATION_USES_MULTICAST
-
 #define PORT_TCP_RTIG "60400"
 #define PORT_UDP_RTIG "60500"
 
 namespace certi {
 
+/// Name of the local socket of the RTIG listening on tcp_port, for the RTIAs of its host.
+inline std::string localRTIGName(unsigned int tcp_port)
+{
+    return "certi-rtig-" + std::to_string(tcp_port);
+}
+
 /**
  * NetworkMessage is the base class used
  * for modeling message exchanged between RTIG and RTIA.
@@ -156,12 +157,30 @@ public:
         NEXT_MESSAGE_REQUEST_AVAILABLE,
         TIME_STATE_UPDATE,
         MOM_STATUS,
+        MESSAGE_NULL_REQUEST, // CERTI specific for the demand-driven NULL message protocol
+        PEER_ROUTE, // CERTI specific, only RTIG->RTIA when the RTIAs send updates to each other
+        SHM_RINGS, // CERTI specific, RTIA->RTIG and back on a local link, before it goes through shared memory
         LAST
     };
     
     static constexpr size_t the_message_type_count = static_cast<size_t>(NetworkMessage::Type::LAST);
 
     static std::string to_string(const NetworkMessage::Type& msg_type);
+
+    /**
+     * Encodings of the RTIA/RTIG link. Each side advertises the
+     * highest one it reads in NM_Join_Federation_Execution.
+     */
+    enum class WireFormat : uint32_t {
+        FIXED_SIZE = 0, // the only one known to older peers
+        COMPACT // see MessageBuffer::setCompact
+    };
+
+    /**
+     * Highest wire format this process reads and is willing to send:
+     * COMPACT, unless the CERTI_WIRE_FORMAT environment variable is "fixed".
+     */
+    static WireFormat localWireFormat();
     
     NetworkMessage();
     virtual ~NetworkMessage();
@@ -223,6 +242,24 @@ public:
 	 */
     virtual void deserialize(MessageBuffer& msgBuffer);
 
+    /**
+	 * Number of bytes serialize() will write with the fixed size encoding,
+	 * an upper bound of what it writes into a compact buffer
+	 */
+    virtual uint32_t serializedSize() const;
+
+    /**
+     * Serialize the message with its header, ready to be written on a socket
+     * @param[out] msgBuffer the buffer, reset first
+     * @param[in] compact use the compact encoding (see WireFormat)
+     * @param[in] segmented reference large values instead of copying them
+     *            (see MessageBuffer::setSegmented), only to send the buffer at once
+     */
+    void serializeFrame(MessageBuffer& msgBuffer, bool compact, bool segmented = false);
+
+    /// Write a frame serialized by serializeFrame, with a gather write if it has segments
+    static void sendFrame(Socket* socket, MessageBuffer& msgBuffer);
+
     /**
      * Send a message buffer to the socket
      */
@@ -238,6 +275,12 @@ public:
 	 */
     void receive(Socket* socket, MessageBuffer& msgBuffer);
 
+    /**
+	 * Receive the raw bytes of the next message from the socket,
+	 * ready to be deserialized.
+	 */
+    static void receiveBuffer(Socket* socket, MessageBuffer& msgBuffer);
+
     EventRetractionHandle eventRetraction; /* FIXME to be suppressed */
 
     Handle getFederation() const
@@ -301,16 +344,10 @@ protected:
 	 * the message is for this particular federate
 	 */
     FederateHandle federate;
-
-private:
 };
 
 std::ostream& operator<<(std::ostream& os, const NetworkMessage& msg);
 
-// BUG: FIXME this is used by SocketMC and should
-//      be thrown away as soon as possible.
-#define TAILLE_MSG_RESEAU sizeof(NetworkMessage)
-
 } // namespace certi
 
 #endif // CERTI_NETWORK_MESSAGE_HH
@@ -21,6 +21,8 @@
 #include "NetworkMessage.hh"
 #include "PrettyDebug.hh"
 
+#include <algorithm>
+
 using std::vector;
 using std::endl;
 
@@ -54,6 +56,19 @@ void NetworkMessage::serialize(MessageBuffer& msgBuffer)
     Debug(G, pdGendoc) << "exit NetworkMessage::serialize" << std::endl;
 } /* end of serialize */
 
+uint32_t NetworkMessage::serializedSize() const
+{
+    /* type, federate, federation and exception */
+    uint32_t size = 4 + 4 + 4 + 4;
+    if (exception != Exception::Type::NO_EXCEPTION) {
+        size += 4 + exceptionReason.size();
+    }
+    else {
+        size += BasicMessage::serializedSize();
+    }
+    return size;
+} /* end of serializedSize */
+
 void NetworkMessage::deserialize(MessageBuffer& msgBuffer)
 {
     Debug(G, pdGendoc) << "enter NetworkMessage::deserialize" << std::endl;
@@ -75,11 +90,17 @@ void NetworkMessage::deserialize(MessageBuffer& msgBuffer)
     Debug(G, pdGendoc) << "exit NetworkMessage::deserialize" << std::endl;
 } /* end of deserialize */
 
-void NetworkMessage::send(Socket* socket, MessageBuffer& msgBuffer)
+void NetworkMessage::serializeFrame(MessageBuffer& msgBuffer, bool compact, bool segmented)
 {
-    Debug(G, pdGendoc) << "enter NetworkMessage::send" << std::endl;
-    /* 0- reset send buffer */
+    /* 0- reset send buffer and size it once for the whole message
+     * (large values are not copied by a segmented buffer)
+     */
     msgBuffer.reset();
+    if (!segmented) {
+        msgBuffer.resize(msgBuffer.reservedBytes + serializedSize());
+    }
+    msgBuffer.setCompact(compact);
+    msgBuffer.setSegmented(segmented);
     /* 1- serialize the message
      * This is a polymorphic call
      * which may specialized in a daughter class
@@ -87,13 +108,28 @@ void NetworkMessage::send(Socket* socket, MessageBuffer& msgBuffer)
     serialize(msgBuffer);
     /* 2- update message buffer 'reserved bytes' header */
     msgBuffer.updateReservedBytes();
+}
+
+void NetworkMessage::sendFrame(Socket* socket, MessageBuffer& msgBuffer)
+{
+    if (msgBuffer.hasSegments()) {
+        socket->sendSegments(msgBuffer.segments());
+    }
+    else {
+        socket->send(static_cast<unsigned char*>(msgBuffer(0)), msgBuffer.size());
+    }
+}
+
+void NetworkMessage::send(Socket* socket, MessageBuffer& msgBuffer)
+{
+    Debug(G, pdGendoc) << "enter NetworkMessage::send" << std::endl;
+    serializeFrame(msgBuffer, socket && socket->usesCompactEncoding(), true);
     Debug(D, pdDebug) << "Sending <" << getMessageName() << "> whose buffer has <" << msgBuffer.size() << "> bytes"
                       << std::endl;
     //msgBuffer.show(msgBuf(0),5);
-    /* 3- effectively send the raw message to socket */
-
+    /* effectively send the raw message to socket */
     if (NULL != socket) { // send only if socket is unequal to null
-        socket->send(static_cast<unsigned char*>(msgBuffer(0)), msgBuffer.size());
+        sendFrame(socket, msgBuffer);
     }
     else { // socket pointer was null - not sending
         Debug(D, pdDebug) << "Not sending -- socket is deleted." << std::endl;
@@ -104,23 +140,20 @@ void NetworkMessage::send(Socket* socket, MessageBuffer& msgBuffer)
 void NetworkMessage::send(std::vector<Socket*> sockets, MessageBuffer& msgBuffer)
 {
     Debug(G, pdGendoc) << "enter NetworkMessage::send" << std::endl;
-    /* 0- reset send buffer */
-    msgBuffer.reset();
-    /* 1- serialize the message
-     * This is a polymorphic call
-     * which may specialized in a daughter class
-     */
-    serialize(msgBuffer);
-    /* 2- update message buffer 'reserved bytes' header */
-    msgBuffer.updateReservedBytes();
-    Debug(D, pdDebug) << "Sending <" << getMessageName() << "> whose buffer has <" << msgBuffer.size() << "> bytes"
-                      << std::endl;
-    //msgBuffer.show(msgBuf(0),5);
-    /* 3- effectively send the raw message to socket */
-
-    for (const auto& socket : sockets) {
-        if (socket) { // send only if socket is unequal to null
-            socket->send(static_cast<unsigned char*>(msgBuffer(0)), msgBuffer.size());
+    /* serialize at most once per wire format used by the sockets */
+    for (const bool compact : {false, true}) {
+        auto uses_format = [compact](Socket* socket) { return socket && socket->usesCompactEncoding() == compact; };
+        if (std::none_of(sockets.begin(), sockets.end(), uses_format)) {
+            continue;
+        }
+        serializeFrame(msgBuffer, compact, true);
+        Debug(D, pdDebug) << "Sending <" << getMessageName() << "> whose buffer has <" << msgBuffer.size()
+                          << "> bytes" << std::endl;
+        /* effectively send the raw message to socket */
+        for (const auto& socket : sockets) {
+            if (uses_format(socket)) {
+                sendFrame(socket, msgBuffer);
+            }
         }
     }
     Debug(G, pdGendoc) << "exit  NetworkMessage::send" << std::endl;
@@ -129,6 +162,17 @@ void NetworkMessage::send(std::vector<Socket*> sockets, MessageBuffer& msgBuffer
 void NetworkMessage::receive(Socket* socket, MessageBuffer& msgBuffer)
 {
     Debug(G, pdGendoc) << "enter NetworkMessage::receive" << std::endl;
+    receiveBuffer(socket, msgBuffer);
+    /* deserialize the message
+	 * This is a polymorphic call
+	 * which may specialized in a daughter class
+	 */
+    deserialize(msgBuffer);
+    Debug(G, pdGendoc) << "exit  NetworkMessage::receive" << std::endl;
+} /* end of receive */
+
+void NetworkMessage::receiveBuffer(Socket* socket, MessageBuffer& msgBuffer)
+{
     /* 0- Reset receive buffer */
     /* FIXME this reset may not be necessary since we do
 	 * raw-receive + assume-size
@@ -144,12 +188,6 @@ void NetworkMessage::receive(Socket* socket, MessageBuffer& msgBuffer)
                       << " reserved)" << std::endl;
     /* 3- receive the rest of the message */
     socket->receive(msgBuffer(msgBuffer.reservedBytes), msgBuffer.size() - msgBuffer.reservedBytes);
-    /* 4- deserialize the message
-	 * This is a polymorphic call
-	 * which may specialized in a daughter class
-	 */
-    deserialize(msgBuffer);
-    Debug(G, pdGendoc) << "exit  NetworkMessage::receive" << std::endl;
-} /* end of receive */
+} /* end of receiveBuffer */
 
 } // namespace certi
@@ -142,6 +142,13 @@ Responses ObjectClass::broadcastClassMessage(ObjectClassBroadcastList* ocbList,
     } break;
 
     case NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES: {
+        // The reflection goes best effort only if every attribute may be
+        // lost, and if it is timestamped, if none has to stay behind the
+        // reliable messages which advance time.
+        const bool dated = ocbList->getMsgRAV()->isDated();
+        bool bestEffort = ocbList->getMsgRAV()->getAttributesSize() > 0;
+        bool defaultRegion = true;
+
         // For each class attribute, update the list by adding federates who
         // subscribed to the attribute.
         for (uint32_t i = 0; i < ocbList->getMsgRAV()->getAttributesSize(); ++i) {
@@ -152,13 +159,31 @@ Responses ObjectClass::broadcastClassMessage(ObjectClassBroadcastList* ocbList,
             if (a == _handleClassAttributeMap.end()) {
                 continue;
             }
+            if (a->second->transport != BEST_EFFORT || (dated && a->second->order != RECEIVE)) {
+                bestEffort = false;
+            }
 
             ObjectAttribute* attr = source->getAttribute(attributeHandle);
             const RTIRegion* update_region = attr->getRegion();
+            if (update_region) {
+                defaultRegion = false;
+            }
             Debug(D, pdTrace) << "RAV: attr " << attributeHandle << " / region "
                               << (update_region ? update_region->getHandle() : 0) << std::endl;
             a->second->updateBroadcastList(ocbList, update_region);
         }
+
+        if (bestEffort) {
+            ocbList->setTransport(BEST_EFFORT);
+        }
+
+        // the group only carries the updates matching every subscription of the class
+        SocketUDP* group = nullptr;
+        if (bestEffort && defaultRegion && server) {
+            group = server->getMulticastLink(SocketMC::Group::ObjectClass, handle);
+        }
+        ocbList->setMulticastGroup(
+            group, my_multicast_members, handle, server ? server->getMulticastThreshold() : 0);
     } break;
 
     case NetworkMessage::Type::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION: {
@@ -187,11 +212,7 @@ void ObjectClass::sendToFederate(NetworkMessage* msg, FederateHandle theFederate
     // Send the message 'msg' to the Federate which Handle is theFederate.
     Socket* socket = NULL;
     try {
-#ifdef HLA_USES_UDP
-        socket = server->getSocketLink(theFederate, BEST_EFFORT);
-#else
         socket = server->getSocketLink(theFederate);
-#endif
         msg->send(socket, NM_msgBufSend);
     }
     catch (RTIinternalError& e) {
@@ -852,7 +873,8 @@ ObjectClass::updateAttributeValues(FederateHandle the_federate,
                                    const std::vector<AttributeHandle>& the_attributes,
                                    const std::vector<AttributeValue_t>& the_values,
                                    int the_size,
-                                   const std::string& the_tag)
+                                   const std::string& the_tag,
+                                   uint32_t the_sequence)
 {
     Responses ret;
     // Ownership management: Test ownership on each attribute before updating.
@@ -877,6 +899,10 @@ ObjectClass::updateAttributeValues(FederateHandle the_federate,
         // without time
 
         answer->setLabel(the_tag);
+        if (the_sequence) {
+            // checked by the RTIAs against the updates sent to them directly
+            answer->setSequence(the_sequence);
+        }
 
         answer->setAttributesSize(the_size);
         answer->setValuesSize(the_size);
@@ -1517,8 +1543,24 @@ void ObjectClass::unsubscribe(FederateHandle fed)
             i->second->unsubscribe(fed);
         }
     }
+    my_multicast_members.erase(fed);
 } /* end of unsubscribe */
 
+void ObjectClass::setMulticastMember(FederateHandle federate, bool member)
+{
+    if (member) {
+        my_multicast_members.insert(federate);
+    }
+    else {
+        my_multicast_members.erase(federate);
+    }
+}
+
+bool ObjectClass::isMulticastMember(FederateHandle federate) const
+{
+    return my_multicast_members.count(federate) != 0;
+}
+
 void ObjectClass::addSubClass(ObjectClass* child)
 {
     /* build parent-child relationship */
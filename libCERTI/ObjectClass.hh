@@ -44,6 +44,7 @@ class ObjectClassBroadcastList;
 
 // Standard
 #include <map>
+#include <set>
 #include <string>
 
 namespace certi {
@@ -140,6 +141,10 @@ public:
     void unsubscribe(FederateHandle, const RTIRegion*);
     void unsubscribe(FederateHandle);
 
+    /// Whether the RTIA of federate receives the reflections sent to the multicast group of this class.
+    void setMulticastMember(FederateHandle federate, bool member);
+    bool isMulticastMember(FederateHandle federate) const;
+
     // Ownership Management
     std::pair<ObjectClassBroadcastList*, Responses>
     negotiatedAttributeOwnershipDivestiture(FederateHandle theFederateHandle,
@@ -206,7 +211,8 @@ public:
                                                                           const std::vector<AttributeHandle>&,
                                                                           const std::vector<AttributeValue_t>&,
                                                                           int,
-                                                                          const std::string&);
+                                                                          const std::string&,
+                                                                          uint32_t sequence = 0);
 
     void recursiveDiscovering(FederateHandle, ObjectClassHandle);
 
@@ -277,6 +283,9 @@ private:
     /// greatest subscriber handle
     FederateHandle maxSubscriberHandle;
 
+    /// Subscribers which joined the multicast group of this class.
+    std::set<FederateHandle> my_multicast_members;
+
     /// The security level ID attached to this object class. default level for non inherited attributes.
     SecurityLevelID securityLevelId;
 
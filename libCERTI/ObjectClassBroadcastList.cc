@@ -75,6 +75,17 @@ bool ObjectBroadcastLine::isWaitingAny(const AttributeHandle max_handle) const
     return false;
 }
 
+bool ObjectBroadcastLine::isSentAny(const AttributeHandle max_handle) const
+{
+    for (unsigned int attrIndex = 1; attrIndex <= max_handle; ++attrIndex) {
+        if (stateFor(attrIndex) == State::Sent) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 bool ObjectBroadcastLine::isWaitingAll(const std::vector<AttributeHandle>& attributes) const
 {
     for (auto& handle : attributes) {
@@ -227,6 +238,22 @@ void ObjectClassBroadcastList::upcastTo(ObjectClassHandle objectClass)
     }
 }
 
+void ObjectClassBroadcastList::setTransport(TransportType transport)
+{
+    my_transport = transport;
+}
+
+void ObjectClassBroadcastList::setMulticastGroup(SocketUDP* group,
+                                                 const std::set<FederateHandle>& members,
+                                                 ObjectClassHandle objectClass,
+                                                 unsigned int threshold)
+{
+    my_multicast_link = group;
+    my_multicast_members = &members;
+    my_multicast_class = objectClass;
+    my_multicast_threshold = threshold;
+}
+
 Responses ObjectClassBroadcastList::preparePendingDOMessage(SecurityServer& server)
 {
     Responses responses;
@@ -238,11 +265,7 @@ Responses ObjectClassBroadcastList::preparePendingDOMessage(SecurityServer& serv
             // 1. Prepare message for federate
             Debug(D, pdProtocol) << "Broadcasting message to Federate " << line.getFederate() << std::endl;
             try {
-#ifdef HLA_USES_UDP
-                sockets.push_back(server.getSocketLink(line.getFederate(), BEST_EFFORT));
-#else
                 sockets.push_back(server.getSocketLink(line.getFederate()));
-#endif
             }
             catch (Exception& e) {
                 Debug(D, pdExcept) << "Reference to a killed Federate while broadcasting." << std::endl;
@@ -284,6 +307,10 @@ Responses ObjectClassBroadcastList::preparePendingRAVMessage(SecurityServer& ser
         relevantAttributes = msgRAOA->getAttributes();
     }
 
+    if (msgRAV) {
+        responses = prepareMulticastRAVMessage();
+    }
+
     for (auto& line : my_lines) {
         // If *at least* one of the attributes is waiting
         if (line.isWaitingAny(maxHandle)) {
@@ -313,11 +340,7 @@ Responses ObjectClassBroadcastList::preparePendingRAVMessage(SecurityServer& ser
             // 2. Send appropriate message
             try {
                 std::vector<Socket*> sockets;
-#ifdef HLA_USES_UDP
-                sockets.push_back(server.getSocketLink(line.getFederate(), BEST_EFFORT));
-#else
-                sockets.push_back(server.getSocketLink(line.getFederate()));
-#endif
+                sockets.push_back(server.getSocketLink(line.getFederate(), msgRAV ? my_transport : RELIABLE));
                 responses.emplace_back(sockets, std::move(currentMessage));
             }
             catch (Exception& e) {
@@ -342,6 +365,56 @@ Responses ObjectClassBroadcastList::preparePendingRAVMessage(SecurityServer& ser
     return responses;
 }
 
+Responses ObjectClassBroadcastList::prepareMulticastRAVMessage()
+{
+    Responses responses;
+
+    if (!my_multicast_link || my_transport != BEST_EFFORT) {
+        return responses;
+    }
+
+    std::vector<ObjectBroadcastLine*> members;
+    for (auto& line : my_lines) {
+        if (line.getFederate() == msgRAV->getFederate()) {
+            continue;
+        }
+        if (line.isSentAny(maxHandle)) {
+            // reached through a subclass, it would get the attributes twice from the group
+            return responses;
+        }
+        if (line.isWaitingAny(maxHandle) && my_multicast_members->count(line.getFederate())) {
+            members.push_back(&line);
+        }
+    }
+
+    if (members.empty() || members.size() < my_multicast_threshold) {
+        return responses;
+    }
+
+    auto groupMessage = make_unique<NM_Reflect_Attribute_Values>(*msgRAV);
+    groupMessage->setMulticastClass(my_multicast_class);
+    // the groups get the fixed size encoding, whose size this is
+    if (groupMessage->serializedSize() + MessageBuffer::reservedBytes > my_multicast_link->getMaxDatagramSize()) {
+        return responses;
+    }
+
+    Debug(D, pdProtocol) << "Broadcasting message to the group of class " << my_multicast_class << " for "
+                         << members.size() << " federates" << std::endl;
+
+    for (auto line : members) {
+        for (unsigned int attrIndex = 1; attrIndex <= maxHandle; attrIndex++) {
+            if (line->stateFor(attrIndex) == ObjectBroadcastLine::State::Waiting) {
+                line->setState(attrIndex, ObjectBroadcastLine::State::Sent);
+            }
+        }
+    }
+
+    std::vector<Socket*> sockets{my_multicast_link};
+    responses.emplace_back(sockets, std::move(groupMessage));
+
+    return responses;
+}
+
 template <typename T>
 std::unique_ptr<NetworkMessage> ObjectClassBroadcastList::createResponseMessage(T* message,
                                                                                 const ObjectBroadcastLine& line)
@@ -30,6 +30,7 @@
 #include "SecurityServer.hh"
 #include <include/certi.hh>
 
+#include <set>
 #include <vector>
 
 #include <unordered_map>
@@ -59,6 +60,8 @@ public:
 
     bool isWaitingAny(const AttributeHandle max_handle) const;
 
+    bool isSentAny(const AttributeHandle max_handle) const;
+
     bool isWaitingAll(const std::vector<AttributeHandle>& attributes) const;
 
 private:
@@ -144,6 +147,25 @@ public:
      */
     void upcastTo(ObjectClassHandle objectClass);
 
+    /** Transport used for reflections, BEST_EFFORT when every attribute
+     * of the message may be lost or reordered. Other messages are always
+     * sent reliably.
+     */
+    void setTransport(TransportType transport);
+
+    /** Send a best effort reflection once to the multicast group of the
+     * class instead of once to each member of the group waiting for it,
+     * when there are at least threshold of them. The group receives the
+     * whole message, tagged with objectClass so that its members keep the
+     * attributes they subscribed to.
+     * @param group link to the group of objectClass, NULL to send to each federate
+     * @param members federates which joined the group
+     */
+    void setMulticastGroup(SocketUDP* group,
+                           const std::set<FederateHandle>& members,
+                           ObjectClassHandle objectClass,
+                           unsigned int threshold);
+
     const std::vector<ObjectBroadcastLine>& ___TESTS_ONLY___lines() const
     {
         return my_lines;
@@ -161,6 +183,9 @@ private:
     Responses preparePendingDOMessage(SecurityServer& server);
     Responses preparePendingRAVMessage(SecurityServer& server);
 
+    /// Send msgRAV to the multicast group and mark the members reached as Sent, if worth it.
+    Responses prepareMulticastRAVMessage();
+
     template <typename T>
     std::unique_ptr<NetworkMessage> createResponseMessage(T* message, const ObjectBroadcastLine& line);
 
@@ -173,6 +198,12 @@ private:
     /// Check if some attributes in the provided line have the "waiting" status.
     AttributeHandle maxHandle;
     std::vector<ObjectBroadcastLine> my_lines;
+    TransportType my_transport{RELIABLE};
+
+    SocketUDP* my_multicast_link{nullptr};
+    const std::set<FederateHandle>* my_multicast_members{nullptr};
+    ObjectClassHandle my_multicast_class{0};
+    unsigned int my_multicast_threshold{0};
 };
 
 } // namespace certi
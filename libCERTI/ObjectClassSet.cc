@@ -356,7 +356,8 @@ Responses ObjectClassSet::updateAttributeValues(FederateHandle federate,
                                                 Object* object,
                                                 const std::vector<AttributeHandle>& attributes,
                                                 const std::vector<AttributeValue_t>& values,
-                                                const std::string& tag)
+                                                const std::string& tag,
+                                                uint32_t sequence)
 {
     Responses ret;
 
@@ -369,7 +370,7 @@ Responses ObjectClassSet::updateAttributeValues(FederateHandle federate,
     // It may throw a bunch of exceptions
     ObjectClassBroadcastList* ocbList = NULL;
     std::tie(ocbList, ret)
-        = object_class->updateAttributeValues(federate, object, attributes, values, attributes.size(), tag);
+        = object_class->updateAttributeValues(federate, object, attributes, values, attributes.size(), tag, sequence);
 
     // Broadcast ReflectAttributeValues message recursively
     current_class = object_class->getSuperclass();
@@ -108,7 +108,8 @@ public:
                                     Object* object,
                                     const std::vector<AttributeHandle>& theAttribArray,
                                     const std::vector<AttributeValue_t>& theValueArray,
-                                    const std::string& theUserTag);
+                                    const std::string& theUserTag,
+                                    uint32_t theSequence = 0);
 
     // Ownership Management
     Responses negotiatedAttributeOwnershipDivestiture(FederateHandle,
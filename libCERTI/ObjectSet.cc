@@ -320,11 +320,7 @@ void ObjectSet::sendToFederate(NetworkMessage* msg, FederateHandle the_federate)
     // Send the message 'msg' to the Federate which Handle is theFederate.
     Socket* socket = nullptr;
     try {
-#ifdef HLA_USES_UDP
-        socket = server->getSocketLink(the_federate, BEST_EFFORT);
-#else
         socket = server->getSocketLink(the_federate);
-#endif
         msg->send(socket, const_cast<MessageBuffer&>(NM_msgBufSend));
     }
     catch (RTIinternalError& e) {
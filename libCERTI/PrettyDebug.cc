@@ -43,9 +43,13 @@
 #endif
 
 std::ostream PrettyDebug::the_default_output_stream(std::cerr.rdbuf());
-std::string PrettyDebug::the_federate_name = "";
 std::filebuf* PrettyDebug::the_file_buffer = nullptr;
 
+namespace {
+// per thread, not a (dll exported) member: a federate may run its RTIA on a thread
+thread_local std::string the_federate_name;
+}
+
 PrettyDebug::PrettyDebug(const std::string& name, const std::string& header) : my_name{name}, my_header{header}
 {
     PrettyDebug::initStreams();
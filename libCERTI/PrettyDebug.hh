@@ -116,6 +116,9 @@ public:
      */
     std::ostream* getStream(pdDebugLevel level, const int line);
 
+    /** Set the federate name printed in the headers of the messages of the
+     * calling thread (an in-process RTIA runs on a thread of its federate).
+     */
     static void setFederateName(const std::string& federate_name);
 
     /** If level is enabled, Message is sent to the DebugServer, preceded
@@ -128,7 +131,6 @@ private:
     static void initStreams();
 
     static std::ostream the_default_output_stream;
-    static std::string the_federate_name;
     static std::filebuf* the_file_buffer;
 
     /** Print the message header for the given level and return the apropriate stream
@@ -0,0 +1,488 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#include "SHMRingPair.hh"
+#include "Exception.hh"
+#include "PrettyDebug.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace certi {
+
+static PrettyDebug D("SHMRINGPAIR", "SHMRingPair");
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shared memory rings need lock-free 64 bits atomics");
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "shared memory rings need lock-free 32 bits atomics");
+
+constexpr size_t SHMRingPair::defaultRingSize;
+
+namespace {
+constexpr size_t cache_line_size = 64;
+
+constexpr uint32_t segment_magic = 0x43455254; // "CERT"
+constexpr uint32_t segment_version = 2;
+
+/// Number of polls before going to sleep on the doorbell; polling is
+/// pointless when the peer cannot run at the same time.
+int spinCount()
+{
+    static const int count = std::thread::hardware_concurrency() > 1 ? 1000 : 0;
+    return count;
+}
+
+inline void cpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#endif
+}
+
+/// A sender facing a full ring checks that the peer is still there that often.
+constexpr int writer_sleep_ms = 100;
+
+/// Sleep until flag is no longer 1, or at most writer_sleep_ms.
+void sleepWhileRaised(std::atomic<uint32_t>& flag, int doorbell)
+{
+#ifdef __linux__
+    // the flag is shared with the other process: no FUTEX_PRIVATE_FLAG
+    (void) doorbell;
+    struct timespec timeout = {0, writer_sleep_ms * 1000000L};
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&flag), FUTEX_WAIT, 1, &timeout, nullptr, 0);
+#else
+    // no wake up call between processes here: poll the ring every millisecond
+    (void) flag;
+    struct pollfd peer = {doorbell, 0, 0};
+    poll(&peer, 1, 1);
+#endif
+}
+
+void wakeUp(std::atomic<uint32_t>& flag)
+{
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&flag), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+#else
+    (void) flag;
+#endif
+}
+
+size_t roundUpToPowerOf2(size_t value)
+{
+    size_t result = cache_line_size;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+}
+
+/// One direction. Producer and consumer indices never share a cache line.
+struct SHMRingPair::Ring {
+    /// next byte to be read, only written by the consumer
+    alignas(cache_line_size) std::atomic<uint64_t> head;
+    /// next byte to be written, only written by the producer
+    alignas(cache_line_size) std::atomic<uint64_t> tail;
+    /// the consumer sleeps until some data is available
+    alignas(cache_line_size) std::atomic<uint32_t> readerWaiting;
+    /// the producer sleeps until some room is available
+    alignas(cache_line_size) std::atomic<uint32_t> writerWaiting;
+};
+
+struct SHMRingPair::Segment {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t ringSize;
+    /// rings[0] is written by the creator, rings[1] by the peer which attached
+    Ring rings[2];
+    // followed by the data of rings[0], then the data of rings[1]
+};
+
+SHMRingPair::~SHMRingPair()
+{
+    release();
+}
+
+std::string SHMRingPair::create(const std::string& prefix, size_t ring_size)
+{
+    static std::atomic<unsigned> counter{0};
+
+    ring_size = roundUpToPowerOf2(ring_size);
+
+    my_name = prefix + std::to_string(getpid()) + "_" + std::to_string(counter++);
+
+    shm_unlink(my_name.c_str());
+    int fd = shm_open(my_name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        throw NetworkError("SHMRingPair: cannot create <" + my_name + ">: " + strerror(errno));
+    }
+    my_linked = true;
+
+    const size_t size = sizeof(Segment) + 2 * ring_size;
+    if (ftruncate(fd, size) < 0) {
+        close(fd);
+        release();
+        throw NetworkError("SHMRingPair: cannot size <" + my_name + ">: " + strerror(errno));
+    }
+
+    map(fd, size);
+
+    my_segment = new (my_segment) Segment;
+    my_segment->magic = segment_magic;
+    my_segment->version = segment_version;
+    my_segment->ringSize = ring_size;
+    for (auto& ring : my_segment->rings) {
+        ring.head = 0;
+        ring.tail = 0;
+        ring.readerWaiting = 0;
+        ring.writerWaiting = 0;
+    }
+
+    unsigned char* data = reinterpret_cast<unsigned char*>(my_segment + 1);
+    my_ring_size = ring_size;
+    my_tx = &my_segment->rings[0];
+    my_rx = &my_segment->rings[1];
+    my_tx_data = data;
+    my_rx_data = data + ring_size;
+
+    Debug(D, pdInit) << "Created <" << my_name << ">, " << ring_size << " bytes per ring" << std::endl;
+
+    return my_name;
+}
+
+void SHMRingPair::attach(const std::string& name)
+{
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        throw NetworkError("SHMRingPair: cannot open <" + name + ">: " + strerror(errno));
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) < 0 || static_cast<size_t>(info.st_size) < sizeof(Segment)) {
+        close(fd);
+        throw NetworkError("SHMRingPair: <" + name + "> is not a ring segment");
+    }
+
+    map(fd, info.st_size);
+
+    if (my_segment->magic != segment_magic || my_segment->version != segment_version
+        || sizeof(Segment) + 2 * my_segment->ringSize != my_mapped_size) {
+        release();
+        throw NetworkError("SHMRingPair: <" + name + "> has an unexpected layout");
+    }
+
+    unsigned char* data = reinterpret_cast<unsigned char*>(my_segment + 1);
+    my_ring_size = my_segment->ringSize;
+    my_tx = &my_segment->rings[1];
+    my_rx = &my_segment->rings[0];
+    my_tx_data = data + my_ring_size;
+    my_rx_data = data;
+
+    Debug(D, pdInit) << "Attached <" << name << ">, " << my_ring_size << " bytes per ring" << std::endl;
+}
+
+void SHMRingPair::activate(int doorbell, bool interruptible)
+{
+    if (!my_segment) {
+        return;
+    }
+
+    // Both sides have mapped the segment now, the name is no longer needed.
+    if (my_linked) {
+        shm_unlink(my_name.c_str());
+        my_linked = false;
+    }
+
+    my_doorbell = doorbell;
+    my_interruptible = interruptible;
+    my_active = true;
+    Debug(D, pdInit) << "Link " << doorbell << " now uses shared memory rings" << std::endl;
+}
+
+bool SHMRingPair::isActive() const
+{
+    return my_active;
+}
+
+void SHMRingPair::map(int fd, size_t size)
+{
+    void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (address == MAP_FAILED) {
+        release();
+        throw NetworkError(std::string("SHMRingPair: cannot map segment: ") + strerror(errno));
+    }
+
+    my_segment = static_cast<Segment*>(address);
+    my_mapped_size = size;
+}
+
+void SHMRingPair::release()
+{
+    if (my_segment) {
+        munmap(my_segment, my_mapped_size);
+        my_segment = nullptr;
+        my_mapped_size = 0;
+    }
+    if (my_linked) {
+        shm_unlink(my_name.c_str());
+        my_linked = false;
+    }
+    my_active = false;
+    my_armed = nullptr;
+}
+
+bool SHMRingPair::isDataReady()
+{
+    disarm();
+    if (my_rx->tail.load() != my_rx->head.load(std::memory_order_relaxed)) {
+        return true;
+    }
+
+    // Nothing to read: the caller is about to select() on the socket,
+    // ask the peer to ring the doorbell with its next message.
+    arm(my_rx->readerWaiting);
+    if (my_rx->tail.load() != my_rx->head.load(std::memory_order_relaxed)) {
+        disarm();
+        return true;
+    }
+    return false;
+}
+
+void SHMRingPair::send(const unsigned char* buffer, size_t size)
+{
+    const uint64_t mask = my_ring_size - 1;
+    size_t total_sent = 0;
+
+    while (total_sent < size) {
+        const uint64_t tail = my_tx->tail.load(std::memory_order_relaxed);
+        const uint64_t room = my_ring_size - (tail - my_tx->head.load(std::memory_order_acquire));
+
+        if (room == 0) {
+            waitForRoom(tail);
+            continue;
+        }
+
+        const size_t count = std::min<size_t>(room, size - total_sent);
+        const size_t offset = tail & mask;
+        const size_t first = std::min<size_t>(count, my_ring_size - offset);
+
+        memcpy(my_tx_data + offset, buffer + total_sent, first);
+        memcpy(my_tx_data, buffer + total_sent + first, count - first);
+
+        // seq_cst store: must not be reordered with the readerWaiting load in ring()
+        my_tx->tail.store(tail + count);
+        total_sent += count;
+
+        ring(my_tx->readerWaiting);
+    }
+
+    Debug(D, pdTrace) << "Sent " << size << " bytes" << std::endl;
+}
+
+void SHMRingPair::receive(unsigned char* buffer, size_t size)
+{
+    disarm();
+
+    const uint64_t mask = my_ring_size - 1;
+    size_t total_received = 0;
+
+    while (total_received < size) {
+        const uint64_t head = my_rx->head.load(std::memory_order_relaxed);
+        const uint64_t available = my_rx->tail.load(std::memory_order_acquire) - head;
+
+        if (available == 0) {
+            waitForData();
+            continue;
+        }
+
+        const size_t count = std::min<size_t>(available, size - total_received);
+        const size_t offset = head & mask;
+        const size_t first = std::min<size_t>(count, my_ring_size - offset);
+
+        memcpy(buffer + total_received, my_rx_data + offset, first);
+        memcpy(buffer + total_received + first, my_rx_data, count - first);
+
+        // seq_cst store: must not be reordered with the writerWaiting load
+        my_rx->head.store(head + count);
+        total_received += count;
+
+        if (my_rx->writerWaiting.load() && my_rx->writerWaiting.exchange(0)) {
+            wakeUp(my_rx->writerWaiting);
+        }
+    }
+
+    Debug(D, pdTrace) << "Received " << size << " bytes" << std::endl;
+}
+
+void SHMRingPair::waitForData()
+{
+    auto ready = [this]() { return my_rx->tail.load() != my_rx->head.load(std::memory_order_relaxed); };
+
+    // The peer is usually about to answer: poll a little first.
+    for (int i = 0, count = spinCount(); i < count; ++i) {
+        if (ready()) {
+            return;
+        }
+        cpuRelax();
+    }
+
+    arm(my_rx->readerWaiting);
+    if (ready()) {
+        disarm();
+        return;
+    }
+
+    Debug(D, pdTrace) << "Sleeping until peer rings the doorbell" << std::endl;
+    readDoorbell();
+    // the peer reset the flag before ringing
+    my_armed = nullptr;
+}
+
+void SHMRingPair::waitForRoom(uint64_t tail)
+{
+    auto full = [this, tail]() { return tail - my_tx->head.load() == my_ring_size; };
+
+    for (int i = 0, count = spinCount(); i < count; ++i) {
+        if (!full()) {
+            return;
+        }
+        cpuRelax();
+    }
+
+    // The doorbell bytes belong to the receiving side, which may be another
+    // thread of ours: the sender sleeps on its own flag instead, and wakes
+    // up regularly to check with poll() that the peer did not go away.
+    Debug(D, pdTrace) << "Ring full, sleeping until peer reads" << std::endl;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(my_send_timeout_ms);
+    for (;;) {
+        my_tx->writerWaiting.store(1);
+        if (!full()) {
+            my_tx->writerWaiting.store(0);
+            return;
+        }
+
+        sleepWhileRaised(my_tx->writerWaiting, my_doorbell);
+        if (!full()) {
+            my_tx->writerWaiting.store(0);
+            return;
+        }
+
+        checkPeer();
+        if (my_send_timeout_ms > 0 && std::chrono::steady_clock::now() >= deadline) {
+            my_tx->writerWaiting.store(0);
+            throw NetworkError("SHMRingPair: peer did not read for " + std::to_string(my_send_timeout_ms) + " ms");
+        }
+    }
+}
+
+void SHMRingPair::setSendTimeout(int milliseconds)
+{
+    my_send_timeout_ms = std::max(0, milliseconds);
+}
+
+void SHMRingPair::checkPeer()
+{
+#ifdef POLLRDHUP
+    struct pollfd peer = {my_doorbell, POLLRDHUP, 0};
+#else
+    struct pollfd peer = {my_doorbell, 0, 0};
+#endif
+    if (poll(&peer, 1, 0) == 1 && peer.revents != 0) {
+        throw NetworkError("SHMRingPair: peer closed the connection");
+    }
+}
+
+void SHMRingPair::arm(std::atomic<uint32_t>& flag)
+{
+    flag.store(1);
+    my_armed = &flag;
+}
+
+void SHMRingPair::disarm()
+{
+    if (!my_armed) {
+        return;
+    }
+
+    // If the peer already claimed the flag, its doorbell byte is on the way.
+    if (my_armed->exchange(0) == 0) {
+        readDoorbell();
+    }
+    my_armed = nullptr;
+}
+
+void SHMRingPair::ring(std::atomic<uint32_t>& flag)
+{
+    if (flag.load() == 0 || flag.exchange(0) == 0) {
+        return;
+    }
+
+    const unsigned char doorbell = 0;
+    ssize_t sent;
+    do {
+        sent = write(my_doorbell, &doorbell, 1);
+    } while (sent < 0 && errno == EINTR);
+
+    if (sent != 1) {
+        throw NetworkError("SHMRingPair: could not ring the doorbell");
+    }
+}
+
+void SHMRingPair::readDoorbell()
+{
+    unsigned char doorbell;
+    ssize_t received;
+    for (;;) {
+        received = read(my_doorbell, &doorbell, 1);
+        if (received == 1) {
+            return;
+        }
+        if (received == 0) {
+            throw NetworkError("SHMRingPair: peer closed the connection");
+        }
+        if (errno != EINTR) {
+            throw NetworkError(std::string("SHMRingPair: doorbell read error: ") + strerror(errno));
+        }
+        if (my_interruptible) {
+            throw NetworkSignal("");
+        }
+    }
+}
+
+} // namespace certi
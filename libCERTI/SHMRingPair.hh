@@ -0,0 +1,137 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_SHM_RING_PAIR_HH
+#define CERTI_SHM_RING_PAIR_HH
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include <include/certi.hh>
+
+namespace certi {
+
+/**
+ * Two lock-free single producer / single consumer byte rings in a POSIX
+ * shared memory segment, one per direction, whose head and tail indices
+ * live on separate cache lines. As long as both peers are busy, bytes go
+ * through the rings without any system call.
+ *
+ * A stream socket connecting the peers is used as a doorbell: a peer which
+ * finds nothing to read raises a flag in the segment and sleeps on the
+ * socket; the other peer writes one byte on the socket only when it sees
+ * that flag. A peer which finds a full ring sleeps on a flag of its own,
+ * so that, as with a plain socket, one thread may send while another one
+ * receives; it throws NetworkError if the peer closes the socket in the
+ * meantime, or if the peer does not read within the send timeout. A peer may also wait for the socket with select() with other
+ * ones: call isDataReady() right before select() (it raises the flag when
+ * the ring is empty) and the socket becomes readable as soon as the other
+ * peer sends.
+ *
+ * One peer creates the segment, the other one attaches it by its name,
+ * which they exchange some other way (on the socket itself, typically).
+ * See SocketSHMRing and SocketTCPSHMRing.
+ */
+class CERTI_EXPORT SHMRingPair {
+public:
+    /// Default capacity of each ring, in bytes (must be a power of 2).
+    static constexpr size_t defaultRingSize = 1 << 20;
+
+    SHMRingPair() = default;
+    ~SHMRingPair();
+
+    SHMRingPair(const SHMRingPair&) = delete;
+    SHMRingPair& operator=(const SHMRingPair&) = delete;
+
+    /** Create the shared segment.
+     * @param prefix beginning of the name, the pid and a counter are appended
+     * @param ring_size capacity of each ring, rounded up to a power of 2
+     * @return the name to be given to the peer
+     */
+    std::string create(const std::string& prefix, size_t ring_size = defaultRingSize);
+
+    /** Map a segment created by the peer.
+     * @param name the name returned by create() on the peer side
+     */
+    void attach(const std::string& name);
+
+    /** Use the rings from now on (no-op if no segment was created/attached).
+     * @param doorbell stream socket connected to the peer
+     * @param interruptible whether a signal interrupting the wait for the
+     * doorbell throws NetworkSignal, or the wait goes on
+     */
+    void activate(int doorbell, bool interruptible = true);
+
+    bool isActive() const;
+
+    /// Unmap the segment, the peer refused it: the socket is used alone.
+    void release();
+
+    /** Give up sending when the ring stays full that long.
+     * @param milliseconds 0 (the default) to wait as long as the peer is there
+     */
+    void setSendTimeout(int milliseconds);
+
+    bool isDataReady();
+
+    void send(const unsigned char* buffer, size_t size);
+    void receive(unsigned char* buffer, size_t size);
+
+private:
+    struct Ring;
+    struct Segment;
+
+    void map(int fd, size_t size);
+
+    void waitForData();
+    /// @throw NetworkError if the peer closed the doorbell or the send timeout expired
+    void waitForRoom(uint64_t tail);
+    void checkPeer();
+
+    void arm(std::atomic<uint32_t>& flag);
+    void disarm();
+
+    void ring(std::atomic<uint32_t>& flag);
+    void readDoorbell();
+
+    std::string my_name;
+    bool my_linked{false};
+    bool my_active{false};
+
+    int my_doorbell{-1};
+    bool my_interruptible{true};
+    int my_send_timeout_ms{0};
+
+    Segment* my_segment{nullptr};
+    size_t my_mapped_size{0};
+
+    Ring* my_tx{nullptr};
+    Ring* my_rx{nullptr};
+    unsigned char* my_tx_data{nullptr};
+    unsigned char* my_rx_data{nullptr};
+    size_t my_ring_size{0};
+
+    /// flag we raised and the peer may have claimed (then a doorbell byte is due)
+    std::atomic<uint32_t>* my_armed{nullptr};
+};
+
+} // namespace certi
+
+#endif // CERTI_SHM_RING_PAIR_HH
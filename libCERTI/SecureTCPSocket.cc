@@ -83,6 +83,19 @@ void SecureTCPSocket::send(const unsigned char* buffer, size_t size)
 #endif
 }
 
+#ifndef _WIN32
+// ----------------------------------------------------------------------------
+void SecureTCPSocket::sendSegments(const std::vector<libhla::MessageBuffer::Segment>& segments)
+{
+#ifdef HLA_USES_GSSAPI
+    // the whole message is wrapped at once
+    Socket::sendSegments(segments);
+#else
+    SocketTCP::sendSegments(segments);
+#endif
+}
+#endif
+
 #ifdef WITH_GSSAPI
 // ----------------------------------------------------------------------------
 void SecureTCPSocket::getMessage()
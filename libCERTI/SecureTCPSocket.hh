@@ -38,6 +38,9 @@ public:
     virtual ~SecureTCPSocket();
 
     virtual void send(const unsigned char*, size_t);
+#ifndef _WIN32
+    virtual void sendSegments(const std::vector<libhla::MessageBuffer::Segment>& segments);
+#endif
     virtual void receive(void* Buffer, unsigned long Size);
 
     // FIXME: Peut-etre devrait-on regarder si un message est pret en interne,
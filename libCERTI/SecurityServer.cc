@@ -75,6 +75,16 @@ FederateHandle SecurityServer::getFederateHandle(Socket* theSocket) const
     return RTIG_SocketServer.getFederateFromSocket(myFederation, theSocket);
 }
 
+SocketUDP* SecurityServer::getMulticastLink(SocketMC::Group kind, Handle handle) const
+{
+    return RTIG_SocketServer.getMulticastLink(kind, handle);
+}
+
+unsigned int SecurityServer::getMulticastThreshold() const
+{
+    return RTIG_SocketServer.getMulticastThreshold();
+}
+
 bool SecurityServer::dominates(SecurityLevelID A, SecurityLevelID B) const
 {
     return A == B || B == PublicLevelID;
@@ -63,6 +63,12 @@ public:
 
     FederateHandle getFederateHandle(Socket* theSocket) const;
 
+    /// Link to the multicast group of a class, NULL if the RTIG does not use multicast.
+    SocketUDP* getMulticastLink(SocketMC::Group kind, Handle handle) const;
+
+    /// Least number of subscribers a message must reach to be sent to a group.
+    unsigned int getMulticastThreshold() const;
+
     // Security related methods
 
     /// Compares two security level ID.
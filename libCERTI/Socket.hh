@@ -22,6 +22,7 @@
 
 #include "Exception.hh"
 #include <include/certi.hh>
+#include <libHLA/MessageBuffer.hh>
 #ifdef _WIN32
 #ifndef NOMINMAX
 #define NOMINMAX
@@ -48,6 +49,7 @@ typedef int SOCKET;
 #include <cstring>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace certi {
 
@@ -58,6 +60,19 @@ public:
 
     virtual void createConnection(const char* server_name, unsigned int port) = 0;
     virtual void send(const unsigned char*, size_t) = 0;
+
+    /**
+     * Send the segments of a buffer as one message (see MessageBuffer::segments).
+     * This default implementation gathers them and calls send() once.
+     */
+    virtual void sendSegments(const std::vector<libhla::MessageBuffer::Segment>& segments)
+    {
+        std::vector<unsigned char> message;
+        for (const auto& segment : segments) {
+            message.insert(message.end(), segment.data, segment.data + segment.length);
+        }
+        send(message.data(), message.size());
+    }
     virtual void receive(void* Buffer, unsigned long Size) = 0;
     virtual void close() = 0;
 
@@ -70,6 +85,19 @@ public:
 
     virtual SOCKET returnSocket() = 0;
 
+    /**
+     * Messages sent on this socket use the compact encoding
+     * (see MessageBuffer::setCompact), once the peer said it reads it.
+     */
+    void setCompactEncoding(bool compact)
+    {
+        compactEncoding = compact;
+    }
+    bool usesCompactEncoding() const
+    {
+        return compactEncoding;
+    }
+
     /**
      * This function builds a string which represents
      * the provided IPv4 address as a "w.x.y.z".
@@ -124,6 +152,9 @@ public:
         }
         Socket::host2addr(name, addr);
     }
+
+private:
+    bool compactEncoding{false};
 };
 
 } // namespace certi
@@ -18,233 +18,183 @@
 // ----------------------------------------------------------------------------
 
 #include "SocketMC.hh"
+#include "PrettyDebug.hh"
 #include "config.h"
 
-#ifdef _WIN32
-#include "SocketTCP.hh"
-#else
+#ifndef _WIN32
 #include <arpa/inet.h>
 #include <unistd.h>
 #endif
 
-#include <cassert>
+#include <assert.h>
 #include <cerrno>
-#include <cstdio>
-#include <cstdlib>
 #include <cstring>
 
 namespace certi {
 
-// ----------------------------------------------------------------------------
-SocketMC::SocketMC()
-{
-    _est_init_mc = false;
-    _num_msg = 1;
-#ifdef _WIN32
-    SocketTCP::winsockStartup();
-#endif
-}
+static PrettyDebug D("SOCKMC", "(SocketMC) - ");
 
-// ----------------------------------------------------------------------------
-SocketMC::~SocketMC()
-{
-    if (_est_init_mc) {
-#ifdef _WIN32
-        closesocket(_socket_mc);
-        closesocket(_socket_emetteur);
-#else
-        ::close(_socket_mc);
-        ::close(_socket_emetteur);
-#endif
-        _est_init_mc = false;
-    }
+constexpr unsigned int SocketMC::defaultPort;
 
-#ifdef _WIN32
-    SocketTCP::winsockShutdown();
-#endif
-}
+/// 239.255.255.255, in host byte order
+static constexpr uint32_t lastMulticastAddress = 0xEFFFFFFF;
 
 // ----------------------------------------------------------------------------
-void SocketMC::CreerSocketMC(char* addr, unsigned long port)
+in_addr_t SocketMC::groupAddress(in_addr_t base, Group kind, Handle handle)
 {
-    assert(addr != NULL);
-    CreerSocketMC(inet_addr(addr), port);
+    assert(hasGroup(base, handle));
+    return htonl(ntohl(base) + 2 * handle + static_cast<uint32_t>(kind));
 }
 
 // ----------------------------------------------------------------------------
-void SocketMC::CreerSocketMC(unsigned long addr, unsigned long port)
+Handle SocketMC::lastGroupHandle(in_addr_t base)
 {
-    struct ip_mreq _mreq;
-    unsigned long _mreqlen;
-
-    assert(!_est_init_mc);
-    assert(addr > 0);
-
-#ifdef _WIN32
-    assert(SocketTCP::winsockInitialized());
-#endif
-
-    // create receiving socket
-    _socket_mc = socket(AF_INET, SOCK_DGRAM, 0);
-    if (_socket_mc < 0) {
-        perror("socket1");
-        throw NetworkError("cannot create socket");
-    }
-
-    memset(&_sin, sizeof(_sin), sizeof(_sin));
-    _sin.sin_family = AF_INET;
-    _sin.sin_addr.s_addr = htonl(INADDR_ANY);
-    _sin.sin_port = htons(port);
-    _sinlen = sizeof(_sin);
-
-    if (bind(_socket_mc, (struct sockaddr*) &_sin, _sinlen) < 0) {
-        perror("SocketMC: bind");
-        throw NetworkError("cannot bind");
-    }
-
-    // joindre le groupe multiCast
-    _mreq.imr_multiaddr.s_addr = addr;
-    _mreq.imr_interface.s_addr = htonl(INADDR_ANY);
-    _mreqlen = sizeof(_mreq);
-    if (setsockopt(_socket_mc, IPPROTO_IP, IP_ADD_MEMBERSHIP, (char*) &_mreq, _mreqlen) < 0) {
-        perror("setsockopt");
-        throw NetworkError("cannot setsockopt");
-    }
-
-    // creation du socket emetteur
-    _socket_emetteur = socket(AF_INET, SOCK_DGRAM, 0);
-    if (_socket_emetteur < 0) {
-        perror("socket2");
-        throw NetworkError("cannot create socket");
-    }
-
-    memset(&_sin_e, sizeof(_sin_e), sizeof(_sin_e));
-    _sin_e.sin_family = AF_INET;
-    _sin_e.sin_port = htons(port);
-    _sin_e.sin_addr.s_addr = addr;
-    _sinlen_e = sizeof(_sin_e);
-
-    // l'initialisation de la communication multicast est reussie
-    _est_init_mc = true;
+    assert(hasGroup(base, 0));
+    return (lastMulticastAddress - ntohl(base) - 1) / 2;
 }
 
 // ----------------------------------------------------------------------------
-void SocketMC::send(const unsigned char* Buffer, size_t)
+bool SocketMC::hasGroup(in_addr_t base, Handle handle)
 {
-    // BUG:Revoir ca en faisant le contraire(EmettreMC appelle Emettre)
-    sendMC((NetworkMessage*) Buffer);
+    const uint32_t first = ntohl(base);
+    return IN_MULTICAST(first) && uint64_t(first) + 2 * uint64_t(handle) + 1 <= lastMulticastAddress;
 }
 
 // ----------------------------------------------------------------------------
-void SocketMC::receive(void* Buffer, unsigned long)
+void SocketMC::setSendInterface(SocketUDP& socket, in_addr_t interface)
 {
-    // BUG: Revoir ca en faisant le contraire(RecevoirMC appelle Recevoir)
-    receiveMC((NetworkMessage*) Buffer);
+    struct in_addr address;
+    address.s_addr = interface;
+    if (setsockopt(socket.returnSocket(), IPPROTO_IP, IP_MULTICAST_IF, (char*) &address, sizeof(address)) < 0) {
+        throw NetworkError("Cannot send multicast through " + addr2string(interface) + ": " + strerror(errno));
+    }
 }
 
 // ----------------------------------------------------------------------------
-#ifdef _WIN32
-SOCKET SocketMC::returnSocket()
+SocketMC::SocketMC() : my_interface(INADDR_ANY)
 {
-    return _socket_mc;
 }
-#else
-int SocketMC::returnSocket()
-{
-    return _socket_mc;
-}
-#endif
 
 // ----------------------------------------------------------------------------
-unsigned long SocketMC::returnAdress() const
+SocketMC::~SocketMC()
 {
-    return _sin_e.sin_addr.s_addr;
+    close();
 }
 
 // ----------------------------------------------------------------------------
 void SocketMC::close()
 {
-    if (_est_init_mc) {
+    my_groups.clear();
+
+    // created but never bound: SocketUDP does not know it is open
+    if (!_est_init_udp && _socket_udp >= 0) {
 #ifdef _WIN32
-        closesocket(_socket_mc);
-        closesocket(_socket_emetteur);
+        ::closesocket(_socket_udp);
 #else
-        ::close(_socket_mc);
-        ::close(_socket_emetteur);
+        ::close(_socket_udp);
 #endif
-        _est_init_mc = false;
+        _socket_udp = -1;
+        return;
     }
+    SocketUDP::close();
 }
 
 // ----------------------------------------------------------------------------
-void SocketMC::sendMC(NetworkMessage* message)
+void SocketMC::createReceiver(in_addr_t interface)
 {
-    int cnt;
+    assert(!isReceiverCreated());
 
-    //message->number=_num_msg ;
-    // FIXME EN: SocketMC is now broken for several release
-    _num_msg++;
-    assert(_est_init_mc);
-    assert(message != NULL);
+    if (!open()) {
+        throw NetworkError("Cannot open multicast socket: " + std::string(strerror(errno)));
+    }
+    my_interface = interface;
 
-    message->send(this, MCMessageBuffer); // FIXME to be checked
-    cnt = sendto(_socket_emetteur, (char*) message, TAILLE_MSG_RESEAU, 0, (struct sockaddr*) &_sin_e, _sinlen_e);
+    // every RTIA of the host listens to the same port
+    int on = 1;
+    setsockopt(_socket_udp, SOL_SOCKET, SO_REUSEADDR, (char*) &on, sizeof(on));
 
-    if (cnt < 0) {
-        perror("Send");
-        throw NetworkError("cannot sendto");
-    }
+#ifdef IP_MULTICAST_ALL
+    // only the groups joined on this socket, not those of the other RTIAs of the host
+    int off = 0;
+    setsockopt(_socket_udp, IPPROTO_IP, IP_MULTICAST_ALL, (char*) &off, sizeof(off));
+#endif
 }
 
 // ----------------------------------------------------------------------------
-char* SocketMC::receiveMC(NetworkMessage* message)
+bool SocketMC::isReceiverCreated() const
 {
-    int cnt;
-
-    assert(_est_init_mc);
-    // FIXME receive NetworkMessage with virtual constructor
-    cnt = recvfrom(_socket_mc, (char*) message, TAILLE_MSG_RESEAU, 0, (struct sockaddr*) &_sin, &_sinlen);
-    if (cnt < 0) {
-        perror("Recv");
-        throw NetworkError("cannot recvfrom");
+    return _socket_udp >= 0;
+}
+
+// ----------------------------------------------------------------------------
+void SocketMC::bindReceiver(unsigned int port)
+{
+    assert(isReceiverCreated() && !isBound());
+
+    memset(&sock_local, 0, sizeof(struct sockaddr_in));
+    sock_local.sin_addr.s_addr = htonl(INADDR_ANY);
+    sock_local.sin_family = AF_INET;
+    sock_local.sin_port = htons(port);
+
+    if (!bind()) {
+        throw NetworkError("Cannot bind multicast socket to port " + std::to_string(port) + ": "
+                           + strerror(errno));
     }
+    _est_init_udp = true;
+
+    Debug(D, pdInit) << "Receiving multicast on port " << port << std::endl;
+}
 
-    return (inet_ntoa(_sin.sin_addr));
+// ----------------------------------------------------------------------------
+bool SocketMC::isBound() const
+{
+    return _est_init_udp;
 }
 
 // ----------------------------------------------------------------------------
-/** Wait for a socket event, until a time-out. The time-out is given
-    with seconds and microseconds in parameter.
-    @param sec seconds
-    @param usec microseconds
-    @return number of waiting events, 0 if time-out. May be negative
-    in case of error
- */
-int SocketMC::timeoutMC(int sec, int usec)
+bool SocketMC::join(in_addr_t group)
 {
-    assert(_est_init_mc);
+    assert(isReceiverCreated());
 
-    struct timeval timeout;
-    timeout.tv_sec = sec;
-    timeout.tv_usec = usec;
+    if (isJoined(group)) {
+        return true;
+    }
 
-    fd_set fdset;
-    FD_ZERO(&fdset);
-    FD_SET(_socket_mc, &fdset);
+    struct ip_mreq request;
+    request.imr_multiaddr.s_addr = group;
+    request.imr_interface.s_addr = my_interface;
+    if (setsockopt(_socket_udp, IPPROTO_IP, IP_ADD_MEMBERSHIP, (char*) &request, sizeof(request)) < 0) {
+        Debug(D, pdError) << "Cannot join group " << addr2string(group) << ": " << strerror(errno) << std::endl;
+        return false;
+    }
 
-    int nb = 0;
-    bool check;
-    do {
-        nb = select(_socket_mc + 1, SELECT_TYPE_ARG234 & fdset, NULL, NULL, &timeout);
+    my_groups.insert(group);
+    Debug(D, pdRegister) << "Group " << addr2string(group) << " joined" << std::endl;
+    return true;
+}
 
-#ifdef _WIN32
-        check = (WSAGetLastError() == WSAEINTR);
-#else
-        check = (errno == EINTR);
-#endif
-    } while ((nb < 0) && check);
+// ----------------------------------------------------------------------------
+void SocketMC::leave(in_addr_t group)
+{
+    if (!my_groups.erase(group)) {
+        return;
+    }
+
+    struct ip_mreq request;
+    request.imr_multiaddr.s_addr = group;
+    request.imr_interface.s_addr = my_interface;
+    if (setsockopt(_socket_udp, IPPROTO_IP, IP_DROP_MEMBERSHIP, (char*) &request, sizeof(request)) < 0) {
+        Debug(D, pdError) << "Cannot leave group " << addr2string(group) << ": " << strerror(errno) << std::endl;
+    }
+    else {
+        Debug(D, pdRegister) << "Group " << addr2string(group) << " left" << std::endl;
+    }
+}
 
-    return nb;
+// ----------------------------------------------------------------------------
+bool SocketMC::isJoined(in_addr_t group) const
+{
+    return my_groups.count(group) != 0;
 }
 
 } // namespace certi
@@ -20,49 +20,84 @@
 #ifndef CERTI_SOCKET_MC_HH
 #define CERTI_SOCKET_MC_HH
 
-#include <libHLA/MessageBuffer.hh>
-#include "NetworkMessage.hh"
-#include "Socket.hh"
+#include "Handle.hh"
+#include "SocketUDP.hh"
+
+#include <set>
 
 namespace certi {
 
-class SocketMC : public Socket {
+/**
+ * UDP socket receiving the messages the RTIG sends to IP multicast groups.
+ *
+ * The RTIG gives each object and interaction class its own group (see
+ * groupAddress()) and sends a best effort message once to the group of
+ * the class instead of once to each subscriber, through a SocketUDP link
+ * attached to its server socket. An RTIA joins the groups of the classes
+ * it subscribes to, and filters what it receives: a group also carries
+ * the messages of its class for which the RTIA subscribed other
+ * attributes, or which come from another federation.
+ */
+class CERTI_EXPORT SocketMC : public SocketUDP {
 public:
-    int _socket_mc;
-    bool _est_init_mc;
+    /// Port the groups are sent to, unless the RTIG is told otherwise.
+    static constexpr unsigned int defaultPort = 60123;
+
+    enum class Group : uint32_t { ObjectClass = 0, InteractionClass = 1 };
+
+    /**
+     * Address of the group of a class.
+     * @param base address of the first group, in network byte order
+     * @return base + 2 * handle + kind, in network byte order
+     * @pre hasGroup(base, handle)
+     */
+    static in_addr_t groupAddress(in_addr_t base, Group kind, Handle handle);
+
+    /**
+     * Highest class handle whose groups, of both kinds, stay in 224.0.0.0/4.
+     * @pre hasGroup(base, 0)
+     */
+    static Handle lastGroupHandle(in_addr_t base);
+
+    /// The groups of a class stay in 224.0.0.0/4, the other classes are sent to on unicast.
+    static bool hasGroup(in_addr_t base, Handle handle);
+
+    /// Multicast datagrams sent on socket go out through interface (INADDR_ANY: the routing table decides).
+    static void setSendInterface(SocketUDP& socket, in_addr_t interface);
 
     SocketMC();
     virtual ~SocketMC();
 
-    void CreerSocketMC(char* addr, unsigned long port);
-    void CreerSocketMC(unsigned long addr, unsigned long port);
+    virtual void close();
 
-    virtual void send(const unsigned char*, size_t);
-    virtual void receive(void* Buffer, unsigned long Size);
+    /**
+     * Create the system socket. It receives nothing until bindReceiver()
+     * but it can already be watched with select() or epoll.
+     * @param interface address of the interface the groups are joined on
+     */
+    void createReceiver(in_addr_t interface = INADDR_ANY);
 
-    SOCKET returnSocket();
+    bool isReceiverCreated() const;
 
-    virtual unsigned long returnAdress() const;
-    virtual void close();
+    /// Receive the datagrams sent to port on the groups joined.
+    void bindReceiver(unsigned int port);
+
+    bool isBound() const;
 
-    void sendMC(NetworkMessage* msg);
-    char* receiveMC(NetworkMessage* msg);
+    /**
+     * Join a group, nothing is done if it is already joined.
+     * @return false if the group cannot be joined, the system limits the groups of a socket
+     */
+    bool join(in_addr_t group);
+
+    void leave(in_addr_t group);
+
+    bool isJoined(in_addr_t group) const;
 
 private:
-    struct sockaddr_in _sin;
-    struct sockaddr_in _sin_e;
-#ifdef _WIN32
-    int _sinlen;
-#else
-    socklen_t _sinlen;
-#endif
-    SOCKET _socket_emetteur;
-    int _sinlen_e;
-
-    int timeoutMC(int, int);
-
-    int _num_msg;
-    MessageBuffer MCMessageBuffer;
+    in_addr_t my_interface;
+
+    std::set<in_addr_t> my_groups;
 };
 
 } // namespace certi
@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#include "SocketSHMRing.hh"
+
+namespace certi {
+
+SocketSHMRing::SocketSHMRing(SignalHandlerType theType) : SocketUN(theType)
+{
+}
+
+SocketSHMRing::~SocketSHMRing()
+{
+}
+
+std::string SocketSHMRing::create(size_t ring_size)
+{
+    return my_rings.create("/certi_rtia_", ring_size);
+}
+
+void SocketSHMRing::attach(const std::string& name)
+{
+    my_rings.attach(name);
+}
+
+void SocketSHMRing::activate()
+{
+    my_rings.activate(_socket_un, HandlerType == stSignalInterrupt);
+}
+
+bool SocketSHMRing::isActive() const
+{
+    return my_rings.isActive();
+}
+
+bool SocketSHMRing::isDataReady()
+{
+    if (!my_rings.isActive()) {
+        return SocketUN::isDataReady();
+    }
+    return my_rings.isDataReady();
+}
+
+void SocketSHMRing::send(const unsigned char* buffer, size_t size)
+{
+    if (!my_rings.isActive()) {
+        SocketUN::send(buffer, size);
+        return;
+    }
+    my_rings.send(buffer, size);
+}
+
+void SocketSHMRing::receive(const unsigned char* buffer, size_t size)
+{
+    if (!my_rings.isActive()) {
+        SocketUN::receive(buffer, size);
+        return;
+    }
+    my_rings.receive(const_cast<unsigned char*>(buffer), size);
+}
+
+} // namespace certi
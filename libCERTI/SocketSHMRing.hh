@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_SOCKET_SHM_RING_HH
+#define CERTI_SOCKET_SHM_RING_HH
+
+#include <string>
+
+#include "SHMRingPair.hh"
+#include "SocketUN.hh"
+
+namespace certi {
+
+/**
+ * Shared memory transport between a federate (libRTI) and its RTIA.
+ *
+ * The messages go through the rings of a SHMRingPair, the Unix socket of
+ * the federate/RTIA link being kept as their doorbell. The RTIA can
+ * therefore keep waiting for both the federate and the RTIG in the same
+ * select() call: call isDataReady() right before select() and the socket
+ * becomes readable as soon as the federate sends.
+ *
+ * Until activate() is called every operation goes through the Unix socket,
+ * which is how the federate and the RTIA agree on the segment: the federate
+ * creates it and sends its name in M_Open_Connexion, the RTIA attaches it,
+ * answers (still on the socket) and both sides activate the rings.
+ */
+class CERTI_EXPORT SocketSHMRing : public SocketUN {
+public:
+    /// Default capacity of each ring, in bytes (must be a power of 2).
+    static constexpr size_t defaultRingSize = SHMRingPair::defaultRingSize;
+
+    SocketSHMRing(SignalHandlerType theType = stSignalInterrupt);
+    virtual ~SocketSHMRing();
+
+    /** Create the shared segment (federate side).
+     * @param ring_size capacity of each ring, rounded up to a power of 2
+     * @return the name to be given to the peer
+     */
+    std::string create(size_t ring_size = defaultRingSize);
+
+    /** Map a segment created by the peer (RTIA side).
+     * @param name the name returned by create() on the peer side
+     */
+    void attach(const std::string& name);
+
+    /// Use the rings from now on (no-op if no segment was created/attached).
+    void activate();
+
+    bool isActive() const;
+
+    virtual bool isDataReady() override;
+
+    virtual void send(const unsigned char*, size_t) override;
+    virtual void receive(const unsigned char*, size_t) override;
+
+private:
+    SHMRingPair my_rings;
+};
+
+} // namespace certi
+
+#endif // CERTI_SOCKET_SHM_RING_HH
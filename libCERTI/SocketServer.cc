@@ -23,10 +23,17 @@
 
 #include "PrettyDebug.hh"
 #include "SocketServer.hh"
+#ifdef SOCKTCP_LOCAL_SOCKET
+#include "SocketTCPSHMRing.hh"
+#endif
+
+#include <algorithm>
+#include <typeinfo>
 
 using std::list;
 
 namespace certi {
+static PrettyDebug D("SOCKSERVER", "(SocketServer) - ");
 static PrettyDebug G("GENDOC", __FILE__);
 
 // ----------------------------------------------------------------------------
@@ -85,6 +92,14 @@ void SocketServer::close(long socket, FederationHandle& federation_referenced, F
     // It may throw RTIinternalError.
     SocketTuple* tuple = getWithSocket(socket);
 
+#ifdef CERTI_RTIG_USE_IO_URING
+    my_reactor.unwatch(socket);
+    my_lost_links.erase(std::remove_if(my_lost_links.begin(),
+                                       my_lost_links.end(),
+                                       [socket](Socket* lost) { return lost->returnSocket() == socket; }),
+                        my_lost_links.end());
+#endif
+
     federation_referenced = tuple->Federation;
     federate_referenced = tuple->Federate;
 
@@ -185,7 +200,12 @@ SocketServer::getSocketLink(FederationHandle the_federation, FederateHandle the_
         if (tuple->BestEffortLink == 0) {
             return NULL;
         }
+        if (!tuple->BestEffortLink->isAttached()) {
+            // the RTIA has no UDP link, best effort messages go over TCP
+            return tuple->ReliableLink;
+        }
         //throw RTIinternalError("Reference to a killed Federate.");
+        // the datagrams keep the fixed size encoding, whatever the TCP link uses
         return tuple->BestEffortLink;
     }
     // G.Out(pdGendoc,"exit  SocketServer::getSocketLink without return");
@@ -229,23 +249,49 @@ SocketTuple* SocketServer::getWithSocket(long socket_descriptor) const
     throw RTIinternalError("Socket not found.");
 }
 
-void SocketServer::open()
+void SocketServer::open(SocketTCP* server)
 {
+    SocketTCP* newLink;
+#ifdef SOCKTCP_LOCAL_SOCKET
+    // the local links are not secured, they stay on the host,
+    // and the RTIA may ask them to go through shared memory
+    if (server && server->isLocal())
+        newLink = new SocketTCPSHMRing();
+    else
+#endif
 #ifdef WITH_GSSAPI
-    SecureTCPSocket* newLink = new SecureTCPSocket();
+        newLink = new SecureTCPSocket();
 #else
-    SocketTCP* newLink = new SocketTCP();
+        newLink = new SocketTCP();
 #endif
 
     if (newLink == NULL)
         throw RTIinternalError("Could not allocate new socket.");
 
-    newLink->accept(ServerSocketTCP);
+    newLink->accept(server ? server : ServerSocketTCP);
+
+#ifdef SOCKTCP_LOCAL_SOCKET
+    uid_t user;
+    pid_t process;
+    if (newLink->getPeerCredentials(user, process)) {
+        Debug(D, pdInit) << "Local link " << newLink->returnSocket() << " from process " << process << " of user "
+                         << user << std::endl;
+    }
+#endif
 
     SocketTuple* newTuple = new SocketTuple(newLink);
 
 #ifdef CERTI_RTIG_USE_EPOLL    
     addElementEpoll(newTuple->ReliableLink->returnSocket());
+#endif
+#ifdef CERTI_RTIG_USE_IO_URING
+    if (typeid(*newLink) == typeid(SocketTCP)) {
+        // read only by SocketTCP::receive, the reactor may receive for it
+        my_reactor.watch(newLink);
+    }
+    else {
+        my_reactor.watch(newLink->returnSocket());
+    }
 #endif
     if (newTuple == NULL)
         throw RTIinternalError("Could not allocate new tuple.");
@@ -268,7 +314,79 @@ void SocketServer::setReferences(long socket,
 
     tuple->Federation = federation_reference;
     tuple->Federate = federate_reference;
-    tuple->BestEffortLink->attach(ServerSocketUDP->returnSocket(), address, port);
+
+    // port 0: the RTIA does not receive best effort messages over UDP
+    if (ServerSocketUDP && port != 0) {
+        if (address == 0) {
+            // the RTIA listens on all its addresses, use the one it connected from
+            address = tuple->ReliableLink->returnAdress();
+        }
+        tuple->BestEffortLink->attach(*ServerSocketUDP, address, port, tuple->ReliableLink);
+    }
+}
+
+void SocketServer::flushBestEffort()
+{
+    if (ServerSocketUDP) {
+        ServerSocketUDP->flush();
+    }
+}
+
+void SocketServer::enableMulticast(in_addr_t base, unsigned int port, unsigned int threshold)
+{
+    if (!ServerSocketUDP) {
+        throw RTIinternalError("Multicast needs the UDP server socket");
+    }
+    my_multicast_base = base;
+    my_multicast_port = port;
+    my_multicast_threshold = threshold;
+    my_multicast_links.clear();
+}
+
+bool SocketServer::usesMulticast() const
+{
+    return my_multicast_base != 0;
+}
+
+in_addr_t SocketServer::getMulticastBase() const
+{
+    return my_multicast_base;
+}
+
+unsigned int SocketServer::getMulticastPort() const
+{
+    return my_multicast_port;
+}
+
+unsigned int SocketServer::getMulticastThreshold() const
+{
+    return my_multicast_threshold;
+}
+
+SocketUDP* SocketServer::getMulticastLink(SocketMC::Group kind, Handle handle)
+{
+    if (!usesMulticast() || !SocketMC::hasGroup(my_multicast_base, handle)) {
+        return NULL;
+    }
+
+    const in_addr_t group = SocketMC::groupAddress(my_multicast_base, kind, handle);
+    auto& link = my_multicast_links[group];
+    if (!link) {
+        // no fallback: the broadcast lists only use the group for messages which fit in a datagram
+        link.reset(new SocketUDP());
+        link->attach(*ServerSocketUDP, group, htons(my_multicast_port));
+    }
+    return link.get();
+}
+
+void SocketServer::enablePeerToPeer()
+{
+    my_peer_to_peer = true;
+}
+
+bool SocketServer::usesPeerToPeer() const
+{
+    return my_peer_to_peer;
 }
 
 #ifdef CERTI_RTIG_USE_POLL
@@ -327,4 +445,88 @@ Socket* SocketServer::getSocketFromFileDescriptor(int fd)
     return NULL;
 }
 #endif
+
+#ifdef CERTI_RTIG_USE_IO_URING
+Socket* SocketServer::getSocketFromFileDescriptor(int fd)
+{
+    for (const auto& tuple : *this) {
+        if (tuple->ReliableLink && tuple->ReliableLink->returnSocket() == fd) {
+            return tuple->ReliableLink;
+        }
+    }
+    return nullptr;
+}
+
+/// Whether the writes to socket can be left to io_uring.
+static bool writesPlainly(Socket* socket)
+{
+    if (typeid(*socket) == typeid(SocketTCP)) {
+        return true;
+    }
+#ifdef SOCKTCP_LOCAL_SOCKET
+    // a local link is a plain one until it goes through shared memory
+    auto local_link = dynamic_cast<SocketTCPSHMRing*>(socket);
+    return local_link && !local_link->isActive();
+#else
+    return false;
+#endif
+}
+
+void SocketServer::queueSend(NetworkMessage* message, const std::vector<Socket*>& sockets)
+{
+    // serialized at most once per wire format
+    MessageBuffer* frames[2] = {nullptr, nullptr};
+
+    for (const auto& socket : sockets) {
+        if (!socket || std::find(my_lost_links.begin(), my_lost_links.end(), socket) != my_lost_links.end()) {
+            continue;
+        }
+
+        const bool compact = socket->usesCompactEncoding();
+        if (!frames[compact]) {
+            if (my_used_send_buffers == my_send_buffers.size()) {
+                my_send_buffers.emplace_back(new MessageBuffer());
+            }
+            frames[compact] = my_send_buffers[my_used_send_buffers++].get();
+            message->serializeFrame(*frames[compact], compact, true);
+        }
+
+        if (my_reactor.usesIoUring() && writesPlainly(socket)) {
+            my_reactor.queueSend(static_cast<SocketTCP*>(socket), *frames[compact]);
+            continue;
+        }
+        // the shared memory and secured links write their own way
+        try {
+            NetworkMessage::sendFrame(socket, *frames[compact]);
+        }
+        catch (NetworkError& e) {
+            Debug(D, pdExcept) << "Lost link " << socket->returnSocket() << ": " << e.reason() << std::endl;
+            my_lost_links.push_back(socket);
+        }
+    }
+}
+
+void SocketServer::flushSends()
+{
+    std::vector<SocketTCP*> lost;
+    my_used_send_buffers = 0;
+    my_reactor.flushSends(lost);
+
+    for (auto socket : lost) {
+        if (std::find(my_lost_links.begin(), my_lost_links.end(), socket) == my_lost_links.end()) {
+            my_lost_links.push_back(socket);
+        }
+    }
+}
+
+Socket* SocketServer::popLostLink()
+{
+    if (my_lost_links.empty()) {
+        return nullptr;
+    }
+    auto socket = my_lost_links.front();
+    my_lost_links.erase(my_lost_links.begin());
+    return socket;
+}
+#endif
 }
@@ -28,11 +28,14 @@
 #include "SecureTCPSocket.hh"
 #include "SecurityLevel.hh"
 #include "Socket.hh"
+#include "SocketMC.hh"
 #include "SocketTCP.hh"
 #include "SocketUDP.hh"
 #include <include/certi.hh>
 
 #include <list>
+#include <map>
+#include <memory>
 #ifdef CERTI_RTIG_USE_POLL
 #include <poll.h>
 #endif
@@ -44,6 +47,10 @@
 #define MAX_CONNECTIONS     5
 #endif
 
+#ifdef CERTI_RTIG_USE_IO_URING
+#include "IoUringReactor.hh"
+#endif
+
 
 
 namespace certi {
@@ -83,8 +90,10 @@ public:
      * 
      * The SocketTuple references are empty.
      * Throw RTIinternalError in case of a memory allocation problem.
+     * @param server the socket to accept on, if not the TCP server socket
+     * (e.g. the local socket of the RTIG, see SocketTCP::createLocalServer)
      */
-    void open();
+    void open(SocketTCP* server = nullptr);
 
     /** Close and delete the Socket object whose socket is "Socket",
      * and return the former references associated with this socket in
@@ -168,6 +177,37 @@ public:
 	}
 	Socket* getSocketFromFileDescriptor(int fd);
 #endif
+
+#ifdef CERTI_RTIG_USE_IO_URING
+    /// Watch a server socket, the links are watched once accepted (see IoUringReactor).
+    void addElementIoUring(SocketTCP& server)
+    {
+        my_reactor.watchServer(&server);
+    }
+    /// Wait until some sockets are readable, see IoUringReactor::wait.
+    int waitIoUring(std::vector<int>& ready)
+    {
+        return my_reactor.wait(ready);
+    }
+    Socket* getSocketFromFileDescriptor(int fd);
+
+    /** Send a message to each socket of the list, as NetworkMessage::send
+     * does, except for the plain TCP links: the message is queued for them,
+     * and written with the other queued ones by flushSends().
+     * The message must live until then.
+     *
+     * A link which cannot be written to is lost: it may have missed a part of
+     * a frame, nothing more is written to it until it is closed. The link being
+     * served is not blamed for it, see popLostLink().
+     */
+    void queueSend(NetworkMessage* message, const std::vector<Socket*>& sockets);
+
+    /// Write the messages queued by queueSend(), see IoUringReactor::flushSends.
+    void flushSends();
+
+    /// A link lost by queueSend() or flushSends() and not closed yet, NULL if none.
+    Socket* popLostLink();
+#endif
     // ------------------------------------------
     // -- Message Broadcasting related Methods --
     // ------------------------------------------
@@ -189,6 +229,33 @@ public:
 
     SocketTuple* getWithReferences(FederationHandle the_federation, FederateHandle the_federate) const;
 
+    /// Send the best effort messages queued on the UDP links.
+    void flushBestEffort();
+
+    /** Send the best effort messages of the heavily subscribed classes to
+     * IP multicast groups, through the UDP server socket.
+     * @param base address of the first group, in network byte order (see SocketMC::groupAddress)
+     * @param port port the groups are sent to
+     * @param threshold least number of subscribers a message reaches through a group
+     */
+    void enableMulticast(in_addr_t base, unsigned int port, unsigned int threshold);
+
+    bool usesMulticast() const;
+    in_addr_t getMulticastBase() const;
+    unsigned int getMulticastPort() const;
+    unsigned int getMulticastThreshold() const;
+
+    /// Link sending to the group of a class, NULL if multicast is not used or the class has no group.
+    SocketUDP* getMulticastLink(SocketMC::Group kind, Handle handle);
+
+    /** Let the RTIAs send the updates without time stamp directly to the
+     * RTIAs of the subscribers: the federations then send them the routes
+     * (NM_Peer_Route) instead of reflecting those updates.
+     */
+    void enablePeerToPeer();
+
+    bool usesPeerToPeer() const;
+
     FederateHandle getFederateFromSocket(FederationHandle the_federation, Socket* socket) const;
 
 private:
@@ -196,6 +263,15 @@ private:
     SocketTCP* ServerSocketTCP;
     SocketUDP* ServerSocketUDP;
 
+    in_addr_t my_multicast_base {0};
+    unsigned int my_multicast_port {0};
+    unsigned int my_multicast_threshold {0};
+
+    /// Logical links to the groups, created on first use.
+    std::map<in_addr_t, std::unique_ptr<SocketUDP>> my_multicast_links;
+
+    bool my_peer_to_peer {false};
+
     // ---------------------
     // -- Private Methods --
     // ---------------------
@@ -210,6 +286,15 @@ private:
     // use with epoll
 	int _Epollfd;
 	#endif
+
+#ifdef CERTI_RTIG_USE_IO_URING
+    IoUringReactor my_reactor;
+    /// frames queued by queueSend(), reused from one flushSends() to the next
+    std::vector<std::unique_ptr<MessageBuffer>> my_send_buffers;
+    size_t my_used_send_buffers {0};
+    /// links which could not be written to, until they are closed
+    std::vector<Socket*> my_lost_links;
+#endif
 };
 
 } // namespace certi
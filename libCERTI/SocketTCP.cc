@@ -19,18 +19,31 @@
 //
 // ----------------------------------------------------------------------------
 
+#include "config.h"
 #include "PrettyDebug.hh"
 #include "SocketTCP.hh"
+#ifdef HAVE_LINUX_IO_URING_H
+#include "IoUringReactor.hh"
+#endif
 
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
+#include <climits>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
+#ifdef SOCKTCP_LOCAL_SOCKET
+#include <ifaddrs.h>
+#include <sys/un.h>
+#endif
 
 using std::cout;
 using std::endl;
@@ -40,6 +53,24 @@ namespace certi {
 static PrettyDebug D("SOCKTCP", "(SocketTCP) - ");
 static PrettyDebug G("GENDOC", __FILE__);
 
+#ifdef SOCKTCP_LOCAL_SOCKET
+namespace {
+/// Address of name in the abstract namespace: a leading null byte, not a path.
+struct sockaddr_un localAddress(const std::string& name, socklen_t& length)
+{
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+
+    const size_t size = std::min(name.size(), sizeof(address.sun_path) - 1);
+    memcpy(address.sun_path + 1, name.data(), size);
+    length = offsetof(struct sockaddr_un, sun_path) + 1 + size;
+
+    return address;
+}
+}
+#endif
+
 #ifdef _WIN32
 int SocketTCP::winsockInits = 0;
 
@@ -88,6 +119,7 @@ SocketTCP::SocketTCP()
 {
     _socket_tcp = 0;
     _est_init_tcp = false;
+    _local = false;
 
     SentBytesCount = 0;
     RcvdBytesCount = 0;
@@ -97,6 +129,7 @@ SocketTCP::SocketTCP()
 #endif
 
 #ifdef SOCKTCP_BUFFER_LENGTH
+    RBOffset = 0;
     RBLength = 0;
 #endif
 }
@@ -126,7 +159,7 @@ SocketTCP::~SocketTCP()
 }
 
 // ----------------------------------------------------------------------------
-int SocketTCP::connect(in_port_t port, in_addr_t addr)
+int SocketTCP::connect(in_port_t port, in_addr_t addr, int timeout)
 {
     int Result;
     struct protoent* TCPent;
@@ -138,7 +171,31 @@ int SocketTCP::connect(in_port_t port, in_addr_t addr)
     _sockIn.sin_port = htons(port);
     _sockIn.sin_addr.s_addr = addr;
 
-    Result = ::connect(_socket_tcp, (sockaddr*) &_sockIn, sizeof(_sockIn));
+#ifndef _WIN32
+    if (timeout >= 0) {
+        const int flags = fcntl(_socket_tcp, F_GETFL);
+        fcntl(_socket_tcp, F_SETFL, flags | O_NONBLOCK);
+        Result = ::connect(_socket_tcp, (sockaddr*) &_sockIn, sizeof(_sockIn));
+        if (Result < 0 && errno == EINPROGRESS) {
+            struct pollfd connecting = {_socket_tcp, POLLOUT, 0};
+            int error = 0;
+            socklen_t length = sizeof(error);
+            if (poll(&connecting, 1, timeout) == 1
+                && getsockopt(_socket_tcp, SOL_SOCKET, SO_ERROR, &error, &length) == 0) {
+                errno = error;
+                Result = error ? -1 : 0;
+            }
+            else {
+                errno = ETIMEDOUT;
+            }
+        }
+        fcntl(_socket_tcp, F_SETFL, flags);
+    }
+    else
+#endif
+    {
+        Result = ::connect(_socket_tcp, (sockaddr*) &_sockIn, sizeof(_sockIn));
+    }
 
     if (Result < 0)
         return 0;
@@ -179,11 +236,31 @@ int SocketTCP::accept(SocketTCP* server)
 
     l = sizeof(_sockIn);
 
-    _socket_tcp = ::accept(server->_socket_tcp, (sockaddr*) &_sockIn, &l);
+#ifdef HAVE_LINUX_IO_URING_H
+    if (server->my_reactor) {
+        // the reactor may have accepted it already
+        _socket_tcp = server->my_reactor->accept(server);
+        if (_socket_tcp >= 0) {
+            getpeername(_socket_tcp, (sockaddr*) &_sockIn, &l);
+        }
+    }
+    else
+#endif
+        _socket_tcp = ::accept(server->_socket_tcp, (sockaddr*) &_sockIn, &l);
     if (_socket_tcp < 0) {
         throw NetworkError("SocketTCP: Accept Failed <" + std::string(strerror(errno)) + ">");
     }
 
+    if (server->_local) {
+        // no Nagle algorithm to disable, the peer is on this host
+        _sockIn.sin_family = AF_INET;
+        _sockIn.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        _sockIn.sin_port = 0;
+        _local = true;
+        _est_init_tcp = true;
+        return 1;
+    }
+
     // Set the TCP_NODELAY option(Server Side)
     TCPent = getprotobyname("tcp");
     if (TCPent == NULL) {
@@ -252,6 +329,12 @@ void SocketTCP::createConnection(const char* server_name, unsigned int port)
 
 // ----------------------------------------------------------------------------
 void SocketTCP::createTCPClient(in_port_t port, in_addr_t addr)
+{
+    createTCPClient(port, addr, -1);
+}
+
+// ----------------------------------------------------------------------------
+void SocketTCP::createTCPClient(in_port_t port, in_addr_t addr, int timeout)
 {
     assert(!_est_init_tcp);
     if (!open()) {
@@ -260,7 +343,14 @@ void SocketTCP::createTCPClient(in_port_t port, in_addr_t addr)
                            + strerror(errno));
     }
 
-    if (!connect(port, addr)) {
+    if (!connect(port, addr, timeout)) {
+        const int error = errno;
+#ifdef _WIN32
+        ::closesocket(_socket_tcp);
+#else
+        ::close(_socket_tcp);
+#endif
+        errno = error;
         throw NetworkError("Cannot connect port <" + std::to_string(port) + "> on addr <" + addr2string(addr)
                            + "> : error ="
                            + strerror(errno));
@@ -271,6 +361,13 @@ void SocketTCP::createTCPClient(in_port_t port, in_addr_t addr)
 
 // ----------------------------------------------------------------------------
 void SocketTCP::createServer(in_port_t port, in_addr_t addr)
+{
+    reserveServer(port, addr);
+    listenServer();
+}
+
+// ----------------------------------------------------------------------------
+void SocketTCP::reserveServer(in_port_t port, in_addr_t addr)
 {
     assert(!_est_init_tcp);
 
@@ -286,15 +383,115 @@ void SocketTCP::createServer(in_port_t port, in_addr_t addr)
                            + strerror(errno));
     }
 
-    if (!listen(MAX_BACKLOG)) {
-        throw NetworkError("Cannot listen port <" + std::to_string(port) + "> on addr <" + addr2string(addr)
+    _est_init_tcp = true;
+}
+
+// ----------------------------------------------------------------------------
+void SocketTCP::listenServer()
+{
+    assert(_est_init_tcp);
+
+    if (::listen(_socket_tcp, MAX_BACKLOG) < 0) {
+        throw NetworkError("Cannot listen port <" + std::to_string(ntohs(getPort())) + "> on addr <"
+                           + addr2string(getAddr())
                            + "> : error ="
                            + strerror(errno));
     }
+}
+
+#ifdef SOCKTCP_LOCAL_SOCKET
+// ----------------------------------------------------------------------------
+void SocketTCP::createLocalServer(const std::string& name)
+{
+    assert(!_est_init_tcp);
+
+    socklen_t length;
+    struct sockaddr_un address = localAddress(name, length);
+
+    if ((_socket_tcp = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+        throw NetworkError("Cannot open local socket <" + name + "> : error =" + strerror(errno));
+    }
+
+    if (::bind(_socket_tcp, (sockaddr*) &address, length) < 0 || !listen(MAX_BACKLOG)) {
+        const std::string error = strerror(errno);
+        ::close(_socket_tcp);
+        throw NetworkError("Cannot listen on local socket <" + name + "> : error =" + error);
+    }
+
+    _local = true;
+    _est_init_tcp = true;
+}
+
+// ----------------------------------------------------------------------------
+void SocketTCP::createLocalClient(const std::string& name)
+{
+    assert(!_est_init_tcp);
+
+    socklen_t length;
+    struct sockaddr_un address = localAddress(name, length);
+
+    if ((_socket_tcp = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+        throw NetworkError("Cannot open local socket <" + name + "> : error =" + strerror(errno));
+    }
+
+    if (::connect(_socket_tcp, (sockaddr*) &address, length) < 0) {
+        const std::string error = strerror(errno);
+        ::close(_socket_tcp);
+        throw NetworkError("Cannot connect to local socket <" + name + "> : error =" + error);
+    }
+
+    memset(&_sockIn, 0, sizeof(_sockIn));
+    _sockIn.sin_family = AF_INET;
+    _sockIn.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
 
+    _local = true;
     _est_init_tcp = true;
 }
 
+// ----------------------------------------------------------------------------
+bool SocketTCP::getPeerCredentials(uid_t& user, pid_t& process) const
+{
+    struct ucred credentials;
+    socklen_t length = sizeof(credentials);
+
+    if (!_local || getsockopt(_socket_tcp, SOL_SOCKET, SO_PEERCRED, &credentials, &length) < 0) {
+        return false;
+    }
+
+    user = credentials.uid;
+    process = credentials.pid;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+bool SocketTCP::isLocalAddress(in_addr_t addr)
+{
+    if ((ntohl(addr) >> IN_CLASSA_NSHIFT) == IN_LOOPBACKNET) {
+        return true;
+    }
+
+    struct ifaddrs* interfaces;
+    if (getifaddrs(&interfaces) < 0) {
+        return false;
+    }
+
+    bool found = false;
+    for (struct ifaddrs* i = interfaces; i != NULL && !found; i = i->ifa_next) {
+        found = i->ifa_addr != NULL && i->ifa_addr->sa_family == AF_INET
+            && ((struct sockaddr_in*) i->ifa_addr)->sin_addr.s_addr == addr;
+    }
+
+    freeifaddrs(interfaces);
+    return found;
+}
+#endif
+
+// ----------------------------------------------------------------------------
+bool SocketTCP::isLocal() const
+{
+    return _local;
+}
+
 // ----------------------------------------------------------------------------
 void SocketTCP::send(const unsigned char* buffer, size_t size)
 {
@@ -340,6 +537,63 @@ void SocketTCP::send(const unsigned char* buffer, size_t size)
     SentBytesCount += total_sent;
 }
 
+#ifndef _WIN32
+// ----------------------------------------------------------------------------
+void SocketTCP::sendSegments(const std::vector<libhla::MessageBuffer::Segment>& segments)
+{
+    assert(_est_init_tcp);
+
+    std::vector<struct iovec> iov;
+    iov.reserve(segments.size());
+    for (const auto& segment : segments) {
+        if (segment.length > 0) {
+            iov.push_back({const_cast<uint8_t*>(segment.data), segment.length});
+        }
+    }
+
+    Debug(D, pdDebug) << "Beginning to send TCP message in " << iov.size() << " segments..." << std::endl;
+
+    long total_sent = 0;
+    size_t first = 0;
+    while (first < iov.size()) {
+        const int count = static_cast<int>(std::min<size_t>(iov.size() - first, IOV_MAX));
+        ssize_t sent = ::writev(_socket_tcp, &iov[first], count);
+
+        if (sent < 0) {
+            Debug(D, pdExcept) << "Error while sending on TCP socket." << std::endl;
+
+            if (errno == EINTR) {
+                throw NetworkSignal("");
+            }
+            else {
+                perror("TCP Socket(EmettreTCP) ");
+                throw NetworkError("Error while sending TCP message.");
+            }
+        }
+
+        if (sent == 0) {
+            Debug(D, pdExcept) << "No data could be sent, connection closed?." << std::endl;
+            throw NetworkError("Could not send any data on TCP socket.");
+        }
+
+        total_sent += sent;
+        Debug(D, pdTrace) << "Sent " << total_sent << " bytes" << std::endl;
+
+        // skip what has been sent, the last segment may be partially sent
+        while (first < iov.size() && static_cast<size_t>(sent) >= iov[first].iov_len) {
+            sent -= iov[first].iov_len;
+            ++first;
+        }
+        if (first < iov.size()) {
+            iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + sent;
+            iov[first].iov_len -= sent;
+        }
+    }
+
+    SentBytesCount += total_sent;
+}
+#endif
+
 // ----------------------------------------------------------------------------
 void SocketTCP::close()
 {
@@ -350,6 +604,7 @@ void SocketTCP::close()
         ::close(_socket_tcp);
 #endif
         _est_init_tcp = false;
+        _local = false;
     }
 }
 
@@ -380,12 +635,29 @@ in_port_t SocketTCP::getPort() const
 bool SocketTCP::isDataReady() const
 {
 #ifdef SOCKTCP_BUFFER_LENGTH
-    return RBLength > 0;
+    if (RBLength > 0) {
+        return true;
+    }
+#endif
+#ifdef HAVE_LINUX_IO_URING_H
+    return my_reactor && my_reactor->hasReceived(const_cast<SocketTCP*>(this));
 #else
     return false;
 #endif
 }
 
+// ----------------------------------------------------------------------------
+const unsigned char* SocketTCP::bufferedData(size_t& length) const
+{
+#ifdef SOCKTCP_BUFFER_LENGTH
+    length = RBLength;
+    return reinterpret_cast<const unsigned char*>(ReadBuffer + RBOffset);
+#else
+    length = 0;
+    return nullptr;
+#endif
+}
+
 // ----------------------------------------------------------------------------
 int SocketTCP::open()
 {
@@ -401,6 +673,7 @@ SocketTCP& SocketTCP::operator=(SocketTCP& theSocket)
     _sockIn.sin_addr.s_addr = theSocket.getAddr();
     _sockIn.sin_port = theSocket.getPort();
     _socket_tcp = theSocket.returnSocket();
+    _local = theSocket._local;
 
     return (*this);
 }
@@ -412,17 +685,30 @@ void SocketTCP::receive(void* buffer, unsigned long size)
     assert(_est_init_tcp);
 
     long nReceived = 0;
-#ifndef SOCKTCP_BUFFER_LENGTH
-    unsigned long RBLength = 0;
-#endif
+    unsigned long copied = 0;
 
     Debug(D, pdDebug) << "Beginning to receive TCP message of size " << size << std::endl;
 
-    while (RBLength < size) {
 #ifdef SOCKTCP_BUFFER_LENGTH
-        nReceived = recv(_socket_tcp, ReadBuffer + RBLength, SOCKTCP_BUFFER_LENGTH - RBLength, 0);
+    // First serve what has already been read ahead
+    copied = std::min(size, RBLength);
+    memcpy(buffer, ReadBuffer + RBOffset, copied);
+    RBOffset += copied;
+    RBLength -= copied;
+#endif
+
+    while (copied < size) {
+#ifdef SOCKTCP_BUFFER_LENGTH
+        // Read ahead as much as possible, unless the data would not fit anyway
+        const bool direct = size - copied >= SOCKTCP_BUFFER_LENGTH;
+        if (direct) {
+            nReceived = readSome((char*) buffer + copied, size - copied);
+        }
+        else {
+            nReceived = readSome(ReadBuffer, SOCKTCP_BUFFER_LENGTH);
+        }
 #else
-        nReceived = recv(_socket_tcp, (char*) buffer + RBLength, size - RBLength, 0);
+        nReceived = readSome((char*) buffer + copied, size - copied);
 #endif
 
         if (nReceived < 0) {
@@ -445,19 +731,36 @@ void SocketTCP::receive(void* buffer, unsigned long size)
             throw NetworkError("Connection closed by client.");
         }
 
-        RBLength += nReceived;
         RcvdBytesCount += nReceived;
-    }
-    Debug(D, pdTrace) << "Received " << RBLength << " bytes out of " << size << std::endl;
 
 #ifdef SOCKTCP_BUFFER_LENGTH
-    memcpy(buffer, (void*) ReadBuffer, size);
-    memmove((void*) ReadBuffer, (void*) (ReadBuffer + size), RBLength - size);
-    RBLength -= size;
+        if (!direct) {
+            // the read buffer was empty: keep what the caller did not ask for
+            const unsigned long used = std::min<unsigned long>(nReceived, size - copied);
+            memcpy((char*) buffer + copied, ReadBuffer, used);
+            RBOffset = used;
+            RBLength = nReceived - used;
+            copied += used;
+            continue;
+        }
 #endif
+        copied += nReceived;
+    }
+    Debug(D, pdTrace) << "Received " << copied << " bytes out of " << size << std::endl;
     // G.Out(pdGendoc,"exit  SocketTCP::receive");
 }
 
+// ----------------------------------------------------------------------------
+long SocketTCP::readSome(void* buffer, unsigned long size)
+{
+#ifdef HAVE_LINUX_IO_URING_H
+    if (my_reactor) {
+        return my_reactor->receive(this, buffer, size);
+    }
+#endif
+    return recv(_socket_tcp, (char*) buffer, size, 0);
+}
+
 // ----------------------------------------------------------------------------
 unsigned long SocketTCP::returnAdress() const
 {
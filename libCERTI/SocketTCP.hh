@@ -23,13 +23,21 @@
 #include "Socket.hh"
 #include <include/certi.hh>
 
-// This is the read buffer of TCP sockets. It must be at least as long
-// as the longest data ever received by a socket.
+// This is the read buffer of TCP sockets. Longer data are received
+// directly in the caller's buffer.
 // If the next line is commented out, no buffer will be used at all.
-//#define SOCKTCP_BUFFER_LENGTH 4096
+#define SOCKTCP_BUFFER_LENGTH 65536
+
+// Stream sockets of the Unix domain named in the abstract namespace of
+// Linux, see SocketTCP::createLocalServer.
+#ifdef __linux__
+#define SOCKTCP_LOCAL_SOCKET
+#endif
 
 namespace certi {
 
+class IoUringReactor;
+
 /** This TCP socket implementation uses a Read Buffer to
   improve global read performances(by reducing Recv system calls). An
   important drawback of this improvement is that a socket can be marked as
@@ -48,14 +56,60 @@ public:
 
     virtual void createConnection(const char* server_name, unsigned int port);
     void createTCPClient(in_port_t port, in_addr_t addr);
+
+    /** Give up connecting after timeout milliseconds, instead of the long
+     * delay of the system for a host which does not answer.
+     */
+    void createTCPClient(in_port_t port, in_addr_t addr, int timeout);
+
     void createServer(in_port_t port = 0, in_addr_t addr = INADDR_ANY);
 
+    /** Bind a server socket which does not accept anything yet: its port can
+     * be given away before the links are accepted, after listenServer().
+     */
+    void reserveServer(in_port_t port = 0, in_addr_t addr = INADDR_ANY);
+
+    /// Accept the links on the socket bound by reserveServer().
+    void listenServer();
+
+#ifdef SOCKTCP_LOCAL_SOCKET
+    /** Listen on a stream socket of the Unix domain instead of TCP, named in
+     * the abstract namespace: there is no file to remove, the name goes away
+     * with the socket. The links accepted on it are local too, the same
+     * messages go through them with less work for the kernel.
+     */
+    void createLocalServer(const std::string& name);
+
+    /// Connect to a server created by createLocalServer() on this host.
+    void createLocalClient(const std::string& name);
+
+    /** User and process at the other end of a local link, given by the kernel.
+     * @return false if the link is not local
+     */
+    bool getPeerCredentials(uid_t& user, pid_t& process) const;
+
+    /// Whether addr is an address of this host, loopback included.
+    static bool isLocalAddress(in_addr_t addr);
+#endif
+
+    /// Whether the socket is of the Unix domain, its address is then the loopback.
+    bool isLocal() const;
+
     int accept(SocketTCP* server);
     virtual void send(const unsigned char*, size_t);
+#ifndef _WIN32
+    /// Gather write, large attribute values are not copied (see MessageBuffer::setSegmented)
+    virtual void sendSegments(const std::vector<libhla::MessageBuffer::Segment>& segments);
+#endif
     virtual void receive(void* buffer, unsigned long size);
 
     virtual bool isDataReady() const;
 
+    /** Data already read from the system socket and not received yet.
+     * @param[out] length number of bytes available at the returned address
+     */
+    const unsigned char* bufferedData(size_t& length) const;
+
     virtual unsigned long returnAdress() const;
 
     SocketTCP& operator=(SocketTCP& theSocket);
@@ -74,12 +128,19 @@ public:
 protected:
     int timeoutTCP(int, int);
 
+    /// writes the frames queued for the link and counts them, receives for it
+    friend class IoUringReactor;
+
     ByteCount_t SentBytesCount;
     ByteCount_t RcvdBytesCount;
 
 private:
+    /// At most size bytes, as recv().
+    long readSome(void* buffer, unsigned long size);
+
     int open();
-    int connect(in_port_t port, in_addr_t addr);
+    /// @param timeout in milliseconds, negative to wait as long as the system does
+    int connect(in_port_t port, in_addr_t addr, int timeout = -1);
     int listen(unsigned long howMuch = 5);
     int bind(in_port_t port = 0, in_addr_t addr = INADDR_ANY);
     void setPort(in_port_t port);
@@ -91,6 +152,7 @@ private:
     static int winsockInits;
 #endif
     bool _est_init_tcp;
+    bool _local;
     struct sockaddr_in _sockIn;
 
 #ifdef SOCKTCP_BUFFER_LENGTH
@@ -98,8 +160,13 @@ private:
     // when reading a lot of small amouts of data. Each time a Receive
     // is made, it will try to read SOCKTCP_BUFFER_LENGTH
     char ReadBuffer[SOCKTCP_BUFFER_LENGTH];
+    /// first byte not received yet
+    unsigned long RBOffset;
     unsigned long RBLength;
 #endif
+
+    /// receives the data of the link or accepts for the server when set, see IoUringReactor::watch
+    IoUringReactor* my_reactor{nullptr};
 };
 
 } // namespace certi
@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#include "SocketTCPSHMRing.hh"
+
+#include <cassert>
+
+namespace certi {
+
+std::string SocketTCPSHMRing::create(size_t ring_size)
+{
+    assert(isLocal());
+    return my_rings.create("/certi_rtig_", ring_size);
+}
+
+void SocketTCPSHMRing::attach(const std::string& name)
+{
+    assert(isLocal());
+    my_rings.attach(name);
+}
+
+void SocketTCPSHMRing::activate()
+{
+    // the doorbell is read like the socket, a signal interrupts it
+    my_rings.activate(returnSocket(), true);
+}
+
+void SocketTCPSHMRing::setSendTimeout(int milliseconds)
+{
+    my_rings.setSendTimeout(milliseconds);
+}
+
+void SocketTCPSHMRing::release()
+{
+    my_rings.release();
+}
+
+bool SocketTCPSHMRing::isActive() const
+{
+    return my_rings.isActive();
+}
+
+void SocketTCPSHMRing::close()
+{
+    my_rings.release();
+    SocketTCP::close();
+}
+
+bool SocketTCPSHMRing::isDataReady() const
+{
+    if (!my_rings.isActive()) {
+        return SocketTCP::isDataReady();
+    }
+    return my_rings.isDataReady();
+}
+
+void SocketTCPSHMRing::send(const unsigned char* buffer, size_t size)
+{
+    if (!my_rings.isActive()) {
+        SocketTCP::send(buffer, size);
+        return;
+    }
+    my_rings.send(buffer, size);
+    SentBytesCount += size;
+}
+
+void SocketTCPSHMRing::sendSegments(const std::vector<libhla::MessageBuffer::Segment>& segments)
+{
+    if (!my_rings.isActive()) {
+        SocketTCP::sendSegments(segments);
+        return;
+    }
+    // the peer reads the message as the bytes come, no need to gather them first
+    for (const auto& segment : segments) {
+        my_rings.send(segment.data, segment.length);
+        SentBytesCount += segment.length;
+    }
+}
+
+void SocketTCPSHMRing::receive(void* buffer, unsigned long size)
+{
+    if (!my_rings.isActive()) {
+        SocketTCP::receive(buffer, size);
+        return;
+    }
+    my_rings.receive(static_cast<unsigned char*>(buffer), size);
+    RcvdBytesCount += size;
+}
+
+} // namespace certi
@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_SOCKET_TCP_SHM_RING_HH
+#define CERTI_SOCKET_TCP_SHM_RING_HH
+
+#include <string>
+
+#include "SHMRingPair.hh"
+#include "SocketTCP.hh"
+
+namespace certi {
+
+/**
+ * Shared memory transport between the RTIG and an RTIA of its host.
+ *
+ * A local link (see SocketTCP::createLocalServer) whose messages go through
+ * the rings of a SHMRingPair, the Unix socket being kept as their doorbell:
+ * it stays in the select() of the RTIG with the other links, and sending a
+ * message to several local RTIAs costs a copy into each of their rings.
+ *
+ * Until activate() is called every operation goes through the socket,
+ * which is how the RTIA and the RTIG agree on the segment: the RTIA
+ * creates it and sends its name in NM_Shm_Rings, the RTIG attaches it,
+ * answers (still on the socket) and both sides activate the rings.
+ */
+class CERTI_EXPORT SocketTCPSHMRing : public SocketTCP {
+public:
+    SocketTCPSHMRing() = default;
+    virtual ~SocketTCPSHMRing() = default;
+
+    /** Create the shared segment (RTIA side).
+     * @param ring_size capacity of each ring, rounded up to a power of 2
+     * @return the name to be given to the RTIG
+     */
+    std::string create(size_t ring_size = SHMRingPair::defaultRingSize);
+
+    /** Map a segment created by the RTIA (RTIG side).
+     * @param name the name returned by create() on the RTIA side
+     */
+    void attach(const std::string& name);
+
+    /// Use the rings from now on (no-op if no segment was created/attached).
+    void activate();
+
+    /// Throw NetworkError when the peer leaves its ring full that long, see SHMRingPair.
+    void setSendTimeout(int milliseconds);
+
+    /// Forget the segment the RTIG refused: the socket is used alone.
+    void release();
+
+    bool isActive() const;
+
+    /// Closes the socket and unmaps the segment.
+    virtual void close() override;
+
+    /** With the rings, asks the peer to ring the doorbell when there is
+     * nothing to read, see SHMRingPair.
+     */
+    virtual bool isDataReady() const override;
+
+    virtual void send(const unsigned char*, size_t) override;
+    virtual void sendSegments(const std::vector<libhla::MessageBuffer::Segment>& segments) override;
+    virtual void receive(void* buffer, unsigned long size) override;
+
+private:
+    /// isDataReady() arms the doorbell
+    mutable SHMRingPair my_rings;
+};
+
+} // namespace certi
+
+#endif // CERTI_SOCKET_TCP_SHM_RING_HH
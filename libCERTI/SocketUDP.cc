@@ -17,9 +17,12 @@
 // Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 // ----------------------------------------------------------------------------
 
+#include "config.h"
+
 #include "PrettyDebug.hh"
 #include "SocketUDP.hh"
 #include "certi.hh"
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -41,24 +44,37 @@ namespace certi {
 
 static PrettyDebug D("SOCKUDP", "(SocketUDP) - ");
 
+constexpr size_t SocketUDP::defaultMaxDatagramSize;
+constexpr size_t SocketUDP::maxDatagramSize;
+constexpr unsigned int SocketUDP::batchSize;
+
 // ----------------------------------------------------------------------------
-void SocketUDP::attach(int socket_ouvert, unsigned long Adresse, unsigned int port)
+void SocketUDP::attach(SocketUDP& server, in_addr_t address, in_port_t port, Socket* fallback)
 {
     assert(!_est_init_udp);
+    assert(server.PhysicalLink);
 
     PhysicalLink = false;
 
-    _socket_udp = socket_ouvert;
+    my_server = &server;
+    my_fallback = fallback;
+    _socket_udp = server.returnSocket();
     // Building Distant Address
-    memset((struct sockaddr_in*) &sock_distant, 0, sizeof(struct sockaddr_in));
+    memset(&sock_distant, 0, sizeof(struct sockaddr_in));
 
-    sock_distant.sin_addr.s_addr = htonl(Adresse);
+    sock_distant.sin_addr.s_addr = address;
     sock_distant.sin_family = AF_INET;
     sock_distant.sin_port = port;
 
     _est_init_udp = true;
 
-    Debug(D, pdDebug) << "Attaching the federate to his address and to his peer..." << std::endl;
+    Debug(D, pdDebug) << "Attaching the federate to " << addr2string(address) << ":" << ntohs(port) << std::endl;
+}
+
+// ----------------------------------------------------------------------------
+bool SocketUDP::isAttached() const
+{
+    return !PhysicalLink && _est_init_udp;
 }
 
 // ----------------------------------------------------------------------------
@@ -76,8 +92,6 @@ int SocketUDP::bind()
 void SocketUDP::createConnection(const char* /*server_name*/, unsigned int /*port*/)
 {
     struct sockaddr_in sock_temp;
-    char localhost[4096];
-    struct hostent* hp_local;
 
 #ifdef _WIN32 //netDot
     int taille = sizeof(struct sockaddr_in);
@@ -87,21 +101,13 @@ void SocketUDP::createConnection(const char* /*server_name*/, unsigned int /*por
 
     assert(!_est_init_udp);
 
-    // Building Local Address
+    // Building Local Address: the RTIG sends to the address it sees the
+    // RTIA connecting from, which suits NAT and multi-homed hosts better
+    // than the first address of the host name.
     memset(&sock_local, 0, sizeof(struct sockaddr_in));
-    hp_local = NULL;
-
-    gethostname(localhost, 4096);
-
-    if ((hp_local = gethostbyname(localhost)) == NULL) {
-        throw NetworkError("gethostbyname gave NULL answer for hostname <" + std::string(localhost) + "> with error <"
-                           + strerror(errno)
-                           + ">");
-    }
-
-    memcpy((char*) &sock_local.sin_addr, (char*) hp_local->h_addr, hp_local->h_length);
 
     // lors du BIND, le systeme alloue un port libre au socket _sock_udp
+    sock_local.sin_addr.s_addr = htonl(INADDR_ANY);
     sock_local.sin_family = AF_INET;
     sock_local.sin_port = 0;
 
@@ -146,25 +152,22 @@ void SocketUDP::createServer(unsigned int port, in_addr_t addr)
 
 // ----------------------------------------------------------------------------
 SocketUDP::SocketUDP()
+    : PhysicalLink(true)
+    , _socket_udp(-1)
+    , _est_init_udp(false)
+    , SentBytesCount(0)
+    , RcvdBytesCount(0)
+    , DroppedCount(0)
+    , my_server(nullptr)
+    , my_fallback(nullptr)
+    , my_max_datagram_size(defaultMaxDatagramSize)
+    , my_outbox_count(0)
+    , my_inbox_count(0)
+    , my_inbox_head(0)
+    , my_read_offset(0)
 {
-    PhysicalLink = true;
-
-    _socket_udp = 0;
-
     memset(&sock_local, 0, sizeof(struct sockaddr_in));
-    memset(&sock_source, 0, sizeof(struct sockaddr_in));
-    Addr_Source = NULL;
-    Port_Source = 0;
-
     memset(&sock_distant, 0, sizeof(struct sockaddr_in));
-    hp_distant = NULL;
-
-    _sock_local_length = 0;
-    _est_init_udp = false;
-
-    SentBytesCount = 0;
-    RcvdBytesCount = 0;
-    BufferSize = 0;
 
 #ifdef _WIN32 //netDot
     SocketTCP::winsockStartup();
@@ -193,22 +196,176 @@ SocketUDP::~SocketUDP()
     cout << _socket_udp << " : total = ";
     cout.width(9);
     cout << RcvdBytesCount << " Bytes received" << endl;
+    cout << " UDP Socket ";
+    cout.width(2);
+    cout << _socket_udp << " : total = ";
+    cout.width(9);
+    cout << DroppedCount << " Datagrams dropped" << endl;
 #endif
 }
 
+// ----------------------------------------------------------------------------
+bool SocketUDP::tooLarge(size_t size) const
+{
+    const SocketUDP& physical = PhysicalLink ? *this : *my_server;
+    if (size <= physical.my_max_datagram_size) {
+        return false;
+    }
+
+    if (my_fallback) {
+        Debug(D, pdDebug) << "Message of " << size << " bytes sent on the fallback link" << std::endl;
+    }
+    else {
+        Debug(D, pdError) << "Message of " << size << " bytes does not fit in a datagram, dropped" << std::endl;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+unsigned char* SocketUDP::queue(const struct sockaddr_in& destination, size_t size)
+{
+    if (my_outbox_count == batchSize) {
+        flush();
+    }
+    if (my_outbox.size() == my_outbox_count) {
+        my_outbox.emplace_back();
+    }
+
+    Datagram& datagram = my_outbox[my_outbox_count++];
+    datagram.destination = destination;
+    datagram.bytes.resize(size);
+    return datagram.bytes.data();
+}
+
 // ----------------------------------------------------------------------------
 void SocketUDP::send(const unsigned char* Message, size_t Size)
 {
-    Debug(D, pdDebug) << "Beginning to send UDP message... Size = " << Size << std::endl;
+    Debug(D, pdDebug) << "Queueing UDP message... Size = " << Size << std::endl;
     assert(_est_init_udp);
 
-    int sent = sendto(_socket_udp, (char*) Message, Size, 0, (struct sockaddr*) &sock_distant, sizeof(sock_distant));
-    if (sent < 0) {
-        perror("Sendto");
-        throw NetworkError("cannot sendto");
-    };
-    Debug(D, pdDebug) << "Sent UDP message." << std::endl;
-    SentBytesCount += sent;
+    if (tooLarge(Size)) {
+        if (my_fallback) {
+            my_fallback->send(Message, Size);
+        }
+        else {
+            ++DroppedCount;
+        }
+        return;
+    }
+
+    SocketUDP& physical = PhysicalLink ? *this : *my_server;
+    memcpy(physical.queue(sock_distant, Size), Message, Size);
+    if (PhysicalLink) {
+        flush();
+    }
+}
+
+// ----------------------------------------------------------------------------
+void SocketUDP::sendSegments(const std::vector<libhla::MessageBuffer::Segment>& segments)
+{
+    assert(_est_init_udp);
+
+    size_t size = 0;
+    for (const auto& segment : segments) {
+        size += segment.length;
+    }
+
+    if (tooLarge(size)) {
+        if (my_fallback) {
+            my_fallback->sendSegments(segments);
+        }
+        else {
+            ++DroppedCount;
+        }
+        return;
+    }
+
+    SocketUDP& physical = PhysicalLink ? *this : *my_server;
+    unsigned char* bytes = physical.queue(sock_distant, size);
+    for (const auto& segment : segments) {
+        memcpy(bytes, segment.data, segment.length);
+        bytes += segment.length;
+    }
+    if (PhysicalLink) {
+        flush();
+    }
+}
+
+// ----------------------------------------------------------------------------
+void SocketUDP::flush()
+{
+    if (!PhysicalLink) {
+        my_server->flush();
+        return;
+    }
+
+    size_t first = 0;
+    while (first < my_outbox_count) {
+#ifdef HAVE_SENDMMSG
+        struct mmsghdr headers[batchSize];
+        struct iovec vectors[batchSize];
+        const unsigned int count = std::min<size_t>(batchSize, my_outbox_count - first);
+        memset(headers, 0, sizeof(headers));
+        for (unsigned int i = 0; i < count; ++i) {
+            Datagram& datagram = my_outbox[first + i];
+            vectors[i].iov_base = datagram.bytes.data();
+            vectors[i].iov_len = datagram.bytes.size();
+            headers[i].msg_hdr.msg_name = &datagram.destination;
+            headers[i].msg_hdr.msg_namelen = sizeof(datagram.destination);
+            headers[i].msg_hdr.msg_iov = &vectors[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int sent = sendmmsg(_socket_udp, headers, count, MSG_DONTWAIT);
+        if (sent > 0) {
+            for (int i = 0; i < sent; ++i) {
+                SentBytesCount += headers[i].msg_len;
+            }
+            first += sent;
+            continue;
+        }
+#else
+        Datagram& datagram = my_outbox[first];
+        const int sent = sendto(_socket_udp,
+                                (const char*) datagram.bytes.data(),
+                                datagram.bytes.size(),
+                                0,
+                                (struct sockaddr*) &datagram.destination,
+                                sizeof(datagram.destination));
+        if (sent >= 0) {
+            SentBytesCount += sent;
+            ++first;
+            continue;
+        }
+#endif
+        if (errno == EINTR) {
+            continue;
+        }
+        // the first datagram of the batch could not be sent, drop it and go on
+        Debug(D, pdError) << "Datagram to " << addr2string(my_outbox[first].destination.sin_addr.s_addr)
+                          << " dropped: " << strerror(errno) << std::endl;
+        ++DroppedCount;
+        ++first;
+    }
+    my_outbox_count = 0;
+}
+
+// ----------------------------------------------------------------------------
+void SocketUDP::setMaxDatagramSize(size_t size)
+{
+    my_max_datagram_size = std::max<size_t>(libhla::MessageBuffer::reservedBytes, std::min(size, maxDatagramSize));
+}
+
+// ----------------------------------------------------------------------------
+size_t SocketUDP::getMaxDatagramSize() const
+{
+    return PhysicalLink ? my_max_datagram_size : my_server->my_max_datagram_size;
+}
+
+// ----------------------------------------------------------------------------
+Socket::ByteCount_t SocketUDP::getDroppedCount() const
+{
+    return DroppedCount;
 }
 
 // ----------------------------------------------------------------------------
@@ -216,6 +373,9 @@ void SocketUDP::close()
 {
     if (_est_init_udp) {
         Debug(D, pdDebug) << "Closing UDP object..." << std::endl;
+        if (PhysicalLink) {
+            flush();
+        }
         _est_init_udp = false;
         if (PhysicalLink) {
             Debug(D, pdDebug) << "Closing physical UDP link..." << std::endl;
@@ -243,12 +403,12 @@ unsigned int SocketUDP::getPort() const
 }
 
 // ----------------------------------------------------------------------------
-/*! Return whether any data as already been read from the system socket
+/*! Return whether a datagram has already been read from the system socket
   and is waiting in the internal buffer.
 */
 bool SocketUDP::isDataReady() const
 {
-    return BufferSize > 0;
+    return my_inbox_head < my_inbox_count;
 }
 
 // ----------------------------------------------------------------------------
@@ -263,40 +423,94 @@ int SocketUDP::open()
 }
 
 // ----------------------------------------------------------------------------
-void SocketUDP::receive(void* Message, unsigned long Size)
+void SocketUDP::skipInvalidDatagrams()
 {
-#ifdef _WIN32 //netDot
-    int taille = sizeof(struct sockaddr_in);
+    while (my_inbox_head < my_inbox_count && my_inbox_lengths[my_inbox_head] == 0) {
+        ++my_inbox_head;
+    }
+}
+
+// ----------------------------------------------------------------------------
+void SocketUDP::fillInbox()
+{
+    if (!my_inbox) {
+        my_inbox.reset(new char[batchSize * maxDatagramSize]);
+    }
+
+    int received;
+#ifdef HAVE_RECVMMSG
+    struct mmsghdr headers[batchSize];
+    struct iovec vectors[batchSize];
+    memset(headers, 0, sizeof(headers));
+    for (unsigned int i = 0; i < batchSize; ++i) {
+        vectors[i].iov_base = my_inbox.get() + i * maxDatagramSize;
+        vectors[i].iov_len = maxDatagramSize;
+        headers[i].msg_hdr.msg_iov = &vectors[i];
+        headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // blocks for the first datagram only
+    do {
+        received = recvmmsg(_socket_udp, headers, batchSize, MSG_WAITFORONE, NULL);
+    } while (received < 0 && errno == EINTR);
+    if (received <= 0) {
+        throw NetworkError("cannot recvmmsg: " + std::string(strerror(errno)));
+    }
+
+    for (int i = 0; i < received; ++i) {
+        my_inbox_lengths[i] = (headers[i].msg_hdr.msg_flags & MSG_TRUNC) ? 0 : headers[i].msg_len;
+    }
 #else
-    socklen_t taille = sizeof(struct sockaddr_in);
+    do {
+        received = recvfrom(_socket_udp, my_inbox.get(), maxDatagramSize, 0, NULL, NULL);
+    } while (received < 0 && errno == EINTR);
+    if (received < 0) {
+        throw NetworkError("cannot recvfrom: " + std::string(strerror(errno)));
+    }
+    my_inbox_lengths[0] = received;
+    received = 1;
 #endif
 
-    int CR;
+    // a datagram holds exactly one message
+    for (int i = 0; i < received; ++i) {
+        const size_t length = my_inbox_lengths[i];
+        const uint8_t* bytes = reinterpret_cast<uint8_t*>(my_inbox.get() + i * maxDatagramSize);
+        RcvdBytesCount += length;
+        if (length < libhla::MessageBuffer::reservedBytes
+            || libhla::MessageBuffer::sizeFromReservedBytes(bytes) != length) {
+            Debug(D, pdError) << "Malformed or truncated datagram dropped" << std::endl;
+            my_inbox_lengths[i] = 0;
+            ++DroppedCount;
+        }
+    }
 
+    my_inbox_count = received;
+    my_inbox_head = 0;
+    my_read_offset = 0;
+    skipInvalidDatagrams();
+}
+
+// ----------------------------------------------------------------------------
+void SocketUDP::receive(void* Message, unsigned long Size)
+{
     assert(_est_init_udp);
 
     Debug(D, pdDebug) << "Beginning to receive UDP message..." << std::endl;
-    if (BufferSize == 0) {
-        CR = recvfrom(_socket_udp, Buffer, BUFFER_MAXSIZE, 0, (struct sockaddr*) &sock_source, &taille);
-        //HPUX:(struct sockaddr *)&sock_source, (int*) &taille);
-        if (CR <= 0) {
-            perror("Recvfrom");
-            throw NetworkError("cannot recvfrom");
-        }
-        else {
-            RcvdBytesCount += CR;
-            BufferSize += CR;
-        }
+    while (!isDataReady()) {
+        fillInbox();
     }
 
-    if (BufferSize < Size) {
-        perror("Taille du Buffer inferieure a celle demandee");
-        throw NetworkError("");
+    const size_t length = my_inbox_lengths[my_inbox_head];
+    if (length - my_read_offset < Size) {
+        throw NetworkError("UDP message shorter than expected");
     }
-    else {
-        BufferSize -= Size;
-        memcpy(Message, (void*) Buffer, Size);
-        memmove((void*) Buffer, (void*) (Buffer + Size), BufferSize);
+
+    memcpy(Message, my_inbox.get() + my_inbox_head * maxDatagramSize + my_read_offset, Size);
+    my_read_offset += Size;
+    if (my_read_offset == length) {
+        ++my_inbox_head;
+        my_read_offset = 0;
+        skipInvalidDatagrams();
     }
 }
 
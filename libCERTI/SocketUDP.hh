@@ -22,20 +22,44 @@
 
 #include "Socket.hh"
 
-#define BUFFER_MAXSIZE 2000
+#include <memory>
 
 namespace certi {
 
+/**
+ * UDP socket carrying the best effort traffic from the RTIG to the RTIAs.
+ *
+ * A physical link owns the system socket. On the RTIG, each federate has
+ * a logical link attached to the server socket: what is sent on it is
+ * queued in the server outbox and goes out in batches (sendmmsg) when the
+ * outbox is full or when flush() is called, typically once the RTIG has
+ * processed its pending messages. A message which does not fit in one
+ * datagram is sent on the fallback link instead.
+ *
+ * On the receiving side, several datagrams are read per system call
+ * (recvmmsg); each datagram holds exactly one message and those which
+ * were truncated or do not match their header are dropped.
+ * Sending never blocks nor throws: best effort messages may be lost.
+ */
 class CERTI_EXPORT SocketUDP : public Socket {
 public:
+    /// Largest datagram sent by default: one Ethernet frame, without fragmentation.
+    static constexpr size_t defaultMaxDatagramSize = 1472;
+    /// Largest UDP payload over IPv4.
+    static constexpr size_t maxDatagramSize = 65507;
+    /// Datagrams sent or received per system call.
+    static constexpr unsigned int batchSize = 32;
+
     SocketUDP();
     virtual ~SocketUDP();
 
     // Socket
     virtual void send(const unsigned char*, size_t);
+    virtual void sendSegments(const std::vector<libhla::MessageBuffer::Segment>& segments);
 
     virtual void receive(void* Message, unsigned long Size);
 
+    /// True when a received datagram has not been entirely read.
     virtual bool isDataReady() const;
 
     SOCKET returnSocket();
@@ -44,16 +68,51 @@ public:
     virtual void close();
 
     // SocketUDP
+    /// Bind a client socket to any local address and a free port.
     virtual void createConnection(const char* server_name, unsigned int port);
 
     void createServer(unsigned int port, in_addr_t addr = INADDR_ANY);
 
-    void attach(int socket_ouvert, unsigned long Adresse, unsigned int port);
+    /**
+     * Make this a logical link to a distant RTIA, sending through server.
+     * @param address distant address, in network byte order
+     * @param port distant port, in network byte order
+     * @param fallback link used for the messages too large for a datagram
+     */
+    void attach(SocketUDP& server, in_addr_t address, in_port_t port, Socket* fallback = nullptr);
+
+    bool isAttached() const;
+
+    /// Send the queued datagrams.
+    void flush();
+
+    /// Messages larger than size go to the fallback link (physical link only).
+    void setMaxDatagramSize(size_t size);
+    size_t getMaxDatagramSize() const;
+
+    /// Datagrams lost: not sent, truncated or malformed.
+    ByteCount_t getDroppedCount() const;
 
     unsigned int getPort() const;
     unsigned long getAddr() const;
 
 private:
+    struct Datagram {
+        struct sockaddr_in destination;
+        std::vector<unsigned char> bytes;
+    };
+
+    /// Return a queued datagram of size bytes for destination, flushing first if the outbox is full.
+    unsigned char* queue(const struct sockaddr_in& destination, size_t size);
+
+    /// Whether a message of size bytes was handed to the fallback link instead.
+    bool tooLarge(size_t size) const;
+
+    /// Wait for datagrams and read as many as possible.
+    void fillInbox();
+    void skipInvalidDatagrams();
+
+protected:
     void setPort(unsigned int port);
 
     int bind();
@@ -63,21 +122,27 @@ private:
 
     SOCKET _socket_udp;
     struct sockaddr_in sock_local;
-
-    struct sockaddr_in sock_source;
-    char* Addr_Source;
-    unsigned int Port_Source;
     struct sockaddr_in sock_distant;
-    struct hostent* hp_distant;
 
-    int _sock_local_length;
     bool _est_init_udp;
 
+private:
     ByteCount_t SentBytesCount;
     ByteCount_t RcvdBytesCount;
+    ByteCount_t DroppedCount;
+
+    SocketUDP* my_server; ///< physical link of a logical link
+    Socket* my_fallback;
+    size_t my_max_datagram_size;
+
+    std::vector<Datagram> my_outbox; ///< slots are reused, my_outbox_count are in use
+    size_t my_outbox_count;
 
-    unsigned long BufferSize;
-    char Buffer[4096];
+    std::unique_ptr<char[]> my_inbox; ///< batchSize slots of maxDatagramSize bytes
+    size_t my_inbox_lengths[batchSize]; ///< 0 for a dropped datagram
+    unsigned int my_inbox_count;
+    unsigned int my_inbox_head;
+    size_t my_read_offset; ///< in the datagram at my_inbox_head
 };
 
 } // namespace certi
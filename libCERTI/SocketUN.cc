@@ -21,6 +21,7 @@
 #include "SocketUN.hh"
 #include "certi.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
 #include <cstdio>
@@ -184,6 +185,7 @@ SocketUN::SocketUN(SignalHandlerType theType)
 #endif
 
 #ifdef SOCKUN_BUFFER_LENGTH
+    RBOffset = 0;
     RBLength = 0;
 #endif
 
@@ -300,26 +302,34 @@ void SocketUN::receive(const unsigned char* buffer, size_t Size)
     assert(0 <= _socket_un);
 
     long nReceived = 0;
-
-#ifndef SOCKUN_BUFFER_LENGTH
-    unsigned long RBLength = 0;
-#endif
+    unsigned long copied = 0;
+    char* out = (char*) buffer;
 
     Debug(D, pdTrace) << "Beginning to receive U/W message, size " << Size << std::endl;
 
-    while (RBLength < Size) {
-#ifdef _WIN32
 #ifdef SOCKUN_BUFFER_LENGTH
-        nReceived = recv(_socket_un, ReadBuffer + RBLength, SOCKUN_BUFFER_LENGTH - RBLength, 0);
-#else
-        nReceived = recv(_socket_un, (char*) buffer + RBLength, Size - RBLength, 0);
+    // First serve what has already been read ahead
+    copied = std::min<unsigned long>(Size, RBLength);
+    memcpy(out, ReadBuffer + RBOffset, copied);
+    RBOffset += copied;
+    RBLength -= copied;
 #endif
-#else
+
+    while (copied < Size) {
 #ifdef SOCKUN_BUFFER_LENGTH
-        nReceived = read(_socket_un, ReadBuffer + RBLength, SOCKUN_BUFFER_LENGTH - RBLength);
+        // Read ahead as much as possible, unless the data would not fit anyway
+        const bool direct = Size - copied >= SOCKUN_BUFFER_LENGTH;
+        char* target = direct ? out + copied : ReadBuffer;
+        const size_t length = direct ? Size - copied : SOCKUN_BUFFER_LENGTH;
 #else
-        nReceived = read(_socket_un, (char*) buffer + RBLength, Size - RBLength);
+        char* target = out + copied;
+        const size_t length = Size - copied;
 #endif
+
+#ifdef _WIN32
+        nReceived = recv(_socket_un, target, length, 0);
+#else
+        nReceived = read(_socket_un, target, length);
 #endif
 
         if (nReceived < 0) {
@@ -347,17 +357,22 @@ void SocketUN::receive(const unsigned char* buffer, size_t Size)
             throw NetworkError("Connection closed by client.");
         }
         else if (nReceived > 0) {
-            RBLength += nReceived;
             RcvdBytesCount += nReceived;
-        }
-    }
-    Debug(D, pdTrace) << "Received " << RBLength << " bytes out of " << Size << std::endl;
-
 #ifdef SOCKUN_BUFFER_LENGTH
-    memcpy(const_cast<unsigned char*>(buffer), ReadBuffer, Size);
-    memmove((void*) ReadBuffer, (void*) (ReadBuffer + Size), RBLength - Size);
-    RBLength -= Size;
+            if (!direct) {
+                // the read buffer was empty: keep what the caller did not ask for
+                const unsigned long used = std::min<unsigned long>(nReceived, Size - copied);
+                memcpy(out + copied, ReadBuffer, used);
+                RBOffset = used;
+                RBLength = nReceived - used;
+                copied += used;
+                continue;
+            }
 #endif
+            copied += nReceived;
+        }
+    }
+    Debug(D, pdTrace) << "Received " << copied << " bytes out of " << Size << std::endl;
     // G.Out(pdGendoc,"exit  SocketUN::receive");
 }
 
@@ -33,10 +33,10 @@ namespace certi {
 // stSignalInterrupt.
 typedef enum { stSignalInterrupt, stIgnoreSignal } SignalHandlerType;
 
-// This is the read buffer of UNIX sockets. It must be at least as
-// long as the longest data ever received by a socket. If the next
-// line is commented out, no buffer will be used at all.
-//#define SOCKUN_BUFFER_LENGTH 4096
+// This is the read buffer of UNIX sockets. Longer data are received
+// directly in the caller's buffer. If the next line is commented out,
+// no buffer will be used at all.
+#define SOCKUN_BUFFER_LENGTH 65536
 
 /**
  * Socket Unix handling class.
@@ -55,7 +55,7 @@ typedef enum { stSignalInterrupt, stIgnoreSignal } SignalHandlerType;
 class CERTI_EXPORT SocketUN {
 public:
     SocketUN(SignalHandlerType theType = stSignalInterrupt);
-    ~SocketUN();
+    virtual ~SocketUN();
 
     int listenUN();
     int connectUN(int port);
@@ -67,12 +67,12 @@ public:
         _socket_un = fd;
     }
 
-    bool isDataReady();
+    virtual bool isDataReady();
 
     SOCKET returnSocket();
 
-    void send(const unsigned char*, size_t);
-    void receive(const unsigned char*, size_t);
+    virtual void send(const unsigned char*, size_t);
+    virtual void receive(const unsigned char*, size_t);
 
 protected:
     void error(const char*);
@@ -93,6 +93,8 @@ private:
     // Receive is made, it will try to read SOCKUN_BUFFER_LENGTH
 
     char ReadBuffer[SOCKUN_BUFFER_LENGTH];
+    /// first byte not received yet
+    unsigned long RBOffset;
     unsigned long RBLength;
 #endif
 };
@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "BlockPool.hh"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace libhla {
+
+namespace {
+constexpr size_t min_block_size = 32;
+/// min_block_size, 64, ..., maxPooledSize
+constexpr size_t class_count = 16;
+static_assert(min_block_size << (class_count - 1) == BlockPool::maxPooledSize, "size classes");
+
+class FreeLists {
+public:
+    FreeLists()
+    {
+        for (auto& list : lists) {
+            list.blocks.reserve(BlockPool::maxFreeBlocks);
+        }
+    }
+
+    struct List {
+        std::mutex mutex;
+        std::vector<void*> blocks;
+    };
+
+    List lists[class_count];
+
+    std::atomic<uint64_t> heapAllocations{0};
+};
+
+/// Never destroyed: messages may be released by static destructors.
+FreeLists& freeLists()
+{
+    static FreeLists* lists = new FreeLists;
+    return *lists;
+}
+
+size_t classOf(size_t n)
+{
+    size_t index = 0;
+    for (size_t size = min_block_size; size < n; size <<= 1) {
+        ++index;
+    }
+    return index;
+}
+}
+
+constexpr size_t BlockPool::maxPooledSize;
+constexpr size_t BlockPool::maxFreeBlocks;
+
+size_t BlockPool::capacity(size_t n)
+{
+    if (n > maxPooledSize) {
+        return n;
+    }
+    return min_block_size << classOf(n);
+}
+
+void* BlockPool::allocate(size_t n)
+{
+    auto& lists = freeLists();
+
+    if (n <= maxPooledSize) {
+        auto& list = lists.lists[classOf(n)];
+        std::lock_guard<std::mutex> lock(list.mutex);
+        if (!list.blocks.empty()) {
+            void* block = list.blocks.back();
+            list.blocks.pop_back();
+            return block;
+        }
+    }
+
+    ++lists.heapAllocations;
+    return ::operator new(capacity(n));
+}
+
+void BlockPool::release(void* block, size_t n)
+{
+    if (!block) {
+        return;
+    }
+
+    if (n <= maxPooledSize) {
+        auto& list = freeLists().lists[classOf(n)];
+        std::lock_guard<std::mutex> lock(list.mutex);
+        if (list.blocks.size() < maxFreeBlocks) {
+            list.blocks.push_back(block);
+            return;
+        }
+    }
+
+    ::operator delete(block);
+}
+
+uint64_t BlockPool::heapAllocations()
+{
+    return freeLists().heapAllocations;
+}
+
+} // namespace libhla
@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef LIBHLA_BLOCK_POOL_HH
+#define LIBHLA_BLOCK_POOL_HH
+
+#include "libhla.hh"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libhla {
+
+/**
+ * Process wide free lists of memory blocks, one per power of 2 size class.
+ * Message objects and MessageBuffer storage are taken from it, so that
+ * once the first messages have been exchanged, receiving and dropping a
+ * message recycles blocks instead of calling the heap.
+ * Blocks larger than maxPooledSize, or given back while the free list of
+ * their class is full, are returned to the heap. All functions are thread safe.
+ */
+class HLA_EXPORT BlockPool {
+public:
+    /// Largest pooled block, in bytes.
+    static constexpr size_t maxPooledSize = 1 << 20;
+
+    /// Maximum number of free blocks kept per size class.
+    static constexpr size_t maxFreeBlocks = 256;
+
+    /**
+     * Size of the blocks handed out for a request of n bytes.
+     */
+    static size_t capacity(size_t n);
+
+    /**
+     * Get a block of capacity(n) bytes.
+     */
+    static void* allocate(size_t n);
+
+    /**
+     * Give back a block obtained with allocate(m), where capacity(m) == capacity(n).
+     */
+    static void release(void* block, size_t n);
+
+    /**
+     * Number of blocks which had to be obtained from the heap so far.
+     */
+    static uint64_t heapAllocations();
+};
+
+} // namespace libhla
+
+#endif // LIBHLA_BLOCK_POOL_HH
@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "ByteSwap.hh"
+
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define LIBHLA_BYTE_SWAP_X86
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#define LIBHLA_BYTE_SWAP_NEON
+#include <arm_neon.h>
+#endif
+
+namespace libhla {
+
+namespace {
+
+/* pshufb masks reversing each element of a 16 bytes block */
+alignas(16) const uint8_t shuffle16[16] = {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14};
+alignas(16) const uint8_t shuffle32[16] = {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12};
+alignas(16) const uint8_t shuffle64[16] = {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8};
+
+/**
+ * A vector kernel swaps as many whole blocks as fit in size bytes
+ * and returns the number of bytes done, the caller swaps the rest.
+ */
+typedef size_t (*Kernel)(uint8_t* dst, const uint8_t* src, size_t size, const uint8_t* shuffle);
+
+size_t noKernel(uint8_t*, const uint8_t*, size_t, const uint8_t*)
+{
+    return 0;
+}
+
+#ifdef LIBHLA_BYTE_SWAP_X86
+__attribute__((target("ssse3"))) size_t ssse3Kernel(uint8_t* dst,
+                                                      const uint8_t* src,
+                                                      size_t size,
+                                                      const uint8_t* shuffle)
+{
+    const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(shuffle));
+    size_t done = 0;
+    for (; done + 16 <= size; done += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + done));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + done), _mm_shuffle_epi8(block, mask));
+    }
+    return done;
+}
+
+__attribute__((target("avx2"))) size_t avx2Kernel(uint8_t* dst, const uint8_t* src, size_t size, const uint8_t* shuffle)
+{
+    /* vpshufb shuffles each 128 bits lane on its own: same mask in both */
+    const __m256i mask = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(shuffle)));
+    size_t done = 0;
+    for (; done + 32 <= size; done += 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + done));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + done), _mm256_shuffle_epi8(block, mask));
+    }
+    return done;
+}
+#endif
+
+#ifdef LIBHLA_BYTE_SWAP_NEON
+size_t neonKernel(uint8_t* dst, const uint8_t* src, size_t size, const uint8_t* shuffle)
+{
+    size_t done = 0;
+    if (shuffle == shuffle16) {
+        for (; done + 16 <= size; done += 16) {
+            vst1q_u8(dst + done, vrev16q_u8(vld1q_u8(src + done)));
+        }
+    }
+    else if (shuffle == shuffle32) {
+        for (; done + 16 <= size; done += 16) {
+            vst1q_u8(dst + done, vrev32q_u8(vld1q_u8(src + done)));
+        }
+    }
+    else {
+        for (; done + 16 <= size; done += 16) {
+            vst1q_u8(dst + done, vrev64q_u8(vld1q_u8(src + done)));
+        }
+    }
+    return done;
+}
+#endif
+
+struct Selection {
+    Kernel kernel;
+    const char* name;
+};
+
+Selection chooseKernel()
+{
+#ifdef LIBHLA_BYTE_SWAP_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return {avx2Kernel, "avx2"};
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return {ssse3Kernel, "ssse3"};
+    }
+#endif
+#ifdef LIBHLA_BYTE_SWAP_NEON
+    return {neonKernel, "neon"};
+#endif
+    return {noKernel, "scalar"};
+}
+
+const Selection& selection()
+{
+    static const Selection selected = chooseKernel();
+    return selected;
+}
+}
+
+void ByteSwap::copy16(void* dst, const void* src, size_t n)
+{
+    uint8_t* out = static_cast<uint8_t*>(dst);
+    const uint8_t* in = static_cast<const uint8_t*>(src);
+
+    const size_t done = selection().kernel(out, in, 2 * n, shuffle16);
+    for (size_t i = done; i < 2 * n; i += 2) {
+        uint16_t an_uint16;
+        memcpy(&an_uint16, in + i, 2);
+        an_uint16 = LIBHLA_UINT16_SWAP_BYTES(an_uint16);
+        memcpy(out + i, &an_uint16, 2);
+    }
+}
+
+void ByteSwap::copy32(void* dst, const void* src, size_t n)
+{
+    uint8_t* out = static_cast<uint8_t*>(dst);
+    const uint8_t* in = static_cast<const uint8_t*>(src);
+
+    const size_t done = selection().kernel(out, in, 4 * n, shuffle32);
+    for (size_t i = done; i < 4 * n; i += 4) {
+        uint32_t an_uint32;
+        memcpy(&an_uint32, in + i, 4);
+        an_uint32 = LIBHLA_UINT32_SWAP_BYTES(an_uint32);
+        memcpy(out + i, &an_uint32, 4);
+    }
+}
+
+void ByteSwap::copy64(void* dst, const void* src, size_t n)
+{
+    uint8_t* out = static_cast<uint8_t*>(dst);
+    const uint8_t* in = static_cast<const uint8_t*>(src);
+
+    const size_t done = selection().kernel(out, in, 8 * n, shuffle64);
+    for (size_t i = done; i < 8 * n; i += 8) {
+        uint64_t an_uint64;
+        memcpy(&an_uint64, in + i, 8);
+        an_uint64 = LIBHLA_UINT64_SWAP_BYTES(an_uint64);
+        memcpy(out + i, &an_uint64, 8);
+    }
+}
+
+const char* ByteSwap::kernel()
+{
+    return selection().name;
+}
+
+} // namespace libhla
@@ -0,0 +1,56 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef LIBHLA_BYTE_SWAP_HH
+#define LIBHLA_BYTE_SWAP_HH
+
+#include "libhla.hh"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libhla {
+
+/**
+ * Array copies which reverse the bytes of every element, used by
+ * MessageBuffer when the peer has the other endianness.
+ * The widest kernel available is chosen once, at run time on x86
+ * (AVX2, then SSSE3), at compile time on ARM (NEON); otherwise the
+ * elements are swapped one at a time.
+ * Source and destination need not be aligned but must not overlap.
+ */
+class HLA_EXPORT ByteSwap {
+public:
+    /// Copy n elements of 2 bytes, swapping their bytes.
+    static void copy16(void* dst, const void* src, size_t n);
+
+    /// Copy n elements of 4 bytes, swapping their bytes.
+    static void copy32(void* dst, const void* src, size_t n);
+
+    /// Copy n elements of 8 bytes, swapping their bytes.
+    static void copy64(void* dst, const void* src, size_t n);
+
+    /// Name of the kernel in use: "avx2", "ssse3", "neon" or "scalar".
+    static const char* kernel();
+};
+
+} // namespace libhla
+
+#endif // LIBHLA_BYTE_SWAP_HH
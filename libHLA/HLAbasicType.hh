@@ -17,8 +17,10 @@
 #ifndef _HLATYPES_BASICTYPE_HH
 #define _HLATYPES_BASICTYPE_HH
 
+#include "ByteSwap.hh"
 #include "HLAbuffer.hh"
 #include <cstring>
+#include <type_traits>
 
 namespace libhla {
 
@@ -55,6 +57,12 @@ struct __swap;
 //! Conversion to the Little Endian encoding
 template <class T>
 struct LittleEndian {
+#ifdef HOST_IS_BIG_ENDIAN
+    static const bool m_swaps = true;
+#else
+    static const bool m_swaps = false;
+#endif
+
     inline const T operator()(const T& x) const
     {
 #ifdef HOST_IS_BIG_ENDIAN
@@ -68,6 +76,12 @@ struct LittleEndian {
 //! Conversion to the Big Endian encoding
 template <class T>
 struct BigEndian {
+#ifdef HOST_IS_BIG_ENDIAN
+    static const bool m_swaps = false;
+#else
+    static const bool m_swaps = true;
+#endif
+
     inline const T operator()(const T& x) const
     {
 #ifdef HOST_IS_BIG_ENDIAN
@@ -153,12 +167,12 @@ struct HLAbasicType {
         return E<S>()(*(S*) this);
     }
 
-    static size_t emptysizeof()
+    static constexpr size_t emptysizeof()
     {
         return __sizeof();
     }
 
-    static size_t __sizeof()
+    static constexpr size_t __sizeof()
     {
         return sizeof(S);
     }
@@ -171,8 +185,48 @@ struct HLAbasicType {
         memcpy((char*) this, source, __sizeof());
     }
 
+    //! Encode <n> consecutive elements from <values>
+    /* When <T> is the storage type, the elements are copied at once, with a
+     * vectorized byte swap if the encoding differs from the host one.
+     */
+    static void __encode(void* buffer, const T* values, size_t n)
+    {
+        if (std::is_same<T, S>::value) {
+            __transcode(buffer, values, n);
+        }
+        else {
+            for (size_t i = 0; i < n; i++)
+                ((S*) buffer)[i] = E<S>()(values[i]);
+        }
+    }
+
+    //! Decode <n> consecutive elements to <values>
+    static void __decode(T* values, const void* buffer, size_t n)
+    {
+        if (std::is_same<T, S>::value) {
+            __transcode(values, buffer, n);
+        }
+        else {
+            for (size_t i = 0; i < n; i++)
+                values[i] = E<S>()(((const S*) buffer)[i]);
+        }
+    }
+
     static const size_t m_octetBoundary = sizeof(S);
     static const bool m_isVariable = false;
+
+private:
+    static void __transcode(void* dst, const void* src, size_t n)
+    {
+        if (!E<S>::m_swaps || sizeof(S) == 1)
+            memcpy(dst, src, n * sizeof(S));
+        else if (sizeof(S) == 2)
+            ByteSwap::copy16(dst, src, n);
+        else if (sizeof(S) == 4)
+            ByteSwap::copy32(dst, src, n);
+        else
+            ByteSwap::copy64(dst, src, n);
+    }
 };
 
 template <class T, class S, template <class W> class E>
@@ -17,14 +17,137 @@
 #include "HLAbuffer.hh"
 
 #include <algorithm>
+#include <atomic>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
 
 // #define HLATYPES_IEEE1516_DISPLAYPRINTABLE
 
 namespace libhla {
 
-__HLAbuffer::BufferList __HLAbuffer::gBuffers;
+namespace {
+// all buffers, indexed by "last pointers", i.e. pointers to the last byte in the buffer
+typedef std::map<char*, __HLAbuffer*> BufferList;
+
+struct ThreadCache;
+
+struct Registry {
+    std::mutex mutex;
+    BufferList buffers;
+    // the caches of the running threads
+    std::set<ThreadCache*> caches;
+};
+
+// constructed by the first buffer, destroyed after the static ones
+Registry& registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+// the last buffers found by a thread: when copying during a shake both the
+// source and the destination buffers are used
+struct ThreadCache {
+    struct Entry {
+        const char* begin;
+        const char* end;
+        __HLAbuffer* buffer;
+    };
+
+    ThreadCache()
+    {
+        std::lock_guard<std::mutex> lock(registry().mutex);
+        registry().caches.insert(this);
+    }
+
+    ~ThreadCache()
+    {
+        std::lock_guard<std::mutex> lock(registry().mutex);
+        registry().caches.erase(this);
+    }
+
+    // The entries are read by the thread without lock, written under the
+    // registry mutex by the thread only. The other threads read them under
+    // the mutex and raise stale when one holds a buffer they changed.
+    Entry entries[2] = {};
+    unsigned nextSlot = 0;
+    std::atomic<bool> stale{false};
+};
+
+thread_local ThreadCache tCache;
+
+// the registry mutex is held: only the threads which found buffer have to drop their entries
+void forget(const __HLAbuffer* buffer)
+{
+    for (ThreadCache* cache : registry().caches) {
+        for (const ThreadCache::Entry& entry : cache->entries) {
+            if (entry.buffer == buffer) {
+                // released before the memory of buffer may be handed to the thread again
+                cache->stale.store(true, std::memory_order_release);
+            }
+        }
+    }
+}
+}
+
+void __HLAbuffer::__register(__HLAbuffer* buffer)
+{
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    // no cached range can overlap the memory of a new buffer
+    registry().buffers[buffer->mBegin + buffer->mCapacity - 1] = buffer;
+}
+
+void __HLAbuffer::__unregister(__HLAbuffer* buffer)
+{
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    registry().buffers.erase(buffer->mBegin + buffer->mCapacity - 1);
+    forget(buffer);
+}
+
+void __HLAbuffer::__exchange(__HLAbuffer* first, __HLAbuffer* second)
+{
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    std::swap(first->mBegin, second->mBegin);
+    std::swap(first->mCapacity, second->mCapacity);
+    registry().buffers[first->mBegin + first->mCapacity - 1] = first; // update
+    registry().buffers[second->mBegin + second->mCapacity - 1] = second; // update
+    forget(first);
+    forget(second);
+}
+
+__HLAbuffer& __HLAbuffer::__buffer(const void* __this)
+{
+    const char* pointer = static_cast<const char*>(__this);
+    ThreadCache& cache = tCache;
+
+    if (!cache.stale.load(std::memory_order_acquire)) {
+        for (const ThreadCache::Entry& entry : cache.entries) {
+            if (pointer >= entry.begin && pointer < entry.end) {
+                return *entry.buffer;
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    if (cache.stale.load(std::memory_order_relaxed)) {
+        cache.entries[0] = cache.entries[1] = {};
+        cache.stale.store(false, std::memory_order_relaxed);
+    }
+
+    // find the first pointer not less than "this", the last pointer
+    BufferList::iterator result = registry().buffers.lower_bound(const_cast<char*>(pointer));
+    if (result == registry().buffers.end())
+        throw std::runtime_error("HLAdata: bad pointer");
+
+    __HLAbuffer* buffer = result->second;
+    if (pointer >= buffer->mBegin) {
+        cache.entries[cache.nextSlot++ % 2] = {buffer->mBegin, buffer->mBegin + buffer->mCapacity, buffer};
+    }
+    return *buffer;
+}
 
 bool __HLAbuffer::__is_big_endian()
 {
@@ -18,7 +18,6 @@
 #define _HLATYPES_BUFFER_HH
 
 #include <cstdlib>
-#include <map>
 #include <stdexcept>
 #include <utility>
 
@@ -36,10 +35,11 @@ HLA_EXPORT std::ostream& __print_buffer(std::ostream& stream, const void* buffer
 
 class HLA_EXPORT __HLAbuffer {
 private:
-    // static buffer for all instantiations of the HLAdata template
-    // indexed by "last pointers", i.e. pointers to the last byte in the buffer
-    typedef std::map<char*, __HLAbuffer*> BufferList;
-    static BufferList gBuffers;
+    // table of all buffers for all instantiations of the HLAdata template,
+    // shared by all threads: see HLAbuffer.cc
+    static void __register(__HLAbuffer* buffer);
+    static void __unregister(__HLAbuffer* buffer);
+    static void __exchange(__HLAbuffer* first, __HLAbuffer* second);
 
     // used to verify that user set correct endianess
     static bool __is_big_endian();
@@ -72,7 +72,7 @@ public:
         mCapacity = (size_t)(capacity * 1.5);
         mBegin = (char*) calloc(1, mCapacity);
         // store "this" to a global table
-        gBuffers[mBegin + mCapacity - 1] = this;
+        __register(this);
     }
 
     __HLAbuffer(void* begin, size_t capacity)
@@ -80,44 +80,29 @@ public:
     {
         __assert_endianess();
         // store "this" to a global table
-        gBuffers[mBegin + mCapacity - 1] = this;
+        __register(this);
     }
 
     virtual ~__HLAbuffer()
     {
+        // remove "this" from the global table
+        __unregister(this);
         if (!mUserAllocated)
             free(mBegin);
-        // remove "this" from the global table
-        gBuffers.erase(__buffer_iterator(mBegin));
     }
 
     void __exchange_buffers(__HLAbuffer& newBuffer)
     {
-        char* oldBegin = mBegin;
-        size_t oldCapacity = mCapacity;
-
-        mBegin = newBuffer.mBegin;
-        mCapacity = newBuffer.mCapacity;
-        gBuffers[mBegin + mCapacity - 1] = this; // update
-
-        newBuffer.mBegin = oldBegin;
-        newBuffer.mCapacity = oldCapacity;
-        gBuffers[oldBegin + oldCapacity - 1] = &newBuffer; // update
+        __exchange(this, &newBuffer);
     }
 
-    static BufferList::iterator __buffer_iterator(const void* __this)
-    {
-        // find the first pointer not less than "this", the last pointer
-        BufferList::iterator result = gBuffers.lower_bound((char*) __this);
-        if (result == gBuffers.end())
-            throw std::runtime_error("HLAdata: bad pointer");
-        return result;
-    }
-
-    static __HLAbuffer& __buffer(const void* __this)
-    {
-        return *(__buffer_iterator(__this)->second);
-    }
+    //! Find the buffer holding the data at __this
+    /* The last buffers found by the calling thread are checked first, without
+     * any lock: accessing the fields of a record costs O(1). Different threads
+     * may use different buffers at the same time, destroying or resizing one
+     * only drops it from the caches of the threads which found it.
+     */
+    static __HLAbuffer& __buffer(const void* __this);
 
 #ifndef NDEBUG
     static void __check_memory(const void* __this, size_t size)
@@ -157,7 +142,7 @@ public:
 /* Calculate the smallest nonnegative value of P that satisfies the following
  * formula: (offset+size+P) mod boundary = 0
  */
-inline size_t __padding(size_t size, size_t boundary)
+constexpr size_t __padding(size_t size, size_t boundary)
 {
     return boundary - ((size - 1) % boundary + 1);
 }
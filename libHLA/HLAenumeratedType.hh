@@ -82,12 +82,12 @@ struct HLAenumeratedType {
         return *(R*) this;
     }
 
-    static size_t emptysizeof()
+    static constexpr size_t emptysizeof()
     {
         return R::emptysizeof();
     }
 
-    static size_t __sizeof()
+    static constexpr size_t __sizeof()
     {
         return R::__sizeof();
     }
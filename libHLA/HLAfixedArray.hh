@@ -17,6 +17,7 @@
 #ifndef _HLATYPES_FIXEDARRAY_HH
 #define _HLATYPES_FIXEDARRAY_HH
 
+#include <cstring>
 #include <stdexcept>
 
 namespace libhla {
@@ -67,7 +68,7 @@ struct HLAfixedArray<M, N, false> {
         return N;
     }
 
-    static size_t offset(long i)
+    static constexpr size_t offset(long i)
     {
         return i * (M::__sizeof() + __padding(M::__sizeof(), M::m_octetBoundary));
     }
@@ -79,25 +80,46 @@ struct HLAfixedArray<M, N, false> {
         return *(M*) ((char*) this + offset(i));
     }
 
-    static size_t emptysizeof()
+    static constexpr size_t emptysizeof()
     {
         return __sizeof();
     }
 
     // Padding shall not be added after the last element of the array.
-    static size_t __sizeof()
+    static constexpr size_t __sizeof()
     {
         return offset(N - 1) + M::__sizeof();
     }
 
     void copy(void* source)
     {
-        size_t offs = 0;
-        // copy all elements of the structure
-        for (size_t i = 0; i < N; i++) {
-            ((M*) ((char*) this + offs))->copy((char*) source + offs);
-            offs += M::__sizeof() + __padding(M::__sizeof(), M::m_octetBoundary);
-        }
+        // same layout in both buffers: copy all elements at once
+#ifndef NDEBUG
+        __HLAbuffer::__check_memory(this, __sizeof());
+#endif
+        memcpy((char*) this, source, __sizeof());
+    }
+
+    //! Set all elements from <values>, at once
+    /* Only for arrays of HLAbasicType elements, which have no padding.
+     */
+    template <class T>
+    void set(const T* values)
+    {
+#ifndef NDEBUG
+        __HLAbuffer::__check_memory(this, __sizeof());
+#endif
+        M::__encode(this, values, N);
+    }
+
+    //! Get all elements to <values>, at once
+    template <class T>
+    void get(T* values) const
+    {
+#ifndef NDEBUG
+        __HLAbuffer::__check_memory(this, __sizeof());
+#endif
+        M::__decode(values, this, N);
     }
 
     static const size_t m_octetBoundary = M::m_octetBoundary;
@@ -18,6 +18,8 @@
 #define _HLATYPES_FIXEDRECORD_HH
 
 #include "HLAbuffer.hh"
+#include <cstring>
+#include <type_traits>
 
 namespace libhla {
 
@@ -84,27 +86,33 @@ template <class R, int i>
 struct __FieldAt;
 
 // Fixed record optimized for fixed-size fields
+// note: the layout is computed at compile-time
 template <class R>
 struct HLAfixedRecord<R, false> {
     template <int i>
     typename __FieldAt<R, i>::Type& field() const
     {
-        return *(typename __FieldAt<R, i>::Type*) ((char*) this + R::field_offsetof(i));
+        typedef std::integral_constant<size_t, R::field_offsetof(i)> Offset;
+        return *(typename __FieldAt<R, i>::Type*) ((char*) this + Offset::value);
     }
 
-    static size_t emptysizeof()
+    static constexpr size_t emptysizeof()
     {
         return R::emptysizeof();
     }
 
-    static size_t __sizeof()
+    static constexpr size_t __sizeof()
     {
         return R::__sizeof();
     }
 
     void copy(void* source)
     {
-        ((R*) this)->copy(source);
+        // same layout in both buffers: copy all fields at once
+#ifndef NDEBUG
+        __HLAbuffer::__check_memory(this, __sizeof());
+#endif
+        memcpy((char*) this, source, __sizeof());
     }
 
     static const size_t m_octetBoundary = R::m_octetBoundary;
@@ -149,7 +157,7 @@ struct HLAfixedField;
 // List of fixed-size fields
 template <int E, class M, class N>
 struct HLAfixedField<E, M, N, false> {
-    static size_t field_offsetof(int d, size_t offs = 0)
+    static constexpr size_t field_offsetof(int d, size_t offs = 0)
     {
         if (d != E) {
             size_t size = M::__sizeof();
@@ -162,13 +170,13 @@ struct HLAfixedField<E, M, N, false> {
 
     static const size_t memberBoundary = M::m_octetBoundary;
 
-    static size_t emptysizeof(size_t offs = 0)
+    static constexpr size_t emptysizeof(size_t offs = 0)
     {
         return __sizeof(offs);
     }
 
     // Padding shall not be added after the last element of the array.
-    static size_t __sizeof(size_t offs = 0)
+    static constexpr size_t __sizeof(size_t offs = 0)
     {
         size_t size = M::__sizeof();
         // if not reached HLAvariantEnd
@@ -184,11 +192,10 @@ struct HLAfixedField<E, M, N, false> {
     {
         ((M*) this)->copy(source);
         if (N::memberBoundary) {
-            offsD += M::__sizeof();
-            offsD += __padding(offsD, N::memberBoundary);
-            offsS += M::__sizeof();
-            offsS += __padding(offsS, N::memberBoundary);
-            ((N*) ((char*) this + M::__sizeof()))->copy((char*) source + M::__sizeof(), offsD, offsS);
+            // the padding may differ, when following variable-size fields
+            size_t sizeD = M::__sizeof() + __padding(offsD + M::__sizeof(), N::memberBoundary);
+            size_t sizeS = M::__sizeof() + __padding(offsS + M::__sizeof(), N::memberBoundary);
+            ((N*) ((char*) this + sizeD))->copy((char*) source + sizeS, offsD + sizeD, offsS + sizeS);
         }
     }
 
@@ -255,17 +262,17 @@ struct HLAfixedField<E, M, N, true> {
 
 //! Defines a last field in the fixed record
 struct HLAfixedEnd {
-    static size_t field_offsetof(int /*d*/, size_t offs = 0)
+    static constexpr size_t field_offsetof(int /*d*/, size_t offs = 0)
     {
         return offs;
     }
 
     static const size_t memberBoundary = 0;
-    static size_t emptysizeof(size_t offs = 0)
+    static constexpr size_t emptysizeof(size_t offs = 0)
     {
         return offs;
     }
-    static size_t __sizeof(size_t offs = 0)
+    static constexpr size_t __sizeof(size_t offs = 0)
     {
         return offs;
     }
@@ -20,13 +20,23 @@
 // ----------------------------------------------------------------------------
 
 #include "MessageBuffer.hh"
+#include "BlockPool.hh"
+#include "ByteSwap.hh"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <string>
 
 namespace {
 static constexpr auto DEFAULT_MESSAGE_BUFFER_SIZE = 255;
+
+/* reserved byte 0 bits */
+static constexpr uint8_t BIG_ENDIAN_FLAG = 0x01;
+static constexpr uint8_t COMPACT_FLAG = 0x02;
+
+/* longest varint encoding of an uint32_t */
+static constexpr uint32_t MAX_VARINT_SIZE = 5;
 }
 
 namespace libhla {
@@ -62,12 +72,16 @@ void MessageBuffer::show(const void* data, uint32_t n)
 }
 
 const uint8_t MessageBuffer::reservedBytes = 5;
+const uint32_t MessageBuffer::segmentThreshold = 16 * 1024;
 
 void MessageBuffer::initialize()
 {
     buffer = NULL;
     bufferMaxSize = DEFAULT_MESSAGE_BUFFER_SIZE;
     bufferHasMyEndianness = true;
+    compact = false;
+    segmented = false;
+    externalSize = 0;
     writeOffset = reservedBytes;
     readOffset = reservedBytes;
 } /* end of MessageBuffer::initialize() */
@@ -101,8 +115,14 @@ void MessageBuffer::reallocate(uint32_t n)
     if ((NULL == buffer) || (n > bufferMaxSize)) {
         // FIXME should try/catch for alloc error
         // ands wrap-up inside RTIinternalError
-        buffer = new uint8_t[n];
-        bufferMaxSize = n;
+        /* storage comes by size classes, which also makes growth geometric */
+        const uint32_t oldSize = bufferMaxSize;
+        if (NULL != oldbuf) {
+            /* geometric growth, including above the pooled size classes */
+            n = static_cast<uint32_t>(std::min<uint64_t>(std::max<uint64_t>(n, 2 * uint64_t(oldSize)), UINT32_MAX));
+        }
+        buffer = static_cast<uint8_t*>(BlockPool::allocate(n));
+        bufferMaxSize = BlockPool::capacity(n);
         /*
 		 * If oldbuf wasn't null then copy
 		 * oldbuf in the new buf
@@ -110,7 +130,7 @@ void MessageBuffer::reallocate(uint32_t n)
 		 */
         if (NULL != oldbuf) {
             memcpy(buffer, oldbuf, writeOffset);
-            delete[] oldbuf;
+            BlockPool::release(oldbuf, oldSize);
             oldbuf = NULL;
         }
         else {
@@ -121,14 +141,12 @@ void MessageBuffer::reallocate(uint32_t n)
 
 MessageBuffer::~MessageBuffer()
 {
-    if (NULL != buffer) {
-        delete[] buffer;
-    }
+    BlockPool::release(buffer, bufferMaxSize);
 } /* end of MessageBuffer::~MessageBuffer() */
 
 uint32_t MessageBuffer::size() const
 {
-    return writeOffset;
+    return writeOffset + externalSize;
 }
 
 uint32_t MessageBuffer::maxSize() const
@@ -148,14 +166,29 @@ void MessageBuffer::assumeBufferIsLittleEndian()
     buffer[0] = 0x00;
 } /* end of MessageBuffer::assumeBufferIsLittleEndian() */
 
+void MessageBuffer::setCompact(bool compact)
+{
+    this->compact = compact;
+    updateReservedBytes();
+}
+
 void MessageBuffer::reset()
 {
     bufferHasMyEndianness = true;
+    compact = false;
+    segmented = false;
+    externals.clear();
+    externalSize = 0;
     writeOffset = reservedBytes;
     readOffset = reservedBytes;
     updateReservedBytes();
 } /* MessageBuffer::reset() */
 
+void MessageBuffer::rewind()
+{
+    readOffset = reservedBytes;
+}
+
 uint32_t MessageBuffer::resize(uint32_t newSize)
 {
     reallocate(newSize);
@@ -179,37 +212,89 @@ void MessageBuffer::assumeSize(uint32_t size)
 void MessageBuffer::assumeSizeFromReservedBytes()
 {
     uint32_t toBeAssumedSize;
+    const bool compactBuffer = (buffer[0] & COMPACT_FLAG) != 0;
     /* verify endianity from reserved byte 0 */
-    if (buffer[0] == 0x01) {
+    if (buffer[0] & BIG_ENDIAN_FLAG) {
         assumeBufferIsBigEndian();
     }
     else {
         assumeBufferIsLittleEndian();
     }
-    /* read size from reserved bytes 1..4 */
+    /* read size from reserved bytes 1..4 (always fixed size) */
+    compact = false;
     readOffset = 1;
     toBeAssumedSize = this->read_uint32();
+    compact = compactBuffer;
+    if (compact) {
+        buffer[0] |= COMPACT_FLAG;
+    }
     /* reallocation may be needed */
     reallocate(toBeAssumedSize);
     assumeSize(toBeAssumedSize);
 } /* end of assumeSizeFromReservedBytes */
 
+uint32_t MessageBuffer::sizeFromReservedBytes(const uint8_t* reserved)
+{
+    /* same layout as written by updateReservedBytes */
+    if (reserved[0] & BIG_ENDIAN_FLAG) {
+        return (uint32_t(reserved[1]) << 24) | (uint32_t(reserved[2]) << 16) | (uint32_t(reserved[3]) << 8)
+            | uint32_t(reserved[4]);
+    }
+    else {
+        return (uint32_t(reserved[4]) << 24) | (uint32_t(reserved[3]) << 16) | (uint32_t(reserved[2]) << 8)
+            | uint32_t(reserved[1]);
+    }
+} /* end of sizeFromReservedBytes */
+
 void MessageBuffer::setSizeInReservedBytes(uint32_t n)
 {
     uint32_t oldWR_Offset;
     /* backup write Offset */
     oldWR_Offset = writeOffset;
-    /* update size in reserved bytes */
+    const bool compactBuffer = compact;
+    /* update size in reserved bytes (always fixed size) */
+    compact = false;
     writeOffset = 1;
     //std::cerr  << "setSizeInReservedBytes(" << n << ")" << std::endl;
     write_uint32(n);
     /* restore writeOffset */
     writeOffset = oldWR_Offset;
+    compact = compactBuffer;
 } /* end of setSizeInReservedBytes */
 
+void MessageBuffer::setSegmented(bool segmented)
+{
+    this->segmented = segmented;
+}
+
+std::vector<MessageBuffer::Segment> MessageBuffer::segments() const
+{
+    std::vector<Segment> result;
+    result.reserve(2 * externals.size() + 1);
+
+    uint32_t copied = 0;
+    for (const auto& external : externals) {
+        if (external.offset > copied) {
+            result.push_back({buffer + copied, external.offset - copied});
+            copied = external.offset;
+        }
+        result.push_back({external.data, external.length});
+    }
+    if (writeOffset > copied) {
+        result.push_back({buffer + copied, writeOffset - copied});
+    }
+    return result;
+} /* end of MessageBuffer::segments() */
+
 int32_t MessageBuffer::write_uint8s(const uint8_t* data, uint32_t n)
 {
     //std::cerr  << "write_uint8s(" << data << " = [" << (n ? data[0] : 0) <<" ...], " << n << ")" << std::endl;
+    if (segmented && n >= segmentThreshold) {
+        /* reference large arrays, they are gathered when sent */
+        externals.push_back({writeOffset, data, n});
+        externalSize += n;
+        return (size() - n);
+    }
     if (n >= (bufferMaxSize - writeOffset)) {
         /* reallocate buffer on-demand */
         reallocate(bufferMaxSize + (n - (bufferMaxSize - writeOffset)) + DEFAULT_MESSAGE_BUFFER_SIZE);
@@ -242,8 +327,6 @@ int32_t MessageBuffer::read_uint8s(uint8_t* data, uint32_t n)
 
 int32_t MessageBuffer::write_uint16s(const uint16_t* data, uint32_t n)
 {
-    uint32_t i;
-    uint16_t an_uint16;
     //std::cerr  << "write_uint16s(" << data << " = [" << (n ? data[0] : 0) <<" ...], " << n << ")" << std::endl;
 
     if ((2 * n) >= (bufferMaxSize - writeOffset)) {
@@ -257,19 +340,14 @@ int32_t MessageBuffer::write_uint16s(const uint16_t* data, uint32_t n)
         writeOffset += 2 * n;
     }
     else {
-        for (i = 0; i < n; ++i) {
-            an_uint16 = LIBHLA_UINT16_SWAP_BYTES(data[i]);
-            memcpy(buffer + writeOffset, &an_uint16, 2);
-            writeOffset += 2;
-        }
+        ByteSwap::copy16(buffer + writeOffset, data, n);
+        writeOffset += 2 * n;
     }
     return (writeOffset - 2 * n);
 } /* end of MessageBuffer::write_uint16s(uint16_t*, uint32_t) */
 
 int32_t MessageBuffer::read_uint16s(uint16_t* data, uint32_t n)
 {
-    uint32_t i;
-    uint16_t an_uint16;
 
     if (2 * n + readOffset > writeOffset) {
         throw MessageBufferError("read_uint16s::invalid read of size <" + std::to_string(2 * n)
@@ -288,11 +366,8 @@ int32_t MessageBuffer::read_uint16s(uint16_t* data, uint32_t n)
         readOffset += 2 * n;
     }
     else {
-        for (i = 0; i < n; ++i) {
-            memcpy(&an_uint16, buffer + readOffset, 2);
-            data[i] = LIBHLA_UINT16_SWAP_BYTES(an_uint16);
-            readOffset += 2;
-        }
+        ByteSwap::copy16(data, buffer + readOffset, n);
+        readOffset += 2 * n;
     }
 
     //std::cerr  << "read_uint16s(" << data << " = [" << (n ? data[0] : 0) <<" ...], " << n << ")" << std::endl;
@@ -301,10 +376,12 @@ int32_t MessageBuffer::read_uint16s(uint16_t* data, uint32_t n)
 
 int32_t MessageBuffer::write_uint32s(const uint32_t* data, uint32_t n)
 {
-    uint32_t i;
-    uint32_t an_uint32;
     //std::cerr  << "write_uint32s(" << data << " = [" << (n ? data[0] : 0) <<" ...], " << n << ")" << std::endl;
 
+    if (compact) {
+        return write_varint_uint32s(data, n);
+    }
+
     if ((4 * n) >= (bufferMaxSize - writeOffset)) {
         /* reallocate buffer on-demand */
         reallocate(bufferMaxSize + (4 * n) - (bufferMaxSize - writeOffset) + DEFAULT_MESSAGE_BUFFER_SIZE);
@@ -316,19 +393,18 @@ int32_t MessageBuffer::write_uint32s(const uint32_t* data, uint32_t n)
         writeOffset += 4 * n;
     }
     else {
-        for (i = 0; i < n; ++i) {
-            an_uint32 = LIBHLA_UINT32_SWAP_BYTES(data[i]);
-            memcpy(buffer + writeOffset, &an_uint32, 4);
-            writeOffset += 4;
-        }
+        ByteSwap::copy32(buffer + writeOffset, data, n);
+        writeOffset += 4 * n;
     }
     return (writeOffset - 4 * n);
 } /* end of write_uint32s */
 
 int32_t MessageBuffer::read_uint32s(uint32_t* data, uint32_t n)
 {
-    uint32_t i;
-    uint32_t an_uint32;
+
+    if (compact) {
+        return read_varint_uint32s(data, n);
+    }
 
     if (4 * n + readOffset > writeOffset) {
         throw MessageBufferError("read_uint32s::invalid read of size <" + std::to_string(4 * n)
@@ -347,25 +423,95 @@ int32_t MessageBuffer::read_uint32s(uint32_t* data, uint32_t n)
         readOffset += 4 * n;
     }
     else {
-        for (i = 0; i < n; ++i) {
-            memcpy(&an_uint32, buffer + readOffset, 4);
-            data[i] = LIBHLA_UINT32_SWAP_BYTES(an_uint32);
-            readOffset += 4;
-        }
+        ByteSwap::copy32(data, buffer + readOffset, n);
+        readOffset += 4 * n;
     }
     //std::cerr  << "read_uint32s(" << data << " = [" << (n ? data[0] : 0) <<" ...], " << n << ")" << std::endl;
     return (readOffset - 4 * n);
 } /* end of read_uint32s */
 
-int32_t MessageBuffer::write_uint64s(const uint64_t* data, uint32_t n)
+int32_t MessageBuffer::write_int32s(const int32_t* data, uint32_t n)
 {
-    uint32_t i;
-    union deux32 {
-        uint32_t ui32[2];
-        uint64_t ui64;
-    } a_deux32;
-    uint32_t an_uint32;
+    if (compact) {
+        return write_varint_uint32s(reinterpret_cast<const uint32_t*>(data), n, true);
+    }
+    return write_uint32s(reinterpret_cast<const uint32_t*>(data), n);
+} /* end of write_int32s */
+
+int32_t MessageBuffer::read_int32s(int32_t* data, uint32_t n)
+{
+    if (compact) {
+        return read_varint_uint32s(reinterpret_cast<uint32_t*>(data), n, true);
+    }
+    return read_uint32s(reinterpret_cast<uint32_t*>(data), n);
+} /* end of read_int32s */
+
+int32_t MessageBuffer::write_varint_uint32s(const uint32_t* data, uint32_t n, bool zigzag_first)
+{
+    const uint32_t start = writeOffset;
+
+    if ((MAX_VARINT_SIZE * n) >= (bufferMaxSize - writeOffset)) {
+        /* reallocate buffer on-demand */
+        reallocate(bufferMaxSize + (MAX_VARINT_SIZE * n) - (bufferMaxSize - writeOffset)
+                   + DEFAULT_MESSAGE_BUFFER_SIZE);
+    }
+
+    /* first value as is (zigzag encoded if signed), then the (zigzag encoded)
+       difference with the previous one */
+    uint32_t previous = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+        uint32_t value = data[i];
+        if (i > 0 || zigzag_first) {
+            const int32_t delta = static_cast<int32_t>(data[i] - previous);
+            value = (static_cast<uint32_t>(delta) << 1) ^ static_cast<uint32_t>(delta >> 31);
+        }
+        previous = data[i];
+
+        while (value >= 0x80) {
+            buffer[writeOffset++] = static_cast<uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        buffer[writeOffset++] = static_cast<uint8_t>(value);
+    }
+    return start;
+} /* end of write_varint_uint32s */
 
+uint32_t MessageBuffer::read_varint()
+{
+    uint32_t value = 0;
+    for (uint32_t shift = 0; shift < 7 * MAX_VARINT_SIZE; shift += 7) {
+        if (readOffset >= writeOffset) {
+            throw MessageBufferError("read_varint::invalid read after the end of the buffer (writeOffset="
+                                     + std::to_string(writeOffset)
+                                     + ").");
+        }
+        const uint8_t byte = buffer[readOffset++];
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+    throw MessageBufferError("read_varint::invalid varint ending at readOffset=" + std::to_string(readOffset));
+} /* end of read_varint */
+
+int32_t MessageBuffer::read_varint_uint32s(uint32_t* data, uint32_t n, bool zigzag_first)
+{
+    const uint32_t start = readOffset;
+
+    uint32_t previous = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+        uint32_t value = read_varint();
+        if (i > 0 || zigzag_first) {
+            const int32_t delta = static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+            value = previous + static_cast<uint32_t>(delta);
+        }
+        data[i] = previous = value;
+    }
+    return start;
+} /* end of read_varint_uint32s */
+
+int32_t MessageBuffer::write_uint64s(const uint64_t* data, uint32_t n)
+{
     //std::cerr  << "write_uint64s(" << data << " = [" << (n ? data[0] : 0) <<" ...], " << n << ")" << std::endl;
 
     if ((8 * n) >= (bufferMaxSize - writeOffset)) {
@@ -379,27 +525,14 @@ int32_t MessageBuffer::write_uint64s(const uint64_t* data, uint32_t n)
         writeOffset += 8 * n;
     }
     else {
-        for (i = 0; i < n; ++i) {
-            a_deux32.ui64 = data[i];
-            an_uint32 = LIBHLA_UINT32_SWAP_BYTES(a_deux32.ui32[1]);
-            memcpy(buffer + writeOffset, &an_uint32, 4);
-            writeOffset += 4;
-            an_uint32 = LIBHLA_UINT32_SWAP_BYTES(a_deux32.ui32[0]);
-            memcpy(buffer + writeOffset, &an_uint32, 4);
-            writeOffset += 4;
-        }
+        ByteSwap::copy64(buffer + writeOffset, data, n);
+        writeOffset += 8 * n;
     }
     return (writeOffset - 8 * n);
 } /* end of write_uint64s */
 
 int32_t MessageBuffer::read_uint64s(uint64_t* data, uint32_t n)
 {
-    uint32_t i;
-    union deux32 {
-        uint32_t ui32[2];
-        uint64_t ui64;
-    } a_deux32;
-    uint32_t an_uint32;
     //std::cerr  << "read_uint64s(" << data << " = [" << (n ? data[0] : 0) <<" ...], " << n << ")" << std::endl;
 
     if (8 * n + readOffset > writeOffset) {
@@ -419,17 +552,8 @@ int32_t MessageBuffer::read_uint64s(uint64_t* data, uint32_t n)
         readOffset += 8 * n;
     }
     else {
-        for (i = 0; i < n; ++i) {
-            memcpy(&an_uint32, buffer + readOffset, 4);
-            a_deux32.ui32[1] = LIBHLA_UINT32_SWAP_BYTES(an_uint32);
-            readOffset += 4;
-
-            memcpy(&an_uint32, buffer + readOffset, 4);
-            a_deux32.ui32[0] = LIBHLA_UINT32_SWAP_BYTES(an_uint32);
-            readOffset += 4;
-
-            data[i] = a_deux32.ui64;
-        }
+        ByteSwap::copy64(data, buffer + readOffset, n);
+        readOffset += 8 * n;
     }
     return (readOffset - 8 * n);
 }
@@ -502,11 +626,14 @@ void MessageBuffer::updateReservedBytes()
 {
     /* set up buffer endianess */
     if ((HostIsBigEndian() && bufferHasMyEndianness) || (HostIsLittleEndian() && !bufferHasMyEndianness)) {
-        buffer[0] = 0x01;
+        buffer[0] = BIG_ENDIAN_FLAG;
     }
     else {
         buffer[0] = 0x00;
     }
+    if (compact) {
+        buffer[0] |= COMPACT_FLAG;
+    }
     /* set up size */
     setSizeInReservedBytes(size());
 } /* end of updateReservedBytes */
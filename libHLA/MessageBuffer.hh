@@ -23,6 +23,8 @@
 
 #include "libhla.hh"
 
+#include <vector>
+
 // #define DEFAULT_MESSAGE_BUFFER_SIZE 255
 
 namespace libhla {
@@ -61,11 +63,26 @@ public:
 	 * We reserve 5 bytes at the beginning of the buffer
 	 * The first byte is a bitset which is used to 
 	 * to tell if the buffer is big or little endian
+	 * (and if it uses the compact encoding, see setCompact)
 	 * The 4 following bytes is for an uint32_t which
 	 * may be used to store the buffer size
 	 */
     static const uint8_t reservedBytes;
 
+    /**
+	 * Byte arrays of at least this size are referenced
+	 * instead of copied by a segmented buffer (see setSegmented).
+	 */
+    static const uint32_t segmentThreshold;
+
+    /**
+	 * A contiguous part of the buffer content (see segments).
+	 */
+    struct Segment {
+        const uint8_t* data;
+        uint32_t length;
+    };
+
     LIBHLA_EXCEPTION(MessageBufferError)
 
     /**
@@ -111,6 +128,61 @@ public:
 	 */
     void assumeBufferIsLittleEndian();
 
+    /**
+	 * Select the compact encoding for the data written from now on:
+	 * 32 bits integers are written as varints (7 bits per byte),
+	 * signed ones zigzag encoded so that small negative values
+	 * take one byte too, and arrays of 32 bits integers as a varint
+	 * followed by zigzag varint deltas, so that sorted handle lists
+	 * take about one byte per element. The reserved bytes header
+	 * keeps its size and tells the reader which encoding was used.
+	 * reset() goes back to the fixed size encoding.
+	 */
+    void setCompact(bool compact);
+
+    /**
+	 * Return true if the buffer uses the compact encoding.
+	 */
+    bool isCompact() const
+    {
+        return compact;
+    }
+
+    /**
+	 * Select the segmented mode for the data written from now on:
+	 * byte arrays (and strings) of at least segmentThreshold bytes
+	 * are not copied, the buffer only references them, so they must
+	 * be left unchanged until the buffer is sent.
+	 * A segmented buffer is only meant to be sent: its content is
+	 * given by segments(), operator() only gives the copied bytes
+	 * whereas size() includes the referenced ones.
+	 * reset() leaves the segmented mode.
+	 */
+    void setSegmented(bool segmented);
+
+    /**
+	 * Return true if some byte arrays are referenced (see setSegmented).
+	 */
+    bool hasSegments() const
+    {
+        return !externals.empty();
+    }
+
+    /**
+	 * The buffer content in order, ready for a gather write:
+	 * the copied bytes split around the referenced byte arrays.
+	 */
+    std::vector<Segment> segments() const;
+
+    /**
+	 * Return true if every byte written has been read.
+	 * Used to read optional fields which older peers did not send.
+	 */
+    bool endOfBuffer() const
+    {
+        return readOffset >= writeOffset;
+    }
+
     /**
 	 * Reset buffer state
 	 * This method should be called if ones want
@@ -124,6 +196,13 @@ public:
 	 */
     void seek_write(uint32_t offset);
 
+    /**
+	 * Move the read pointer back to the first byte
+	 * following the reserved bytes, so that the message
+	 * may be read again without being received again.
+	 */
+    void rewind();
+
     /**
 	 * Resize the current maximum buffer size (in bytes).
 	 * This is the size of the allocated buffer.
@@ -153,6 +232,13 @@ public:
 	 */
     void assumeSizeFromReservedBytes();
 
+    /**
+	 * Total size of the buffer whose reserved bytes header
+	 * is given (as assumeSizeFromReservedBytes() would find).
+	 * @param[in] reserved the reservedBytes first bytes of the buffer
+	 */
+    static uint32_t sizeFromReservedBytes(const uint8_t* reserved);
+
 #define DECLARE_SIGNED(type)                                                                                           \
     int32_t write_##type##s(const type##_t* data, uint32_t n)                                                          \
     {                                                                                                                  \
@@ -222,7 +308,11 @@ public:
     int32_t read_uint32s(uint32_t* data, uint32_t n);
 
     DECLARE_SINGLE_READ_WRITE(uint32, _t)
-    DECLARE_SIGNED(int32)
+
+    /* not DECLARE_SIGNED: the compact encoding zigzags signed values */
+    int32_t write_int32s(const int32_t* data, uint32_t n);
+    int32_t read_int32s(int32_t* data, uint32_t n);
+
     DECLARE_SINGLE_READ_WRITE(int32, _t)
 
     int32_t write_uint64s(const uint64_t* data, uint32_t n);
@@ -289,6 +379,21 @@ private:
     uint32_t bufferMaxSize;
     /** Endianness toggle */
     bool bufferHasMyEndianness;
+    /** Compact (varint) encoding toggle */
+    bool compact;
+    /** Segmented mode toggle */
+    bool segmented;
+
+    /** A byte array referenced by a segmented buffer */
+    struct External {
+        /** the copied bytes this array comes before */
+        uint32_t offset;
+        const uint8_t* data;
+        uint32_t length;
+    };
+    std::vector<External> externals;
+    /** Total length of the referenced byte arrays */
+    uint32_t externalSize;
     /** 
 	 * The write offset is the offset of the buffer
 	 * where the next write operation will write to.
@@ -303,8 +408,10 @@ private:
 
     void initialize();
     /**
-	 * Reallocate the underlying buffer to size n.
-	 * Reallocation will be done only if it is necessary.
+	 * Reallocate the underlying buffer to size n at least.
+	 * Reallocation will be done only if it is necessary,
+	 * the size is then at least doubled so that a buffer
+	 * written piece by piece is copied O(log n) times only.
 	 */
     void reallocate(uint32_t n);
 
@@ -313,6 +420,14 @@ private:
 	 * the actual size of the buffer.
 	 */
     void setSizeInReservedBytes(uint32_t n);
+
+    /**
+	 * Compact encoding of 32 bits integers arrays.
+	 * @param[in] zigzag_first zigzag the first value too (signed integers)
+	 */
+    int32_t write_varint_uint32s(const uint32_t* data, uint32_t n, bool zigzag_first = false);
+    int32_t read_varint_uint32s(uint32_t* data, uint32_t n, bool zigzag_first = false);
+    uint32_t read_varint();
 };
 
 } // libhla
@@ -72,6 +72,8 @@
 #include <sstream> // IWYU pragma: export
 #include <string> // IWYU pragma: export
 
+#define LIBHLA_INT64_CONSTANT(val) (val##LL)
+
 #define LIBHLA_UINT64_SWAP_LE_BE_CONSTANT(val)                                                                         \
     ((uint64_t)((((uint64_t)(val) & (uint64_t) LIBHLA_INT64_CONSTANT(0x00000000000000ffU)) << 56)                      \
                 | (((uint64_t)(val) & (uint64_t) LIBHLA_INT64_CONSTANT(0x000000000000ff00U)) << 40)                    \
@@ -74,6 +74,9 @@ RTIambPrivateRefs::RTIambPrivateRefs()
     handle_RTIA = (HANDLE) -1;
 #else
     pid_RTIA = (pid_t) -1;
+#endif
+#ifdef CERTI_RTIA_IN_PROCESS
+    rtiaThread = NULL;
 #endif
     is_reentrant = false;
     _theRootObj = NULL;
@@ -83,6 +86,10 @@ RTIambPrivateRefs::RTIambPrivateRefs()
 RTIambPrivateRefs::~RTIambPrivateRefs()
 {
     delete socketUn;
+#ifdef CERTI_RTIA_IN_PROCESS
+    // The federate end is closed now, so the RTIA thread is about to end.
+    delete rtiaThread;
+#endif
 }
 
 // ----------------------------------------------------------------------------
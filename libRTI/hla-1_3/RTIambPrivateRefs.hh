@@ -27,6 +27,9 @@
 #include "Message.hh"
 #include "RootObject.hh"
 #include "MessageBuffer.hh"
+#ifdef CERTI_RTIA_IN_PROCESS
+#include "RTIA/RTIAThread.hh"
+#endif
 
 using namespace certi ;
 
@@ -47,6 +50,9 @@ public:
 #else
     pid_t pid_RTIA ; //!< pid associated with rtia fork (private).
 #endif
+#ifdef CERTI_RTIA_IN_PROCESS
+    certi::rtia::RTIAThread *rtiaThread ; //!< in-process RTIA (private).
+#endif
 
     //! Federate Ambassador reference for module calls.
     RTI::FederateAmbassador *fed_amb ;
@@ -37,6 +37,7 @@
 #include <stdio.h>
 #include <string.h>
 #else
+#include "SocketSHMRing.hh"
 #include <unistd.h>
 #endif
 #include <cassert>
@@ -163,7 +164,25 @@ RTI::RTIambassador::RTIambassador() throw(RTI::MemoryExhausted, RTI::RTIinternal
 
     privateRefs = new RTIambPrivateRefs();
 
-    privateRefs->socketUn = new SocketUN(stIgnoreSignal);
+#ifndef _WIN32
+    // CERTI_RTIA_TRANSPORT=shm: exchange messages with the RTIA through shared memory rings.
+    // An in-process RTIA always does: the messages go from thread to thread through
+    // memory, the socket pair only wakes up the side waiting for them.
+    SocketSHMRing* shmRing = nullptr;
+    const char* transport = getenv("CERTI_RTIA_TRANSPORT");
+#if defined(CERTI_RTIA_IN_PROCESS)
+    const bool rings = true;
+    (void) transport;
+#else
+    const bool rings = transport && std::string(transport) == "shm";
+#endif
+    if (rings) {
+        shmRing = new SocketSHMRing(stIgnoreSignal);
+        privateRefs->socketUn = shmRing;
+    }
+    else
+#endif
+        privateRefs->socketUn = new SocketUN(stIgnoreSignal);
 
     privateRefs->is_reentrant = false;
 
@@ -191,7 +210,16 @@ RTI::RTIambassador::RTIambassador() throw(RTI::MemoryExhausted, RTI::RTIinternal
     }
 #endif
 
-#ifdef _WIN32
+#if defined(CERTI_RTIA_IN_PROCESS)
+    // Run the RTIA on a thread of our own process: no fork, no exec.
+    (void) rtiaList;
+#if defined(RTIA_USE_TCP)
+    privateRefs->rtiaThread = new certi::rtia::RTIAThread(port, -1);
+#else
+    privateRefs->rtiaThread = new certi::rtia::RTIAThread(0, pipeFd);
+#endif
+
+#elif defined(_WIN32)
     STARTUPINFO si;
     PROCESS_INFORMATION pi;
 
@@ -317,7 +345,9 @@ RTI::RTIambassador::RTIambassador() throw(RTI::MemoryExhausted, RTI::RTIinternal
 
 #if defined(RTIA_USE_TCP)
     if (privateRefs->socketUn->acceptUN(10 * 1000) == -1) {
-#ifdef _WIN32
+#if defined(CERTI_RTIA_IN_PROCESS)
+        // the RTIA thread ends by itself once it failed to connect
+#elif defined(_WIN32)
         TerminateProcess(privateRefs->handle_RTIA, 0);
 #else
         kill(privateRefs->pid_RTIA, SIGINT);
@@ -329,9 +359,24 @@ RTI::RTIambassador::RTIambassador() throw(RTI::MemoryExhausted, RTI::RTIinternal
     M_Open_Connexion req, rep;
     req.setVersionMajor(CERTI_Message::versionMajor);
     req.setVersionMinor(CERTI_Message::versionMinor);
+#ifndef _WIN32
+    if (shmRing) {
+        try {
+            req.setShmRingName(shmRing->create());
+        }
+        catch (certi::NetworkError& e) {
+            Debug(D, pdError) << e.reason() << ", keeping the Unix socket" << std::endl;
+        }
+    }
+#endif
 
     Debug(G, pdGendoc) << "        ====>executeService OPEN_CONNEXION" << std::endl;
     privateRefs->executeService(&req, &rep);
+#ifndef _WIN32
+    if (shmRing && rep.hasShmRingName()) {
+        shmRing->activate();
+    }
+#endif
 
     Debug(G, pdGendoc) << "exit  RTIambassador::RTIambassador" << std::endl;
 }
@@ -405,7 +450,7 @@ RTI::Boolean RTI::RTIambassador::__tick_kernel(RTI::Boolean multiple, TickTime m
         try {
             vers_Fed.reset(M_Factory::receive(privateRefs->socketUn));
         }
-        catch (NetworkError& e) {
+        catch (certi::NetworkError& e) {
             std::stringstream msg;
             msg << "NetworkError in tick() while receiving response: " << e.reason();
             throw RTI::RTIinternalError(msg.str().c_str());
@@ -437,7 +482,7 @@ RTI::Boolean RTI::RTIambassador::__tick_kernel(RTI::Boolean multiple, TickTime m
             M_Tick_Request_Next tick_next;
             tick_next.send(privateRefs->socketUn, privateRefs->msgBufSend);
         }
-        catch (NetworkError& e) {
+        catch (certi::NetworkError& e) {
             std::stringstream msg;
             msg << "NetworkError in tick() while sending TICK_REQUEST_NEXT: " << e.reason();
 
@@ -468,7 +513,13 @@ void RTI::RTIambassador::setPriorityforRTIAProcess(int priority, unsigned int sc
     int cr;
 
     sparm.sched_priority = priority;
+#if defined(CERTI_RTIA_IN_PROCESS)
+    // no RTIA process, pid_RTIA is -1: schedule the RTIA thread
+    (void) sparm;
+    cr = privateRefs->rtiaThread->setScheduler(sched_type, priority);
+#else
     cr = sched_setscheduler(privateRefs->pid_RTIA, sched_type, &sparm);
+#endif
     if (cr != 0) {
         throw RTIinternalError("RTIA process changing priority did not work");
         if (errno == EPERM) {
@@ -487,10 +538,15 @@ void RTI::RTIambassador::setAffinityforRTIAProcess(cpu_set_t mask) throw(RTIinte
 {
 #ifdef _WIN32
     throw RTIinternalError("Not Implemented on Windows");
+#else
+#if defined(CERTI_RTIA_IN_PROCESS)
+    if (privateRefs->rtiaThread->setAffinity(mask))
+        throw RTIinternalError("RTIA thread Error : pthread_setaffinity_np");
 #else
     if (sched_setaffinity(privateRefs->pid_RTIA, sizeof(cpu_set_t), &mask))
         throw RTIinternalError("RTIA process Error : sched_setaffinity");
 #endif
+#endif
 }
 #endif
 
@@ -36,7 +36,9 @@
 
 #include "M_Classes.hh"
 #include "PrettyDebug.hh"
+#include <deque>
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 namespace certi {
@@ -148,6 +150,8 @@ void RTI1516ambassador::Private::executeService(Message* req, Message* rep)
     Debug(G, pdGendoc) << "enter RTI1516ambassador::Private::executeService(" << req->getMessageName() << ", "
                        << rep->getMessageName() << ")" << std::endl;
 
+    LinkGuard link(*this);
+
     Debug(D, pdDebug) << "sending request to RTIA." << std::endl;
 
     try {
@@ -221,6 +225,178 @@ void RTI1516ambassador::Private::sendTickRequestStop()
     Debug(G, pdGendoc) << "exit RTI1516ambassador::Private::sendTickRequestStop" << std::endl;
 }
 
+RTI1516ambassador::Private::LinkGuard::LinkGuard(Private& p) : my_private(p)
+{
+    if (!my_private.callback_thread.joinable()) {
+        return;
+    }
+
+    my_lock = std::unique_lock<std::mutex>(my_private.link_mutex);
+    ++my_private.services_waiting;
+    my_private.stopTick(my_lock);
+    --my_private.services_waiting;
+}
+
+RTI1516ambassador::Private::LinkGuard::~LinkGuard()
+{
+    if (my_lock.owns_lock()) {
+        my_lock.unlock();
+        my_private.link_condition.notify_all();
+    }
+}
+
+void RTI1516ambassador::Private::startCallbackThread()
+{
+    if (callback_thread.joinable()) {
+        return;
+    }
+    callback_thread_quit = false;
+    callback_thread = std::thread(&Private::runCallbackThread, this);
+}
+
+void RTI1516ambassador::Private::stopCallbackThread()
+{
+    if (!callback_thread.joinable()) {
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(link_mutex);
+        callback_thread_quit = true;
+        link_condition.notify_all();
+        if (std::this_thread::get_id() != callback_thread.get_id()) {
+            stopTick(lock);
+        }
+    }
+
+    if (std::this_thread::get_id() == callback_thread.get_id()) {
+        // called from a callback: the thread ends once the callback returns
+        callback_thread.detach();
+    }
+    else {
+        callback_thread.join();
+    }
+}
+
+void RTI1516ambassador::Private::setCallbacksEnabled(bool enabled)
+{
+    std::unique_lock<std::mutex> lock(link_mutex);
+    callbacks_enabled = enabled;
+    link_condition.notify_all();
+
+    // no callback must be received once disableCallbacks() has returned
+    if (!enabled && callback_thread.joinable() && std::this_thread::get_id() != callback_thread.get_id()) {
+        stopTick(lock);
+    }
+}
+
+bool RTI1516ambassador::Private::callbacksEnabled()
+{
+    std::lock_guard<std::mutex> lock(link_mutex);
+    return callbacks_enabled;
+}
+
+void RTI1516ambassador::Private::stopTick(std::unique_lock<std::mutex>& lock)
+{
+    while (tick_running) {
+        if (!tick_stop_sent) {
+            // The RTIA answers the ongoing tick; if the tick has just returned
+            // on its own, the RTIA ignores this request.
+            M_Tick_Request_Stop stop;
+            try {
+                stop.send(socket_un.get(), msgBufSend);
+            }
+            catch (certi::NetworkError&) {
+                throw rti1516e::RTIinternalError(L"libRTI: Network Write Error");
+            }
+            tick_stop_sent = true;
+        }
+        link_condition.wait(lock);
+    }
+}
+
+void RTI1516ambassador::Private::runCallbackThread()
+{
+    Debug(D, pdInit) << "HLA_IMMEDIATE callback thread started" << std::endl;
+
+    // callbacks returned by the RTIA, not delivered yet
+    std::deque<std::unique_ptr<Message>> callbacks;
+
+    std::unique_lock<std::mutex> lock(link_mutex);
+    while (!callback_thread_quit) {
+        if (!callbacks_enabled || !fed_amb) {
+            link_condition.wait(lock);
+            continue;
+        }
+
+        if (callbacks.empty()) {
+            if (services_waiting > 0) {
+                link_condition.wait(lock);
+                continue;
+            }
+
+            // Blocking tick: the RTIA answers as soon as callbacks are available
+            M_Tick_Request tick;
+            tick.setMultiple(true);
+            tick.setMinTickTime(std::numeric_limits<double>::infinity());
+            tick.setMaxTickTime(std::numeric_limits<double>::infinity());
+
+            try {
+                tick.send(socket_un.get(), msgBufSend);
+                tick_running = true;
+                tick_stop_sent = false;
+                lock.unlock();
+
+                for (;;) {
+                    std::unique_ptr<Message> msg(M_Factory::receive(socket_un.get()));
+                    if (msg->getMessageType() == Message::TICK_REQUEST) {
+                        break;
+                    }
+                    callbacks.push_back(std::move(msg));
+
+                    lock.lock();
+                    if (!tick_stop_sent) {
+                        M_Tick_Request_Next next;
+                        next.send(socket_un.get(), msgBufSend);
+                    }
+                    lock.unlock();
+                }
+            }
+            catch (certi::NetworkError& e) {
+                Debug(D, pdError) << "Callback thread lost the RTIA link: " << e.reason() << std::endl;
+                if (!lock.owns_lock()) {
+                    lock.lock();
+                }
+                tick_running = false;
+                link_condition.notify_all();
+                break;
+            }
+
+            lock.lock();
+            tick_running = false;
+            link_condition.notify_all();
+        }
+
+        // The RTIA link is free again: the callbacks may use the RTI ambassador.
+        while (!callbacks.empty() && callbacks_enabled && fed_amb && !callback_thread_quit) {
+            std::unique_ptr<Message> msg = std::move(callbacks.front());
+            callbacks.pop_front();
+
+            lock.unlock();
+            try {
+                callFederateAmbassador(msg.get());
+            }
+            catch (rti1516e::Exception& e) {
+                Debug(D, pdError) << "Callback failed: " << std::string(e.what().begin(), e.what().end())
+                                  << std::endl;
+            }
+            lock.lock();
+        }
+    }
+
+    Debug(D, pdTerm) << "HLA_IMMEDIATE callback thread stopped" << std::endl;
+}
+
 void RTI1516ambassador::Private::processException(Message* msg)
 {
     Debug(D, pdExcept) << "Exception #" << static_cast<int>(msg->getExceptionType()) << std::endl;
@@ -31,6 +31,13 @@
 #include "RootObject.hh"
 #include <RTI/certiRTI1516.h>
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#ifdef CERTI_RTIA_IN_PROCESS
+#include "RTIA/RTIAThread.hh"
+#endif
+
 namespace certi {
 
 struct RTI1516ambassador::Private {
@@ -44,6 +51,28 @@ struct RTI1516ambassador::Private {
     void callFederateAmbassador(Message* msg);
     void leave(const char* msg);
 
+    /** HLA_IMMEDIATE callback model.
+     * A dedicated thread keeps a blocking tick running in the RTIA, collects the
+     * callbacks it returns and invokes the federate ambassador once the tick is
+     * over, so that the callbacks may freely call the RTI ambassador.
+     * Any other use of the RTIA link first stops the ongoing tick (LinkGuard).
+     */
+    void startCallbackThread();
+    void stopCallbackThread();
+    void setCallbacksEnabled(bool enabled);
+    bool callbacksEnabled();
+
+    /// Exclusive use of the RTIA link while the callback thread is running.
+    class LinkGuard {
+    public:
+        explicit LinkGuard(Private& p);
+        ~LinkGuard();
+
+    private:
+        Private& my_private;
+        std::unique_lock<std::mutex> my_lock;
+    };
+
 #ifdef _WIN32
     HANDLE handle_RTIA;
 #else
@@ -54,12 +83,34 @@ struct RTI1516ambassador::Private {
     /// Federate Ambassador reference for module calls.
     rti1516e::FederateAmbassador* fed_amb{nullptr};
 
+    rti1516e::CallbackModel callback_model{rti1516e::HLA_EVOKED};
+
     /// used to prevent reentrant calls (see tick() and executeService()).
     bool is_reentrant{false};
 
     RootObject* root_object{nullptr};
 
+#ifdef CERTI_RTIA_IN_PROCESS
+    /// in-process RTIA, declared before socket_un so that it is joined after the federate end is closed.
+    std::unique_ptr<rtia::RTIAThread> rtia_thread{nullptr};
+#endif
+
     std::unique_ptr<SocketUN> socket_un{nullptr};
     MessageBuffer msgBufSend, msgBufReceive;
+
+private:
+    void runCallbackThread();
+    void stopTick(std::unique_lock<std::mutex>& lock);
+
+    std::thread callback_thread;
+    /// protects the fields below and serializes the writes on socket_un
+    std::mutex link_mutex;
+    std::condition_variable link_condition;
+    bool callbacks_enabled{true};
+    bool callback_thread_quit{false};
+    /// the callback thread waits for the TICK_REQUEST answer
+    bool tick_running{false};
+    bool tick_stop_sent{false};
+    unsigned services_waiting{0};
 };
 }
@@ -37,6 +37,9 @@
 #include "RTIambassadorImplementation.h"
 
 #include "M_Classes.hh"
+#ifndef _WIN32
+#include "SocketSHMRing.hh"
+#endif
 
 #include "config.h"
 
@@ -64,7 +67,25 @@ rti1516e::RTIambassadorFactory::createRTIambassador() throw(rti1516e::RTIinterna
     p_ambassador->p->handle_RTIA = (HANDLE) -1;
 #endif
 
-    p_ambassador->p->socket_un = std::auto_ptr<certi::SocketUN>(new certi::SocketUN(certi::stIgnoreSignal));
+#ifndef _WIN32
+    // CERTI_RTIA_TRANSPORT=shm: exchange messages with the RTIA through shared memory rings.
+    // An in-process RTIA always does: the messages go from thread to thread through
+    // memory, the socket pair only wakes up the side waiting for them.
+    certi::SocketSHMRing* shmRing = nullptr;
+    const char* transport = getenv("CERTI_RTIA_TRANSPORT");
+#if defined(CERTI_RTIA_IN_PROCESS)
+    const bool rings = true;
+    (void) transport;
+#else
+    const bool rings = transport && std::string(transport) == "shm";
+#endif
+    if (rings) {
+        shmRing = new certi::SocketSHMRing(certi::stIgnoreSignal);
+        p_ambassador->p->socket_un.reset(shmRing);
+    }
+    else
+#endif
+        p_ambassador->p->socket_un = std::auto_ptr<certi::SocketUN>(new certi::SocketUN(certi::stIgnoreSignal));
 
     std::vector<std::string> rtiaList;
 
@@ -95,7 +116,16 @@ rti1516e::RTIambassadorFactory::createRTIambassador() throw(rti1516e::RTIinterna
     }
 #endif
 
-#ifdef _WIN32
+#if defined(CERTI_RTIA_IN_PROCESS)
+    // Run the RTIA on a thread of our own process: no fork, no exec.
+    (void) rtiaList;
+#if defined(RTIA_USE_TCP)
+    p_ambassador->p->rtia_thread.reset(new certi::rtia::RTIAThread(port, -1));
+#else
+    p_ambassador->p->rtia_thread.reset(new certi::rtia::RTIAThread(0, pipeFd));
+#endif
+
+#elif defined(_WIN32)
     STARTUPINFO si;
     PROCESS_INFORMATION pi;
 
@@ -218,7 +248,9 @@ rti1516e::RTIambassadorFactory::createRTIambassador() throw(rti1516e::RTIinterna
 
 #if defined(RTIA_USE_TCP)
     if (p_ambassador->p->socketUn->acceptUN(10 * 1000) == -1) {
-#ifdef _WIN32
+#if defined(CERTI_RTIA_IN_PROCESS)
+        // the RTIA thread ends by itself once it failed to connect
+#elif defined(_WIN32)
         TerminateProcess(p_ambassador->p->handle_RTIA, 0);
 #else
         kill(p_ambassador->p->pid_RTIA, SIGINT);
@@ -230,9 +262,24 @@ rti1516e::RTIambassadorFactory::createRTIambassador() throw(rti1516e::RTIinterna
     certi::M_Open_Connexion req, rep;
     req.setVersionMajor(certi::CERTI_Message::versionMajor);
     req.setVersionMinor(certi::CERTI_Message::versionMinor);
+#ifndef _WIN32
+    if (shmRing) {
+        try {
+            req.setShmRingName(shmRing->create());
+        }
+        catch (certi::NetworkError& e) {
+            Debug(D1516, pdError) << e.reason() << ", keeping the Unix socket" << std::endl;
+        }
+    }
+#endif
 
     Debug(G1516, pdGendoc) << "        ====>executeService OPEN_CONNEXION" << std::endl;
     p_ambassador->p->executeService(&req, &rep);
+#ifndef _WIN32
+    if (shmRing && rep.hasShmRingName()) {
+        shmRing->activate();
+    }
+#endif
 
     Debug(G1516, pdGendoc) << "exit  RTIambassador::RTIambassador" << std::endl;
 
@@ -125,6 +125,8 @@ RTI1516ambassador::RTI1516ambassador() noexcept = default;
 
 RTI1516ambassador::~RTI1516ambassador()
 {
+    p->stopCallbackThread();
+
     certi::M_Close_Connexion req, rep;
 
     Debug(G, pdGendoc) << "        ====>executeService CLOSE_CONNEXION" << std::endl;
@@ -137,6 +139,10 @@ bool RTI1516ambassador::__tick_kernel(bool multiple, TickTime minimum, TickTime
     M_Tick_Request vers_RTI;
     std::auto_ptr<Message> vers_Fed;
 
+    if (!p->callbacksEnabled()) {
+        return false;
+    }
+
     // Request callback(s) from the local RTIA
     vers_RTI.setMultiple(multiple);
     vers_RTI.setMinTickTime(minimum);
@@ -206,9 +212,13 @@ void RTI1516ambassador::connect(
     case rti1516e::HLA_EVOKED:
         // before rti1516-2010 this this done in CFE
         p->fed_amb = &federateAmbassador;
+        p->callback_model = theCallbackModel;
         break;
     case rti1516e::HLA_IMMEDIATE:
-        throw rti1516e::UnsupportedCallbackModel(L"CONNECT callback model HLA_IMMEDIATE not implemented [yet].");
+        p->fed_amb = &federateAmbassador;
+        p->callback_model = theCallbackModel;
+        p->startCallbackThread();
+        break;
     default:
         throw rti1516e::UnsupportedCallbackModel(L"CONNECT unsupported callback model");
     }
@@ -219,6 +229,7 @@ void RTI1516ambassador::disconnect() throw(rti1516e::FederateIsExecutionMember,
                                            rti1516e::CallNotAllowedFromWithinCallback,
                                            rti1516e::RTIinternalError)
 {
+    p->stopCallbackThread();
     p->fed_amb = NULL;
 }
 
@@ -2998,6 +3009,10 @@ void RTI1516ambassador::disableInteractionRelevanceAdvisorySwitch() throw(
 bool RTI1516ambassador::evokeCallback(double approximateMinimumTimeInSeconds) throw(
     rti1516e::CallNotAllowedFromWithinCallback, rti1516e::RTIinternalError)
 {
+    if (p->callback_model == rti1516e::HLA_IMMEDIATE) {
+        // callbacks are delivered by the callback thread
+        return false;
+    }
     return __tick_kernel(false, approximateMinimumTimeInSeconds, approximateMinimumTimeInSeconds);
 }
 
@@ -3007,6 +3022,9 @@ bool RTI1516ambassador::evokeMultipleCallbacks(
     double approximateMaximumTimeInSeconds) throw(rti1516e::CallNotAllowedFromWithinCallback,
                                                   rti1516e::RTIinternalError)
 {
+    if (p->callback_model == rti1516e::HLA_IMMEDIATE) {
+        return false;
+    }
     return __tick_kernel(true, approximateMinimumTimeInSeconds, approximateMaximumTimeInSeconds);
 }
 
@@ -3015,8 +3033,7 @@ void RTI1516ambassador::enableCallbacks() throw(rti1516e::SaveInProgress,
                                                 rti1516e::RestoreInProgress,
                                                 rti1516e::RTIinternalError)
 {
-    /* TODO */
-    throw rti1516e::RTIinternalError(L"enableCallbacks Not implemented");
+    p->setCallbacksEnabled(true);
 }
 
 // 10.40
@@ -3024,8 +3041,7 @@ void RTI1516ambassador::disableCallbacks() throw(rti1516e::SaveInProgress,
                                                  rti1516e::RestoreInProgress,
                                                  rti1516e::RTIinternalError)
 {
-    /* TODO */
-    throw rti1516e::RTIinternalError(L"disableCallbacks Not implemented");
+    p->setCallbacksEnabled(false);
 }
 
 std::auto_ptr<rti1516e::LogicalTimeFactory> RTI1516ambassador::getTimeFactory() const
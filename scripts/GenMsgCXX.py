@@ -99,6 +99,22 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
             'float': 'read_float',
             'double': 'read_double',
             }
+        # number of bytes written by MessageBuffer for fixed size types
+        self.encodedSizeMap = {
+            'onoff': 1,
+            'bool': 1,
+            'byte': 1,
+            'int8': 1,
+            'uint8': 1,
+            'int16': 2,
+            'uint16': 2,
+            'int32': 4,
+            'uint32': 4,
+            'int64': 8,
+            'uint64': 8,
+            'float': 4,
+            'double': 8,
+            }
         self.__languageName = 'C++'
         self.replacePrefix = None
         self.exportPrefix = ''
@@ -514,7 +530,10 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                     # serialize/deserialize
 
                     stream.write(self.getIndent() + virtual + 'void serialize(%s& msgBuffer);\n' % self.serializeBufferType)
-                    stream.write(self.getIndent() + virtual + 'void deserialize(%s& msgBuffer);\n\n' % self.serializeBufferType)
+                    stream.write(self.getIndent() + virtual + 'void deserialize(%s& msgBuffer);\n' % self.serializeBufferType)
+                    stream.write(self.getIndent() + self.commentLineBeginWith + ' Bytes written by serialize() with the fixed size encoding,\n')
+                    stream.write(self.getIndent() + self.commentLineBeginWith + ' an upper bound of the compact one\n')
+                    stream.write(self.getIndent() + virtual + 'uint32_t serializedSize() const;\n\n')
 
                     # specific getter/setter
 
@@ -543,7 +562,16 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                     stream.write(self.getIndent() + '\n')
                     stream.write(self.getIndent() + 'protected:\n')
                     self.indent()
-                        
+
+                    # a derived class may write the fields of a combine
+                    # its own way, already serialized for instance
+                    for field in msg.fields:
+                        if isinstance(field, GenMsgAST.MessageType.CombinedField):
+                            stream.write(self.getIndent() + self.commentLineBeginWith + ' Serialize the %s fields, a derived class may write them its own way\n' % field.typeid.name)
+                            stream.write(self.getIndent() + 'virtual void serialize%s(%s& msgBuffer);\n' % (field.typeid.name, self.serializeBufferType))
+                            stream.write(self.getIndent() + self.commentLineBeginWith + ' Bytes written by serialize%s() with the fixed size encoding\n' % field.typeid.name)
+                            stream.write(self.getIndent() + 'virtual uint32_t serialized%sSize() const;\n\n' % field.typeid.name)
+
                     for field in msg.fields:
                         if isinstance(field,
                                     GenMsgAST.MessageType.CombinedField):
@@ -595,6 +623,14 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                 for exception in self.exception[1:]:
                     stream.write(' ,%s' % exception)
                 stream.write('); \n')
+                stream.write(self.getIndent()
+                             + 'static %s* %s(%s stream, %s& msgBuffer) throw ('
+                             % (self.AST.factory.receiver
+                                + (self.serializeBufferType, )))
+                stream.write('%s' % self.exception[0])
+                for exception in self.exception[1:]:
+                    stream.write(' ,%s' % exception)
+                stream.write('); \n')
 
             self.unIndent()
 
@@ -629,7 +665,112 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                      % headerProtectMacroName)
         stream.write('#endif\n')
 
+    def getWireTypeName(self, name):
+        """
+        Get the builtin type used on the wire for a field type:
+        the type itself or the (non repeated) representation of a native.
+        """
+        if name in self.builtinTypeMap.keys():
+            return name
+        representation = self.getRepresentationFor(name)
+        if representation and not representation.hasQualifier():
+            return self.getWireTypeName(representation.representation)
+        return None
+
+    def getEncodedSize(self, name):
+        """
+        Get the encoded size of a fixed size type, None otherwise.
+        """
+        wireType = self.getWireTypeName(name)
+        if wireType in self.encodedSizeMap.keys():
+            return self.encodedSizeMap[wireType]
+        # enum are serialized as uint32
+        if name in [m.name for m in self.AST.enums]:
+            return self.encodedSizeMap['uint32']
+        return None
+
+    def getBulkMethodSuffix(self, field):
+        """
+        Get the suffix of the MessageBuffer array methods which
+        (de)serialize all the elements of a repeated field at once
+        (a single memcpy when the endianness matches), or None if the
+        elements have to be handled one by one.
+        """
+        if field.qualifier != 'repeated':
+            return None
+        wireType = self.getWireTypeName(field.typeid.name)
+        if wireType in ('onoff', 'bool', 'string', None):
+            return None
+        if wireType == 'byte':
+            return 'uint8s'
+        return wireType + 's'
+
+    def getVariableSizeExpression(self, typeName, expression):
+        """
+        Get the C++ expression of the encoded size of a variable size
+        value, None if the value is not serialized at all.
+        """
+        if self.getWireTypeName(typeName) == 'string':
+            return '4 + %s.size()' % expression
+        if typeName in [m.name for m in self.AST.messages]:
+            return '%s.serializedSize()' % expression
+        repLine = self.getRepresentationFor(typeName)
+        if repLine and repLine.hasQualifier() and repLine.qualifier == 'repeated':
+            if repLine.representation in self.encodedSizeMap.keys():
+                elementSize = self.encodedSizeMap[repLine.representation]
+                if elementSize == 1:
+                    return '4 + %s.size()' % expression
+                return '4 + %d * %s.size()' % (elementSize, expression)
+        return None
+
+    def writeSerializedSizeFieldStatement(self, stream, field):
+        fixedSize = self.getEncodedSize(field.typeid.name)
+        if field.qualifier == 'optional':
+            stream.write(self.getIndent() + 'size += 1;\n')
+            if fixedSize:
+                expression = str(fixedSize)
+            else:
+                expression = self.getVariableSizeExpression(field.typeid.name, field.name)
+            if expression:
+                stream.write(self.getIndent() + 'if (_has%s) {\n' % self.upperFirst(field.name))
+                self.indent()
+                stream.write(self.getIndent() + 'size += %s;\n' % expression)
+                self.unIndent()
+                stream.write(self.getIndent() + '}\n')
+        elif field.qualifier == 'repeated':
+            stream.write(self.getIndent() + 'size += 4;\n')
+            if fixedSize:
+                stream.write(self.getIndent() + 'size += %d * %s.size();\n' % (fixedSize, field.name))
+            else:
+                expression = self.getVariableSizeExpression(field.typeid.name, 'element')
+                if expression:
+                    stream.write(self.getIndent() + 'for (const auto& element : %s) {\n' % field.name)
+                    self.indent()
+                    stream.write(self.getIndent() + 'size += %s;\n' % expression)
+                    self.unIndent()
+                    stream.write(self.getIndent() + '}\n')
+        else:
+            if fixedSize:
+                expression = str(fixedSize)
+            else:
+                expression = self.getVariableSizeExpression(field.typeid.name, field.name)
+            if expression:
+                stream.write(self.getIndent() + 'size += %s;\n' % expression)
+
     def writeSerializeFieldStatement(self, stream, field):
+        bulkSuffix = self.getBulkMethodSuffix(field)
+        if bulkSuffix:
+            stream.write(self.getIndent())
+            stream.write('uint32_t ' + field.name + 'Size = '
+                         + field.name + '.size();\n')
+            stream.write(self.getIndent())
+            stream.write('msgBuffer.write_uint32(' + field.name
+                         + 'Size);\n')
+            stream.write(self.getIndent())
+            stream.write('msgBuffer.write_' + bulkSuffix + '(' + field.name
+                         + '.data(), ' + field.name + 'Size);\n')
+            return
+
         indexField = ''
         if field.qualifier == 'optional':
             stream.write(self.getIndent())
@@ -679,7 +820,7 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                             stream.write(self.getIndent() + 'msgBuffer.'+ self.getSerializeMethodName('uint32'))
                             stream.write('('+field.name + indexField + '.size()' +');\n')
                             stream.write(self.getIndent() + 'msgBuffer.'+ self.getSerializeMethodName(repLine.representation)+'s')
-                            stream.write('(&('+field.name + indexField +'[0]),')
+                            stream.write('(' + field.name + indexField + '.data(), ')
                             stream.write(field.name + indexField + '.size()' +');\n')
                 # we can not handle this native case: no representation given
                 else:
@@ -752,10 +893,25 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
             stream.write(' << std::endl;\n')
 
     def writeDeSerializeFieldStatement(self, stream, field):
+        bulkSuffix = self.getBulkMethodSuffix(field)
+        if bulkSuffix:
+            stream.write(self.getIndent())
+            stream.write('uint32_t ' + field.name
+                         + 'Size = msgBuffer.read_uint32();\n')
+            stream.write(self.getIndent())
+            stream.write(field.name + '.resize(' + field.name
+                         + 'Size);\n')
+            stream.write(self.getIndent())
+            stream.write('msgBuffer.read_' + bulkSuffix + '(' + field.name
+                         + '.data(), ' + field.name + 'Size);\n')
+            return
+
         indexField = ''
         if field.qualifier == 'optional':
+            # an optional field appended to a message is simply
+            # missing from the messages sent by older peers
             stream.write(self.getIndent())
-            stream.write('_has%s = msgBuffer.read_bool();\n'
+            stream.write('_has%s = !msgBuffer.endOfBuffer() && msgBuffer.read_bool();\n'
                          % self.upperFirst(field.name))
             stream.write(self.getIndent())
             stream.write('if (_has%s) {\n'
@@ -808,7 +964,7 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                                          + self.getDeSerializeMethodName('uint32')+'()'
                                          + ');\n')
                             stream.write(self.getIndent() + 'msgBuffer.' + self.getDeSerializeMethodName(repLine.representation)+'s')
-                            stream.write('(&('+field.name + indexField +'[0]),')
+                            stream.write('(' + field.name + indexField + '.data(), ')
                             stream.write(field.name + indexField + '.size()' +');\n')
                 # we can not handle this native case: no representation given
                 else:
@@ -901,6 +1057,8 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
         receiver = (self.AST.factory.receiver[0],
                     self.AST.factory.name) \
             + self.AST.factory.receiver[1:]
+
+        # receive with a buffer of the calling thread
         stream.write(self.getIndent() + '%s* %s::%s(%s stream) throw ('
                      % receiver)
         stream.write('%s' % self.exception[0])
@@ -910,27 +1068,39 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
 
         self.indent()
         stream.write(self.getIndent() + self.commentLineBeginWith
-                     + ' FIXME This is not thread safe\n')
-        stream.write(self.getIndent() + 'static %s msgBuffer;\n'
+                     + ' one buffer per thread: links may be read concurrently\n')
+        stream.write(self.getIndent() + 'static thread_local %s msgBuffer;\n'
                      % self.serializeBufferType)
-        stream.write(self.getIndent() + '%s  msgGen;\n' % receiver[0])
-        stream.write(self.getIndent() + '''%s* msg;
+        stream.write(self.getIndent() + 'return %s::%s(stream, msgBuffer);\n'
+                     % (receiver[1], receiver[2]))
+        self.unIndent()
+        stream.write(self.getIndent() + '''} /* end of %s::%s */
 
-''' % receiver[0])
-        stream.write(self.getIndent() + self.commentLineBeginWith
-                     + ' receive generic message \n')
-        stream.write(self.getIndent()
-                     + 'msgGen.receive(stream,msgBuffer);\n')
-        stream.write(self.getIndent() + self.commentLineBeginWith
-                     + ' create specific message from type \n')
+'''
+                     % (receiver[1], receiver[2]))
 
-        stream.write(self.getIndent() + 'msg = ')
-        stream.write(self.AST.factory.name + '::'
-                     + self.AST.factory.creator[1] + '(msgGen.%s);\n'
-                     % self.messageTypeGetter)
+        # receive with a buffer of the caller
+        stream.write(self.getIndent() + '%s* %s::%s(%s stream, %s& msgBuffer) throw ('
+                     % (receiver + (self.serializeBufferType, )))
+        stream.write('%s' % self.exception[0])
+        for exception in self.exception[1:]:
+            stream.write(' ,%s' % exception)
+        stream.write(') { \n')
 
-        stream.write(self.getIndent()
-                     + 'msgBuffer.assumeSizeFromReservedBytes();\n')
+        self.indent()
+        stream.write(self.getIndent() + self.commentLineBeginWith
+                     + ' receive the whole message \n')
+        stream.write(self.getIndent() + '%s::receiveBuffer(stream, msgBuffer);\n'
+                     % receiver[0])
+        stream.write(self.getIndent() + self.commentLineBeginWith
+                     + ' peek the type (first field after the header) \n')
+        stream.write(self.getIndent() + '%s* msg = %s::%s(static_cast<%s>(msgBuffer.read_int32()));\n'
+                     % (receiver[0], self.AST.factory.name,
+                        self.AST.factory.creator[1],
+                        self.AST.factory.creator[2]))
+        stream.write(self.getIndent() + self.commentLineBeginWith
+                     + ' and deserialize once into the specific message \n')
+        stream.write(self.getIndent() + 'msgBuffer.rewind();\n')
         stream.write(self.getIndent() + 'msg->deserialize(msgBuffer);\n'
                      )
         stream.write(self.getIndent() + 'return msg;\n')
@@ -1008,10 +1178,23 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                         stream.write(self.getIndent() + self.commentLineBeginWith + ' Call parent class\n')
                         stream.write(self.getIndent() + 'Super::serialize(msgBuffer);\n')
                     stream.write(self.getIndent() + self.commentLineBeginWith + ' Specific serialization code\n')
-                    self.applyToFields(stream, msg.fields, self.writeSerializeFieldStatement)
+                    for field in msg.fields:
+                        if isinstance(field, GenMsgAST.MessageType.CombinedField):
+                            stream.write(self.getIndent() + 'serialize%s(msgBuffer);\n' % field.typeid.name)
+                        else:
+                            self.writeSerializeFieldStatement(stream, field)
                     self.unIndent()
                     stream.write(self.getIndent() + '}\n\n')
 
+                    for field in msg.fields:
+                        if isinstance(field, GenMsgAST.MessageType.CombinedField):
+                            stream.write(self.getIndent() + 'void %s::serialize%s(%s& msgBuffer)\n' % (msg.name, field.typeid.name, self.serializeBufferType))
+                            stream.write('{\n')
+                            self.indent()
+                            self.applyToFields(stream, field.fields, self.writeSerializeFieldStatement)
+                            self.unIndent()
+                            stream.write(self.getIndent() + '}\n\n')
+
                     # end serialize method
 
                     # begin deserialize method
@@ -1028,6 +1211,39 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                     stream.write(self.getIndent() + '}\n\n')
 
                     # end deserialize method
+
+                    # begin serializedSize method
+
+                    stream.write(self.getIndent() + 'uint32_t %s::serializedSize() const\n' % msg.name)
+                    stream.write('{\n')
+                    self.indent()
+                    if msg.hasMerge():
+                        stream.write(self.getIndent() + self.commentLineBeginWith + ' Call parent class\n')
+                        stream.write(self.getIndent() + 'uint32_t size = Super::serializedSize();\n')
+                    else:
+                        stream.write(self.getIndent() + 'uint32_t size = 0;\n')
+                    stream.write(self.getIndent() + self.commentLineBeginWith + ' Specific fields\n')
+                    for field in msg.fields:
+                        if isinstance(field, GenMsgAST.MessageType.CombinedField):
+                            stream.write(self.getIndent() + 'size += serialized%sSize();\n' % field.typeid.name)
+                        else:
+                            self.writeSerializedSizeFieldStatement(stream, field)
+                    stream.write(self.getIndent() + 'return size;\n')
+                    self.unIndent()
+                    stream.write(self.getIndent() + '}\n\n')
+
+                    for field in msg.fields:
+                        if isinstance(field, GenMsgAST.MessageType.CombinedField):
+                            stream.write(self.getIndent() + 'uint32_t %s::serialized%sSize() const\n' % (msg.name, field.typeid.name))
+                            stream.write('{\n')
+                            self.indent()
+                            stream.write(self.getIndent() + 'uint32_t size = 0;\n')
+                            self.applyToFields(stream, field.fields, self.writeSerializedSizeFieldStatement)
+                            stream.write(self.getIndent() + 'return size;\n')
+                            self.unIndent()
+                            stream.write(self.getIndent() + '}\n\n')
+
+                    # end serializedSize method
                     
                     # begin getters and setters
                     
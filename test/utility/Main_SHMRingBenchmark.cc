@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+// ----------------------------------------------------------------------------
+
+// Round trip latency of the federate/RTIA link: plain Unix socket versus
+// shared memory rings (SocketSHMRing). A child process echoes every message,
+// as the RTIA answers every federate request.
+//
+// Usage: CertiSHMRingBenchmark [round_trips [message_size ...]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <libCERTI/SocketSHMRing.hh>
+
+using certi::SocketSHMRing;
+using certi::SocketUN;
+
+namespace {
+
+void echo(SocketUN& socket, size_t size, int round_trips)
+{
+    std::vector<unsigned char> buffer(size);
+    for (int i = 0; i < round_trips; ++i) {
+        socket.receive(buffer.data(), size);
+        socket.send(buffer.data(), size);
+    }
+}
+
+/// @return mean round trip in microseconds
+double ping(SocketUN& socket, size_t size, int round_trips)
+{
+    std::vector<unsigned char> buffer(size, 0x5a);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < round_trips; ++i) {
+        socket.send(buffer.data(), size);
+        socket.receive(buffer.data(), size);
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count() / round_trips;
+}
+
+double measure(bool use_rings, size_t size, int round_trips)
+{
+    SocketSHMRing socket(certi::stIgnoreSignal);
+    int peer_fd = socket.socketpair();
+    std::string name;
+    if (use_rings) {
+        name = socket.create();
+    }
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        exit(EXIT_FAILURE);
+    }
+
+    if (pid == 0) {
+        // child: plays the RTIA
+        SocketSHMRing peer(certi::stIgnoreSignal);
+        peer.setSocketFD(peer_fd);
+        if (use_rings) {
+            // same handshake as OPEN_CONNEXION: attach, answer on the socket, activate
+            unsigned char ready = 1;
+            peer.attach(name);
+            peer.send(&ready, 1);
+            peer.activate();
+        }
+        echo(peer, size, round_trips + 1);
+        _exit(EXIT_SUCCESS);
+    }
+
+    close(peer_fd);
+    if (use_rings) {
+        unsigned char ready;
+        socket.receive(&ready, 1);
+        socket.activate();
+    }
+
+    // warm up (page faults, first doorbells)
+    ping(socket, size, 1);
+    double latency = ping(socket, size, round_trips);
+
+    waitpid(pid, nullptr, 0);
+    return latency;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    int round_trips = 100000;
+    std::vector<size_t> sizes;
+
+    if (argc > 1) {
+        round_trips = atoi(argv[1]);
+    }
+    for (int i = 2; i < argc; ++i) {
+        sizes.push_back(strtoul(argv[i], nullptr, 10));
+    }
+    if (sizes.empty()) {
+        sizes = {16, 256, 4096, 65536};
+    }
+
+    std::cout << round_trips << " round trips per message size" << std::endl;
+    std::cout << std::setw(10) << "size" << std::setw(16) << "SocketUN (us)" << std::setw(16) << "SHM ring (us)"
+              << std::setw(10) << "speedup" << std::endl;
+
+    for (auto size : sizes) {
+        double socket_latency = measure(false, size, round_trips);
+        double ring_latency = measure(true, size, round_trips);
+
+        std::cout << std::setw(10) << size << std::fixed << std::setprecision(3) << std::setw(16) << socket_latency
+                  << std::setw(16) << ring_latency << std::setprecision(2) << std::setw(10)
+                  << socket_latency / ring_latency << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,201 @@
+#include "benchmark.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include <config.h>
+#include <libHLA/ByteSwap.hh>
+#include <libHLA/MessageBuffer.hh>
+
+#ifndef CERTI_BENCHMARK_BUILD_TYPE
+#define CERTI_BENCHMARK_BUILD_TYPE ""
+#endif
+
+namespace benchmark {
+
+namespace {
+double measure(const Case& measured, uint64_t iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    measured.run(iterations);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+std::string escape(const std::string& text)
+{
+    std::string result;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+
+const char* compiler()
+{
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#else
+    return "unknown";
+#endif
+}
+}
+
+void Suite::add(const std::string& group, const std::string& name, uint64_t bytes, std::function<void(uint64_t)> run)
+{
+    my_cases.push_back(Case{group, name, bytes, std::move(run)});
+}
+
+std::vector<Result> Suite::run(const Options& options, std::ostream& progress) const
+{
+    std::vector<Result> results;
+
+    for (const auto& measured : my_cases) {
+        const std::string fullName = measured.group + "/" + measured.name;
+        if (fullName.find(options.filter) == std::string::npos) {
+            continue;
+        }
+
+        uint64_t iterations = 1;
+        while (measure(measured, iterations) < options.sampleSeconds && iterations < (uint64_t(1) << 40)) {
+            iterations *= 2;
+        }
+
+        Result result{&measured, iterations, {}, 0, 0, 0};
+        measure(measured, iterations); // warmup
+        for (int i = 0; i < options.samples; ++i) {
+            result.samples.push_back(measure(measured, iterations) * 1e9 / iterations);
+        }
+
+        std::vector<double> sorted = result.samples;
+        std::sort(sorted.begin(), sorted.end());
+        result.median = sorted[sorted.size() / 2];
+        result.minimum = sorted.front();
+        result.maximum = sorted.back();
+
+        progress << std::left << std::setw(60) << fullName << std::right << std::setw(14) << std::fixed
+                 << std::setprecision(1) << result.median << " ns/op";
+        if (measured.bytes) {
+            progress << std::setw(12) << measured.bytes * 1e3 / result.median << " MB/s";
+        }
+        progress << std::endl;
+
+        results.push_back(result);
+    }
+
+    return results;
+}
+
+void Suite::writeJson(std::ostream& out, const Options& options, const std::vector<Result>& results)
+{
+    out << std::setprecision(6) << std::fixed;
+    out << "{\n";
+    out << "  \"suite\": \"certi\",\n";
+    out << "  \"version\": \"" << VERSION << "\",\n";
+    out << "  \"build_type\": \"" << escape(CERTI_BENCHMARK_BUILD_TYPE) << "\",\n";
+    out << "  \"compiler\": \"" << escape(compiler()) << "\",\n";
+    out << "  \"host_endianness\": \"" << (libhla::MessageBuffer::HostIsBigEndian() ? "big" : "little") << "\",\n";
+    out << "  \"byte_swap_kernel\": \"" << libhla::ByteSwap::kernel() << "\",\n";
+    out << "  \"samples\": " << options.samples << ",\n";
+    out << "  \"sample_seconds\": " << options.sampleSeconds << ",\n";
+    out << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& result = results[i];
+        out << (i ? ",\n" : "\n");
+        out << "    {\"group\": \"" << escape(result.measured->group) << "\", ";
+        out << "\"name\": \"" << escape(result.measured->name) << "\", ";
+        out << "\"bytes\": " << result.measured->bytes << ", ";
+        out << "\"iterations\": " << result.iterations << ", ";
+        out << "\"ns_per_op\": " << result.median << ", ";
+        out << "\"ns_per_op_min\": " << result.minimum << ", ";
+        out << "\"ns_per_op_max\": " << result.maximum << ", ";
+        out << "\"mb_per_s\": " << (result.measured->bytes ? result.measured->bytes * 1e3 / result.median : 0.0)
+            << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+const std::vector<uint32_t>& payloadSizes()
+{
+    static const std::vector<uint32_t> sizes = {16, 1024, 64 * 1024};
+    return sizes;
+}
+
+std::string sizeName(uint32_t bytes)
+{
+    if (bytes >= 1024 && bytes % 1024 == 0) {
+        return std::to_string(bytes / 1024) + "KiB";
+    }
+    return std::to_string(bytes) + "B";
+}
+
+} // namespace benchmark
+
+namespace {
+void usage(const char* program)
+{
+    std::cerr << "Usage: " << program << " [--quick] [--filter=TEXT] [--samples=N] [--json=FILE]\n"
+              << "  --quick        few short samples, only checks that every case runs\n"
+              << "  --filter=TEXT  only run the cases whose group/name contains TEXT\n"
+              << "  --samples=N    samples per case, the median is reported (default 11)\n"
+              << "  --json=FILE    write the JSON report to FILE instead of the standard output" << std::endl;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--quick") {
+            options.samples = 3;
+            options.sampleSeconds = 0.001;
+        }
+        else if (arg.compare(0, 9, "--filter=") == 0) {
+            options.filter = arg.substr(9);
+        }
+        else if (arg.compare(0, 10, "--samples=") == 0) {
+            options.samples = std::max(1, std::atoi(arg.c_str() + 10));
+        }
+        else if (arg.compare(0, 7, "--json=") == 0) {
+            options.json = arg.substr(7);
+        }
+        else {
+            usage(argv[0]);
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    benchmark::Suite suite;
+    benchmark::registerMessageBufferBenchmarks(suite);
+    benchmark::registerHLAtypesBenchmarks(suite);
+    benchmark::registerMessagesBenchmarks(suite);
+
+    // the readable table goes to stderr when the report goes to stdout
+    std::ostream& progress = options.json.empty() ? std::cerr : std::cout;
+    const auto results = suite.run(options, progress);
+
+    if (options.json.empty()) {
+        benchmark::Suite::writeJson(std::cout, options, results);
+    }
+    else {
+        std::ofstream report(options.json);
+        if (!report) {
+            std::cerr << "Cannot write <" << options.json << ">" << std::endl;
+            return 1;
+        }
+        benchmark::Suite::writeJson(report, options, results);
+    }
+
+    return results.empty() ? 1 : 0;
+}
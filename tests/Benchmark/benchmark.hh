@@ -0,0 +1,88 @@
+#ifndef CERTI_TESTS_BENCHMARK_HH
+#define CERTI_TESTS_BENCHMARK_HH
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/// Keep the compiler from optimizing a result away.
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * One measured operation.
+ * run(n) performs the operation n times; bytes is the payload handled
+ * by one operation (0 if a throughput makes no sense).
+ */
+struct Case {
+    std::string group;
+    std::string name;
+    uint64_t bytes;
+    std::function<void(uint64_t)> run;
+};
+
+/// Result of one case, times are per operation.
+struct Result {
+    const Case* measured;
+    uint64_t iterations;
+    std::vector<double> samples;
+    double median;
+    double minimum;
+    double maximum;
+};
+
+struct Options {
+    /// only run the cases whose "group/name" contains filter
+    std::string filter;
+    /// samples taken per case, the median is reported
+    int samples{11};
+    /// the iteration count is doubled until a sample lasts this long
+    double sampleSeconds{0.02};
+    /// where to write the JSON report, standard output if empty
+    std::string json;
+};
+
+/**
+ * Runs the cases one after the other: the iteration count is calibrated
+ * first, then one warmup sample is discarded and the median of the next
+ * samples is reported, which is much less sensitive to the machine load
+ * than the mean.
+ */
+class Suite {
+public:
+    void add(const std::string& group, const std::string& name, uint64_t bytes, std::function<void(uint64_t)> run);
+
+    std::vector<Result> run(const Options& options, std::ostream& progress) const;
+
+    /// Report in a JSON document meant to be compared across CERTI versions.
+    static void writeJson(std::ostream& out, const Options& options, const std::vector<Result>& results);
+
+private:
+    std::vector<Case> my_cases;
+};
+
+/// Payload sizes, in bytes, at which size dependent cases are measured.
+const std::vector<uint32_t>& payloadSizes();
+
+/// Readable payload size: "16B", "1KiB", "64KiB".
+std::string sizeName(uint32_t bytes);
+
+void registerMessageBufferBenchmarks(Suite& suite);
+void registerHLAtypesBenchmarks(Suite& suite);
+void registerMessagesBenchmarks(Suite& suite);
+
+} // namespace benchmark
+
+#endif // CERTI_TESTS_BENCHMARK_HH
@@ -0,0 +1,200 @@
+#include "benchmark.hh"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include <libHLA/HLAtypesIEEE1516.hh>
+
+using namespace libhla;
+
+namespace benchmark {
+
+namespace {
+enum { id, kind, x, y, z, psi, theta, phi, appearance };
+
+//! Typical entity state: the fields have different sizes, some are padded.
+// clang-format off
+using Entity = HLAfixedRecord<HLAfixedField<id, HLAinteger32BE,
+                              HLAfixedField<kind, HLAoctet,
+                              HLAfixedField<x, HLAfloat64BE,
+                              HLAfixedField<y, HLAfloat64BE,
+                              HLAfixedField<z, HLAfloat64BE,
+                              HLAfixedField<psi, HLAfloat32BE,
+                              HLAfixedField<theta, HLAfloat32BE,
+                              HLAfixedField<phi, HLAfloat32BE,
+                              HLAfixedField<appearance, HLAinteger16BE>>>>>>>>>>;
+// clang-format on
+
+using Entities = HLAvariableArray<Entity>;
+using Samples = HLAvariableArray<HLAfloat64BE>;
+
+void set(Entity& entity, int i)
+{
+    entity.field<id>() = i;
+    entity.field<kind>() = 3;
+    entity.field<x>() = i * 1.5;
+    entity.field<y>() = i * 2.5;
+    entity.field<z>() = i * 3.5;
+    entity.field<psi>() = 0.25f;
+    entity.field<theta>() = 0.5f;
+    entity.field<phi>() = 0.75f;
+    entity.field<appearance>() = 7;
+}
+
+double get(const Entity& entity)
+{
+    return entity.field<id>() + entity.field<kind>() + entity.field<x>() + entity.field<y>() + entity.field<z>()
+        + entity.field<psi>() + entity.field<theta>() + entity.field<phi>() + entity.field<appearance>();
+}
+
+/// The encoded bytes of value, as received from the network.
+template <class T>
+std::shared_ptr<std::vector<char>> received(const HLAdata<T>& value)
+{
+    return std::make_shared<std::vector<char>>(value.data(), value.data() + value.size());
+}
+
+void addFixedRecord(Suite& suite)
+{
+    suite.add("HLAtypes", "HLAfixedRecord encode", Entity::__sizeof(), [](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            HLAdata<Entity> entity;
+            set(*entity, i);
+            doNotOptimize(entity.data()[0]);
+        }
+    });
+
+    HLAdata<Entity> entity;
+    set(*entity, 1);
+    auto bytes = received(entity);
+    suite.add("HLAtypes", "HLAfixedRecord decode", Entity::__sizeof(), [bytes](uint64_t n) {
+        double sum = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            HLAdata<Entity> entity(bytes->data(), bytes->size());
+            sum += get(*entity);
+        }
+        doNotOptimize(sum);
+    });
+}
+
+//! Record of <N> HLAfloat64BE fields, like a large entity state
+template <int I, int N>
+struct ManyFields {
+    typedef HLAfixedField<I, HLAfloat64BE, typename ManyFields<I + 1, N>::Type> Type;
+};
+
+template <int N>
+struct ManyFields<N, N> {
+    typedef HLAfixedEnd Type;
+};
+
+constexpr int largeFieldCount = 200;
+using LargeEntity = HLAfixedRecord<ManyFields<0, largeFieldCount>::Type>;
+
+template <int... I>
+void set(LargeEntity& entity, double value, std::integer_sequence<int, I...>)
+{
+    int expand[] = {((entity.field<I>() = value + I), 0)...};
+    (void) expand;
+}
+
+template <int... I>
+double get(const LargeEntity& entity, std::integer_sequence<int, I...>)
+{
+    double sum = 0;
+    int expand[] = {((sum += entity.field<I>()), 0)...};
+    (void) expand;
+    return sum;
+}
+
+void addLargeFixedRecord(Suite& suite)
+{
+    // every field at a compile-time offset, in the same buffer
+    suite.add("HLAtypes", "HLAfixedRecord x200 encode+decode", LargeEntity::__sizeof(), [](uint64_t n) {
+        HLAdata<LargeEntity> entity;
+        double sum = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            set(*entity, i, std::make_integer_sequence<int, largeFieldCount>());
+            sum += get(*entity, std::make_integer_sequence<int, largeFieldCount>());
+        }
+        doNotOptimize(sum);
+    });
+}
+
+void addVariableArrays(Suite& suite, uint32_t size)
+{
+    const std::string suffix = " " + sizeName(size);
+
+    const long count = std::max<long>(size / 8, 1);
+    suite.add("HLAtypes", "HLAvariableArray<HLAfloat64BE> encode" + suffix, count * 8, [count](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            HLAdata<Samples> samples;
+            (*samples).set_size(count);
+            for (long j = 0; j < count; ++j) {
+                (*samples)[j] = j * 0.5;
+            }
+            doNotOptimize(samples.data()[0]);
+        }
+    });
+
+    HLAdata<Samples> samples;
+    (*samples).set_size(count);
+    for (long j = 0; j < count; ++j) {
+        (*samples)[j] = j * 0.5;
+    }
+    auto sampleBytes = received(samples);
+    suite.add("HLAtypes", "HLAvariableArray<HLAfloat64BE> decode" + suffix, count * 8, [=](uint64_t n) {
+        double sum = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            HLAdata<Samples> samples(sampleBytes->data(), sampleBytes->size());
+            for (long j = 0; j < count; ++j) {
+                sum += (*samples)[j];
+            }
+        }
+        doNotOptimize(sum);
+    });
+
+    const long entityCount = std::max<long>(size / Entity::__sizeof(), 1);
+    HLAdata<Entities> entities;
+    (*entities).set_size(entityCount);
+    for (long j = 0; j < entityCount; ++j) {
+        set((*entities)[j], j);
+    }
+    const uint64_t entitiesSize = entities.size();
+
+    suite.add("HLAtypes", "HLAvariableArray<HLAfixedRecord> encode" + suffix, entitiesSize, [entityCount](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            HLAdata<Entities> entities;
+            (*entities).set_size(entityCount);
+            for (long j = 0; j < entityCount; ++j) {
+                set((*entities)[j], j);
+            }
+            doNotOptimize(entities.data()[0]);
+        }
+    });
+
+    auto entityBytes = received(entities);
+    suite.add("HLAtypes", "HLAvariableArray<HLAfixedRecord> decode" + suffix, entitiesSize, [=](uint64_t n) {
+        double sum = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            HLAdata<Entities> entities(entityBytes->data(), entityBytes->size());
+            for (long j = 0; j < entityCount; ++j) {
+                sum += get((*entities)[j]);
+            }
+        }
+        doNotOptimize(sum);
+    });
+}
+}
+
+void registerHLAtypesBenchmarks(Suite& suite)
+{
+    addFixedRecord(suite);
+    addLargeFixedRecord(suite);
+    for (uint32_t size : payloadSizes()) {
+        addVariableArrays(suite, size);
+    }
+}
+
+} // namespace benchmark
@@ -0,0 +1,228 @@
+#include "benchmark.hh"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+
+#include <libHLA/MessageBuffer.hh>
+
+using ::libhla::MessageBuffer;
+
+namespace benchmark {
+
+namespace {
+/// Scalars written or read one by one per operation.
+static constexpr uint32_t scalarCount = 256;
+
+void assumeOtherEndianness(MessageBuffer& buffer)
+{
+    if (MessageBuffer::HostIsLittleEndian()) {
+        buffer.assumeBufferIsBigEndian();
+    }
+    else {
+        buffer.assumeBufferIsLittleEndian();
+    }
+}
+
+/// Handles as found in attribute lists: small and sorted.
+std::vector<uint32_t> handles(uint32_t n)
+{
+    std::vector<uint32_t> values(n);
+    std::iota(values.begin(), values.end(), 1);
+    return values;
+}
+
+void addScalars(Suite& suite)
+{
+    auto buffer = std::make_shared<MessageBuffer>();
+
+    suite.add("MessageBuffer", "write_uint32 x256", scalarCount * 4, [buffer](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            buffer->reset();
+            for (uint32_t v = 0; v < scalarCount; ++v) {
+                buffer->write_uint32(v);
+            }
+        }
+        doNotOptimize(*buffer);
+    });
+
+    suite.add("MessageBuffer", "read_uint32 x256", scalarCount * 4, [buffer](uint64_t n) {
+        buffer->reset();
+        for (uint32_t v = 0; v < scalarCount; ++v) {
+            buffer->write_uint32(v);
+        }
+        uint32_t sum = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            buffer->rewind();
+            for (uint32_t v = 0; v < scalarCount; ++v) {
+                sum += buffer->read_uint32();
+            }
+        }
+        doNotOptimize(sum);
+    });
+
+    suite.add("MessageBuffer", "write_double x256", scalarCount * 8, [buffer](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            buffer->reset();
+            for (uint32_t v = 0; v < scalarCount; ++v) {
+                buffer->write_double(v * 0.5);
+            }
+        }
+        doNotOptimize(*buffer);
+    });
+
+    suite.add("MessageBuffer", "read_double x256", scalarCount * 8, [buffer](uint64_t n) {
+        buffer->reset();
+        for (uint32_t v = 0; v < scalarCount; ++v) {
+            buffer->write_double(v * 0.5);
+        }
+        double sum = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            buffer->rewind();
+            for (uint32_t v = 0; v < scalarCount; ++v) {
+                sum += buffer->read_double();
+            }
+        }
+        doNotOptimize(sum);
+    });
+
+    suite.add("MessageBuffer", "write_uint32 x256 compact", scalarCount * 4, [buffer](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            buffer->reset();
+            buffer->setCompact(true);
+            for (uint32_t v = 0; v < scalarCount; ++v) {
+                buffer->write_uint32(v);
+            }
+        }
+        doNotOptimize(*buffer);
+    });
+
+    suite.add("MessageBuffer", "read_uint32 x256 compact", scalarCount * 4, [buffer](uint64_t n) {
+        buffer->reset();
+        buffer->setCompact(true);
+        for (uint32_t v = 0; v < scalarCount; ++v) {
+            buffer->write_uint32(v);
+        }
+        uint32_t sum = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            buffer->rewind();
+            for (uint32_t v = 0; v < scalarCount; ++v) {
+                sum += buffer->read_uint32();
+            }
+        }
+        doNotOptimize(sum);
+    });
+}
+
+void addArrays(Suite& suite, uint32_t size)
+{
+    auto buffer = std::make_shared<MessageBuffer>();
+    const std::string suffix = " " + sizeName(size);
+
+    auto bytes = std::make_shared<std::vector<uint8_t>>(size, 0x5a);
+    suite.add("MessageBuffer", "write_uint8s" + suffix, size, [buffer, bytes](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            buffer->reset();
+            buffer->write_uint8s(bytes->data(), bytes->size());
+        }
+        doNotOptimize(*buffer);
+    });
+
+    suite.add("MessageBuffer", "read_uint8s" + suffix, size, [buffer, bytes](uint64_t n) {
+        buffer->reset();
+        buffer->write_uint8s(bytes->data(), bytes->size());
+        std::vector<uint8_t> out(bytes->size());
+        for (uint64_t i = 0; i < n; ++i) {
+            buffer->rewind();
+            buffer->read_uint8s(out.data(), out.size());
+        }
+        doNotOptimize(out);
+    });
+
+    auto doubles = std::make_shared<std::vector<double>>(std::max<uint32_t>(size / 8, 1), 1.5);
+    for (const bool swapped : {false, true}) {
+        const std::string mode = swapped ? " swapped" : "";
+
+        suite.add("MessageBuffer", "write_doubles" + suffix + mode, doubles->size() * 8, [=](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                buffer->reset();
+                if (swapped) {
+                    assumeOtherEndianness(*buffer);
+                }
+                buffer->write_doubles(doubles->data(), doubles->size());
+            }
+            doNotOptimize(*buffer);
+        });
+
+        suite.add("MessageBuffer", "read_doubles" + suffix + mode, doubles->size() * 8, [=](uint64_t n) {
+            buffer->reset();
+            if (swapped) {
+                assumeOtherEndianness(*buffer);
+            }
+            buffer->write_doubles(doubles->data(), doubles->size());
+            std::vector<double> out(doubles->size());
+            for (uint64_t i = 0; i < n; ++i) {
+                buffer->rewind();
+                buffer->read_doubles(out.data(), out.size());
+            }
+            doNotOptimize(out);
+        });
+    }
+
+    auto ids = std::make_shared<std::vector<uint32_t>>(handles(std::max<uint32_t>(size / 4, 1)));
+    for (const bool compact : {false, true}) {
+        const std::string mode = compact ? " compact" : "";
+
+        suite.add("MessageBuffer", "write_uint32s" + suffix + mode, ids->size() * 4, [=](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                buffer->reset();
+                buffer->setCompact(compact);
+                buffer->write_uint32s(ids->data(), ids->size());
+            }
+            doNotOptimize(*buffer);
+        });
+
+        suite.add("MessageBuffer", "read_uint32s" + suffix + mode, ids->size() * 4, [=](uint64_t n) {
+            buffer->reset();
+            buffer->setCompact(compact);
+            buffer->write_uint32s(ids->data(), ids->size());
+            std::vector<uint32_t> out(ids->size());
+            for (uint64_t i = 0; i < n; ++i) {
+                buffer->rewind();
+                buffer->read_uint32s(out.data(), out.size());
+            }
+            doNotOptimize(out);
+        });
+    }
+
+    auto text = std::make_shared<std::string>(size, 'h');
+    suite.add("MessageBuffer", "write_string" + suffix, size, [buffer, text](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            buffer->reset();
+            buffer->write_string(*text);
+        }
+        doNotOptimize(*buffer);
+    });
+
+    suite.add("MessageBuffer", "read_string" + suffix, size, [buffer, text](uint64_t n) {
+        buffer->reset();
+        buffer->write_string(*text);
+        std::string out;
+        for (uint64_t i = 0; i < n; ++i) {
+            buffer->rewind();
+            buffer->read_string(out);
+        }
+        doNotOptimize(out);
+    });
+}
+}
+
+void registerMessageBufferBenchmarks(Suite& suite)
+{
+    addScalars(suite);
+    for (uint32_t size : payloadSizes()) {
+        addArrays(suite, size);
+    }
+}
+
+} // namespace benchmark
@@ -0,0 +1,152 @@
+#include "benchmark.hh"
+
+#include <memory>
+
+#include <libCERTI/M_Classes.hh>
+#include <libCERTI/NM_Classes.hh>
+#include <libHLA/MessageBuffer.hh>
+
+using ::libhla::MessageBuffer;
+
+namespace benchmark {
+
+namespace {
+/// Attributes or parameters per message, the payload is spread among them.
+static constexpr uint32_t handleCount = 8;
+
+/// Attributes of the updates made of many small values, where the handles weigh as much as the values.
+static constexpr uint32_t manyHandleCount = 64;
+
+template <typename M, uint32_t count = handleCount>
+void fillAttributes(M& msg, uint32_t payload)
+{
+    msg.setObject(42);
+    msg.setAttributesSize(count);
+    msg.setValuesSize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        msg.setAttributes(i + 1, i);
+        msg.setValues(certi::AttributeValue_t(payload / count, static_cast<char>(i)), i);
+    }
+}
+
+template <typename M>
+void fillParameters(M& msg, uint32_t payload)
+{
+    msg.setInteractionClass(7);
+    msg.setParametersSize(handleCount);
+    msg.setValuesSize(handleCount);
+    for (uint32_t i = 0; i < handleCount; ++i) {
+        msg.setParameters(i + 1, i);
+        msg.setValues(certi::ParameterValue_t(payload / handleCount, static_cast<char>(i)), i);
+    }
+}
+
+/// Same steps as Message::send, without the socket.
+void serializeFrame(certi::Message& msg, MessageBuffer& buffer)
+{
+    buffer.reset();
+    buffer.resize(buffer.reservedBytes + msg.serializedSize());
+    msg.serialize(buffer);
+    buffer.updateReservedBytes();
+}
+
+void serializeFrame(certi::NetworkMessage& msg, MessageBuffer& buffer, bool compact)
+{
+    msg.serializeFrame(buffer, compact);
+}
+
+/// Federate/RTIA messages (M_*).
+template <typename M>
+void addMessage(Suite& suite, const std::string& name, uint32_t payload, void (*fill)(M&, uint32_t))
+{
+    const std::string suffix = " " + sizeName(payload);
+    auto sent = std::make_shared<M>();
+    fill(*sent, payload);
+    auto buffer = std::make_shared<MessageBuffer>();
+
+    suite.add("Messages", name + " serialize" + suffix, payload, [sent, buffer](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            serializeFrame(*sent, *buffer);
+        }
+        doNotOptimize(*buffer);
+    });
+
+    suite.add("Messages", name + " deserialize" + suffix, payload, [sent, buffer](uint64_t n) {
+        serializeFrame(*sent, *buffer);
+        M received;
+        for (uint64_t i = 0; i < n; ++i) {
+            buffer->assumeSizeFromReservedBytes();
+            received.deserialize(*buffer);
+        }
+        doNotOptimize(received);
+    });
+}
+
+/// RTIA/RTIG messages (NM_*), in both wire formats.
+template <typename M>
+void addNetworkMessage(Suite& suite, const std::string& name, uint32_t payload, void (*fill)(M&, uint32_t))
+{
+    const std::string suffix = " " + sizeName(payload);
+    auto sent = std::make_shared<M>();
+    fill(*sent, payload);
+    auto buffer = std::make_shared<MessageBuffer>();
+
+    for (const bool compact : {false, true}) {
+        const std::string mode = compact ? " compact" : "";
+
+        suite.add("Messages", name + " serialize" + suffix + mode, payload, [=](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                serializeFrame(*sent, *buffer, compact);
+            }
+            doNotOptimize(*buffer);
+        });
+
+        suite.add("Messages", name + " deserialize" + suffix + mode, payload, [=](uint64_t n) {
+            serializeFrame(*sent, *buffer, compact);
+            M received;
+            for (uint64_t i = 0; i < n; ++i) {
+                buffer->assumeSizeFromReservedBytes();
+                received.deserialize(*buffer);
+            }
+            doNotOptimize(received);
+        });
+    }
+
+    // what NetworkMessage::send does: large values are referenced, not copied
+    suite.add("Messages", name + " serialize" + suffix + " segmented", payload, [sent, buffer](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            sent->serializeFrame(*buffer, false, true);
+        }
+        doNotOptimize(*buffer);
+    });
+}
+}
+
+void registerMessagesBenchmarks(Suite& suite)
+{
+    for (uint32_t payload : payloadSizes()) {
+        addNetworkMessage<certi::NM_Update_Attribute_Values>(
+            suite, "NM_Update_Attribute_Values", payload, fillAttributes);
+        addNetworkMessage<certi::NM_Reflect_Attribute_Values>(
+            suite, "NM_Reflect_Attribute_Values", payload, fillAttributes);
+        addNetworkMessage<certi::NM_Send_Interaction>(suite, "NM_Send_Interaction", payload, fillParameters);
+        addNetworkMessage<certi::NM_Receive_Interaction>(suite, "NM_Receive_Interaction", payload, fillParameters);
+
+        addMessage<certi::M_Update_Attribute_Values>(suite, "M_Update_Attribute_Values", payload, fillAttributes);
+        addMessage<certi::M_Reflect_Attribute_Values>(suite, "M_Reflect_Attribute_Values", payload, fillAttributes);
+        addMessage<certi::M_Send_Interaction>(suite, "M_Send_Interaction", payload, fillParameters);
+        addMessage<certi::M_Receive_Interaction>(suite, "M_Receive_Interaction", payload, fillParameters);
+    }
+
+    // 16 bytes per attribute
+    addNetworkMessage<certi::NM_Update_Attribute_Values>(suite,
+                                                         "NM_Update_Attribute_Values x64",
+                                                         manyHandleCount * 16,
+                                                         fillAttributes<certi::NM_Update_Attribute_Values, manyHandleCount>);
+    addNetworkMessage<certi::NM_Reflect_Attribute_Values>(suite,
+                                                          "NM_Reflect_Attribute_Values x64",
+                                                          manyHandleCount * 16,
+                                                          fillAttributes<certi::NM_Reflect_Attribute_Values, manyHandleCount>);
+}
+
+} // namespace benchmark
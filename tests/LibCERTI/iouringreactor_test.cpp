@@ -0,0 +1,344 @@
+#include <gtest/gtest.h>
+
+#include <csignal>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+#include <config.h>
+
+#ifdef HAVE_LINUX_IO_URING_H
+
+#include <arpa/inet.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <libCERTI/IoUringReactor.hh>
+#include <libCERTI/NM_Classes.hh>
+
+using ::certi::IoUringReactor;
+using ::certi::SocketTCP;
+
+namespace {
+/// The same tests with io_uring, and with poll() (CERTI_IO_URING=off).
+class IoUringReactorTest : public ::testing::TestWithParam<bool> {
+protected:
+    void SetUp() override
+    {
+        if (GetParam()) {
+            unsetenv("CERTI_IO_URING");
+        }
+        else {
+            setenv("CERTI_IO_URING", "off", 1);
+        }
+        reactor.reset(new IoUringReactor());
+        unsetenv("CERTI_IO_URING");
+
+        if (GetParam() && !reactor->usesIoUring()) {
+            GTEST_SKIP() << "io_uring refused by the kernel";
+        }
+
+        ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, first));
+        ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, second));
+    }
+
+    void TearDown() override
+    {
+        reactor.reset();
+        for (int fd : {first[0], first[1], second[0], second[1]}) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    static void writeByte(int fd)
+    {
+        const char byte = 0;
+        ASSERT_EQ(1, write(fd, &byte, 1));
+    }
+
+    std::unique_ptr<IoUringReactor> reactor;
+    int first[2] = {-1, -1};
+    int second[2] = {-1, -1};
+    std::vector<int> ready;
+    std::vector<SocketTCP*> lost;
+};
+
+/// A TCP server on the loopback, and a client connected to a link it accepted, as an RTIA and the RTIG.
+struct Link {
+    explicit Link(SocketTCP& server)
+    {
+        struct sockaddr_in address;
+        socklen_t length = sizeof(address);
+        getsockname(server.returnSocket(), (struct sockaddr*) &address, &length);
+        rtia.createTCPClient(ntohs(address.sin_port), htonl(INADDR_LOOPBACK));
+        rtig.accept(&server);
+    }
+
+    SocketTCP rtia;
+    SocketTCP rtig;
+};
+
+std::unique_ptr<libhla::MessageBuffer> frameOf(::certi::ObjectHandle object, size_t value_size)
+{
+    ::certi::NM_Reflect_Attribute_Values message;
+    message.setObject(object);
+    message.setAttributesSize(1);
+    message.setAttributes(1, 0);
+    message.setValuesSize(1);
+    message.setValues(::certi::AttributeValue_t(value_size, 'v'), 0);
+
+    std::unique_ptr<libhla::MessageBuffer> frame(new libhla::MessageBuffer());
+    // not segmented: the values die with the message
+    message.serializeFrame(*frame, false);
+    return frame;
+}
+
+::certi::ObjectHandle receivedObject(SocketTCP& socket)
+{
+    std::unique_ptr<::certi::NetworkMessage> received(::certi::NM_Factory::receive(&socket));
+    return static_cast<::certi::NM_Reflect_Attribute_Values*>(received.get())->getObject();
+}
+}
+
+TEST_P(IoUringReactorTest, ReadableSocketsAreReported)
+{
+    reactor->watch(first[0]);
+    reactor->watch(second[0]);
+
+    writeByte(second[1]);
+    ASSERT_EQ(1, reactor->wait(ready));
+    ASSERT_EQ(std::vector<int>{second[0]}, ready);
+}
+
+TEST_P(IoUringReactorTest, ASocketIsReportedUntilItIsRead)
+{
+    reactor->watch(first[0]);
+    writeByte(first[1]);
+
+    ASSERT_EQ(1, reactor->wait(ready));
+    ASSERT_EQ(1, reactor->wait(ready));
+
+    char byte;
+    ASSERT_EQ(1, read(first[0], &byte, 1));
+    writeByte(first[1]);
+    ASSERT_EQ(1, reactor->wait(ready));
+    ASSERT_EQ(std::vector<int>{first[0]}, ready);
+}
+
+TEST_P(IoUringReactorTest, ASocketReadSinceItsPollCompletedIsNotReported)
+{
+    reactor->watch(first[0]);
+    reactor->watch(second[0]);
+    writeByte(second[1]);
+    ASSERT_EQ(1, reactor->wait(ready));
+
+    // the poll of first completes between two waits, as the RTIG reads it
+    writeByte(first[1]);
+    char byte;
+    ASSERT_EQ(1, read(first[0], &byte, 1));
+    ASSERT_EQ(1, read(second[0], &byte, 1));
+
+    writeByte(second[1]);
+    ASSERT_EQ(1, reactor->wait(ready));
+    ASSERT_EQ(std::vector<int>{second[0]}, ready);
+}
+
+TEST_P(IoUringReactorTest, AnUnwatchedSocketIsClosedForReal)
+{
+    reactor->watch(first[0]);
+    reactor->watch(second[0]);
+    writeByte(second[1]);
+    ASSERT_EQ(1, reactor->wait(ready));
+
+    reactor->unwatch(first[0]);
+    close(first[0]);
+    first[0] = -1;
+
+    // the peer sees the end of file, no poll request keeps the socket open
+    struct pollfd peer = {first[1], POLLIN, 0};
+    ASSERT_EQ(1, poll(&peer, 1, 1000));
+    char byte;
+    ASSERT_EQ(0, read(first[1], &byte, 1));
+}
+
+TEST_P(IoUringReactorTest, QueuedFramesAreWrittenInOrderOnFlush)
+{
+    SocketTCP server;
+    server.createServer(0, htonl(INADDR_LOOPBACK));
+    Link one(server);
+    Link two(server);
+
+    auto small = frameOf(1, 100);
+    auto large = frameOf(2, 100000);
+
+    reactor->queueSend(&one.rtig, *small);
+    reactor->queueSend(&two.rtig, *large);
+    reactor->queueSend(&one.rtig, *large);
+    reactor->flushSends(lost);
+    ASSERT_TRUE(lost.empty());
+
+    ASSERT_EQ(1u, receivedObject(one.rtia));
+    ASSERT_EQ(2u, receivedObject(one.rtia));
+    ASSERT_EQ(2u, receivedObject(two.rtia));
+}
+
+TEST_P(IoUringReactorTest, FramesLargerThanTheSocketBufferAreWrittenWhole)
+{
+    SocketTCP server;
+    server.createServer(0, htonl(INADDR_LOOPBACK));
+    Link link(server);
+
+    // more than the socket buffers hold: the rest is written once the reader runs
+    auto huge = frameOf(3, 16 * 1024 * 1024);
+    ::certi::ObjectHandle object = 0;
+    std::thread reader([&]() { object = receivedObject(link.rtia); });
+
+    reactor->queueSend(&link.rtig, *huge);
+    reactor->flushSends(lost);
+    reader.join();
+
+    ASSERT_EQ(3u, object);
+}
+
+TEST_P(IoUringReactorTest, ALostLinkIsReportedOnFlush)
+{
+    SocketTCP server;
+    server.createServer(0, htonl(INADDR_LOOPBACK));
+    Link link(server);
+    Link other(server);
+    link.rtia.close();
+    // as the RTIG does (see RTIG::signalHandler)
+    auto previous = std::signal(SIGPIPE, SIG_IGN);
+
+    auto frame = frameOf(4, 100000);
+    for (int i = 0; i < 100 && lost.empty(); ++i) {
+        reactor->queueSend(&link.rtig, *frame);
+        reactor->flushSends(lost);
+    }
+    ASSERT_EQ(std::vector<SocketTCP*>{&link.rtig}, lost);
+
+    // the others are still written to
+    lost.clear();
+    reactor->queueSend(&other.rtig, *frame);
+    reactor->flushSends(lost);
+    ASSERT_TRUE(lost.empty());
+    ASSERT_EQ(4u, receivedObject(other.rtia));
+
+    std::signal(SIGPIPE, previous);
+}
+
+TEST_P(IoUringReactorTest, TheDataOfAWatchedLinkIsReceivedInOrder)
+{
+    SocketTCP server;
+    server.createServer(0, htonl(INADDR_LOOPBACK));
+    Link link(server);
+    reactor->watch(&link.rtig);
+
+    // more than the buffers provided to the kernel hold
+    std::thread sender([&]() {
+        for (::certi::ObjectHandle object = 1; object <= 40; ++object) {
+            auto frame = frameOf(object, 100000);
+            link.rtia.send(static_cast<unsigned char*>((*frame)(0)), frame->size());
+        }
+    });
+
+    ASSERT_EQ(1, reactor->wait(ready));
+    ASSERT_EQ(std::vector<int>{link.rtig.returnSocket()}, ready);
+    for (::certi::ObjectHandle object = 1; object <= 40; ++object) {
+        ASSERT_EQ(object, receivedObject(link.rtig));
+    }
+    sender.join();
+}
+
+TEST_P(IoUringReactorTest, AWatchedLinkIsReportedUntilItsDataIsReceived)
+{
+    SocketTCP server;
+    server.createServer(0, htonl(INADDR_LOOPBACK));
+    Link link(server);
+    reactor->watch(&link.rtig);
+
+    auto frame = frameOf(5, 100);
+    link.rtia.send(static_cast<unsigned char*>((*frame)(0)), frame->size());
+    link.rtia.send(static_cast<unsigned char*>((*frame)(0)), frame->size());
+
+    ASSERT_EQ(1, reactor->wait(ready));
+    ASSERT_EQ(5u, receivedObject(link.rtig));
+    ASSERT_TRUE(link.rtig.isDataReady());
+    ASSERT_EQ(5u, receivedObject(link.rtig));
+
+    writeByte(first[1]);
+    reactor->watch(first[0]);
+    ASSERT_EQ(1, reactor->wait(ready));
+    ASSERT_EQ(std::vector<int>{first[0]}, ready);
+}
+
+TEST_P(IoUringReactorTest, AWatchedLinkClosedByItsPeerThrowsOnReceive)
+{
+    SocketTCP server;
+    server.createServer(0, htonl(INADDR_LOOPBACK));
+    Link link(server);
+    reactor->watch(&link.rtig);
+    link.rtia.close();
+
+    ASSERT_EQ(1, reactor->wait(ready));
+    ASSERT_EQ(std::vector<int>{link.rtig.returnSocket()}, ready);
+    ASSERT_THROW(receivedObject(link.rtig), ::certi::NetworkError);
+}
+
+TEST_P(IoUringReactorTest, AnUnwatchedLinkIsClosedForReal)
+{
+    SocketTCP server;
+    server.createServer(0, htonl(INADDR_LOOPBACK));
+    Link link(server);
+    reactor->watch(&link.rtig);
+    reactor->watch(first[0]);
+    writeByte(first[1]);
+    ASSERT_EQ(1, reactor->wait(ready));
+
+    reactor->unwatch(link.rtig.returnSocket());
+    link.rtig.close();
+
+    // the peer sees the end of file, no reception keeps the socket open
+    struct pollfd peer = {link.rtia.returnSocket(), POLLIN, 0};
+    ASSERT_EQ(1, poll(&peer, 1, 1000));
+    char byte;
+    ASSERT_EQ(0, read(link.rtia.returnSocket(), &byte, 1));
+}
+
+TEST_P(IoUringReactorTest, ConnectionsToAWatchedServerAreAccepted)
+{
+    SocketTCP server;
+    server.createServer(0, htonl(INADDR_LOOPBACK));
+    reactor->watchServer(&server);
+    struct sockaddr_in address;
+    socklen_t length = sizeof(address);
+    getsockname(server.returnSocket(), (struct sockaddr*) &address, &length);
+
+    SocketTCP rtias[2];
+    for (auto& rtia : rtias) {
+        rtia.createTCPClient(ntohs(address.sin_port), htonl(INADDR_LOOPBACK));
+    }
+
+    SocketTCP rtigs[2];
+    for (::certi::ObjectHandle object = 1; object <= 2; ++object) {
+        ASSERT_EQ(1, reactor->wait(ready));
+        ASSERT_EQ(std::vector<int>{server.returnSocket()}, ready);
+        rtigs[object - 1].accept(&server);
+
+        auto frame = frameOf(object, 100);
+        rtigs[object - 1].send(static_cast<unsigned char*>((*frame)(0)), frame->size());
+    }
+
+    // in the order of the connections
+    ASSERT_EQ(1u, receivedObject(rtias[0]));
+    ASSERT_EQ(2u, receivedObject(rtias[1]));
+}
+
+INSTANTIATE_TEST_SUITE_P(Reactor, IoUringReactorTest, ::testing::Values(true, false), [](const ::testing::TestParamInfo<bool>& info) {
+    return info.param ? "IoUring" : "Poll";
+});
+
+#endif
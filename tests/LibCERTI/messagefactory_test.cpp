@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <libCERTI/M_Classes.hh>
+#include <libCERTI/SocketUN.hh>
+#include <libHLA/MessageBuffer.hh>
+
+using ::certi::M_Factory;
+using ::certi::M_Join_Federation_Execution;
+using ::certi::Message;
+using ::certi::SocketUN;
+using ::libhla::MessageBuffer;
+
+namespace {
+/// Both ends of a federate/RTIA link
+struct Link {
+    Link() : sender(certi::stIgnoreSignal), receiver(certi::stIgnoreSignal)
+    {
+        receiver.setSocketFD(sender.socketpair());
+    }
+
+    SocketUN sender;
+    SocketUN receiver;
+};
+
+void sendJoin(SocketUN& socket, MessageBuffer& buffer, unsigned federate, const std::string& name)
+{
+    M_Join_Federation_Execution msg;
+    msg.setFederate(federate);
+    msg.setFederationName(name);
+    msg.setFederateName(name + "_federate");
+    msg.send(&socket, buffer);
+}
+
+void expectJoin(Message* received, unsigned federate, const std::string& name)
+{
+    std::unique_ptr<Message> msg(received);
+    ASSERT_EQ(Message::JOIN_FEDERATION_EXECUTION, msg->getMessageType());
+
+    auto join = dynamic_cast<M_Join_Federation_Execution*>(msg.get());
+    ASSERT_NE(nullptr, join);
+    ASSERT_EQ(federate, join->getFederate());
+    ASSERT_EQ(name, join->getFederationName());
+    ASSERT_EQ(name + "_federate", join->getFederateName());
+}
+}
+
+TEST(MessageFactoryTest, ReceiveBuildsTheSpecificMessage)
+{
+    Link link;
+    MessageBuffer buffer;
+
+    sendJoin(link.sender, buffer, 3, "federation");
+    expectJoin(M_Factory::receive(&link.receiver), 3, "federation");
+}
+
+TEST(MessageFactoryTest, ReceiveWithCallerBufferReusesIt)
+{
+    Link link;
+    MessageBuffer sendBuffer;
+    MessageBuffer receiveBuffer;
+
+    for (unsigned i = 0; i < 3; ++i) {
+        sendJoin(link.sender, sendBuffer, i, "federation" + std::to_string(i));
+        expectJoin(M_Factory::receive(&link.receiver, receiveBuffer), i, "federation" + std::to_string(i));
+    }
+}
+
+TEST(MessageFactoryTest, ConcurrentReceivesDoNotShareState)
+{
+    static constexpr int threadCount = 4;
+    static constexpr int messageCount = 500;
+
+    std::vector<std::unique_ptr<Link>> links;
+    for (int i = 0; i < threadCount; ++i) {
+        links.emplace_back(new Link);
+    }
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        SocketUN& sender = links[i]->sender;
+        SocketUN& receiver = links[i]->receiver;
+        // names of different sizes, so that a shared buffer would mix them up
+        const std::string name(static_cast<size_t>(1 + 17 * i), static_cast<char>('a' + i));
+
+        threads.emplace_back([&sender, i, name] {
+            MessageBuffer buffer;
+            for (int n = 0; n < messageCount; ++n) {
+                sendJoin(sender, buffer, i, name);
+            }
+        });
+        threads.emplace_back([&receiver, i, name] {
+            for (int n = 0; n < messageCount; ++n) {
+                expectJoin(M_Factory::receive(&receiver), i, name);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+TEST(MessageFactoryTest, SerializedSizeIsExactForEveryType)
+{
+    MessageBuffer buffer;
+
+    for (int t = Message::NOT_USED + 1; t < Message::LAST; ++t) {
+        std::unique_ptr<Message> msg(M_Factory::create(static_cast<Message::Type>(t)));
+        msg->setTag("tag");
+        buffer.reset();
+        msg->serialize(buffer);
+
+        ASSERT_EQ(buffer.size(), MessageBuffer::reservedBytes + msg->serializedSize()) << msg->getMessageName();
+    }
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#include <libCERTI/NM_Classes.hh>
+#include <libHLA/BlockPool.hh>
+#include <libHLA/MessageBuffer.hh>
+
+using ::certi::NetworkMessage;
+using ::libhla::BlockPool;
+using ::libhla::MessageBuffer;
+
+namespace {
+std::atomic<bool> counting{false};
+std::atomic<unsigned long> allocations{0};
+
+/// Number of heap allocations made by f.
+template <typename F>
+unsigned long countAllocations(F f)
+{
+    allocations = 0;
+    counting = true;
+    f();
+    counting = false;
+    return allocations;
+}
+}
+
+// Every heap allocation of the test program (libraries included) goes through here.
+void* operator new(size_t size)
+{
+    if (counting) {
+        ++allocations;
+    }
+    void* block = std::malloc(size ? size : 1);
+    if (!block) {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void operator delete(void* block) noexcept
+{
+    std::free(block);
+}
+
+void operator delete(void* block, size_t) noexcept
+{
+    std::free(block);
+}
+
+TEST(BlockPoolTest, CapacityIsASizeClass)
+{
+    ASSERT_EQ(32u, BlockPool::capacity(1));
+    ASSERT_EQ(32u, BlockPool::capacity(32));
+    ASSERT_EQ(64u, BlockPool::capacity(33));
+    ASSERT_EQ(BlockPool::maxPooledSize, BlockPool::capacity(BlockPool::maxPooledSize));
+    ASSERT_EQ(BlockPool::maxPooledSize + 1, BlockPool::capacity(BlockPool::maxPooledSize + 1));
+}
+
+TEST(BlockPoolTest, ReleasedBlockIsReused)
+{
+    void* block = BlockPool::allocate(100);
+    BlockPool::release(block, 100);
+
+    void* again = nullptr;
+    ASSERT_EQ(0u, countAllocations([&again] { again = BlockPool::allocate(120); }));
+    ASSERT_EQ(block, again);
+
+    BlockPool::release(again, 120);
+}
+
+TEST(BlockPoolTest, MessageBufferStorageIsRecycled)
+{
+    auto fill = [] {
+        MessageBuffer buffer;
+        for (int i = 0; i < 1000; ++i) {
+            buffer.write_uint64(i);
+        }
+    };
+
+    fill();
+    ASSERT_EQ(0u, countAllocations(fill));
+}
+
+TEST(BlockPoolTest, SteadyStateMessageExchangeDoesNotAllocate)
+{
+    MessageBuffer sendBuffer;
+    MessageBuffer receiveBuffer;
+
+    // same steps as NetworkMessage::send and NM_Factory::receive, without the socket
+    auto exchange = [&sendBuffer, &receiveBuffer] {
+        std::unique_ptr<NetworkMessage> sent(::certi::NM_Factory::create(NetworkMessage::Type::MESSAGE_NULL));
+        sent->setFederate(7);
+        sent->setDate(certi::FederationTime(12.5));
+        sent->send(nullptr, sendBuffer);
+
+        receiveBuffer.reset();
+        receiveBuffer.resize(sendBuffer.size());
+        memcpy(receiveBuffer(0), sendBuffer(0), sendBuffer.size());
+        receiveBuffer.assumeSizeFromReservedBytes();
+
+        std::unique_ptr<NetworkMessage> received(::certi::NM_Factory::create(NetworkMessage::Type::MESSAGE_NULL));
+        received->deserialize(receiveBuffer);
+
+        ASSERT_EQ(7u, received->getFederate());
+        ASSERT_EQ(12.5, received->getDate().getTime());
+    };
+
+    // first exchange fills the free lists and sizes the buffers
+    exchange();
+
+    ASSERT_EQ(0u, countAllocations([&exchange] {
+                  for (int i = 0; i < 1000; ++i) {
+                      exchange();
+                  }
+              }));
+}
@@ -1,10 +1,16 @@
 #include <gtest/gtest.h>
 
+#include "libCERTI/NM_Classes.hh"
 #include "libCERTI/NetworkMessage.hh"
 
 #include <include/make_unique.hh>
 
+#include <cstring>
+#include <memory>
+#include <vector>
+
 using ::certi::NetworkMessage;
+using ::libhla::MessageBuffer;
 
 TEST(NetworkMessageTest, CopyCtorExistsAndWorks)
 {
@@ -29,3 +35,229 @@ TEST(NetworkMessageTest, CopyCtorInUniquePtrExistsAndWorks)
     ASSERT_EQ(msg.getFederate(), msg2->getFederate());
     ASSERT_EQ(msg.getFederation(), msg2->getFederation());
 }
+
+TEST(NetworkMessageTest, SerializedSizeIsExactForEveryType)
+{
+    using Type = NetworkMessage::Type;
+    MessageBuffer buffer;
+
+    for (int t = static_cast<int>(Type::NOT_USED) + 1; t < static_cast<int>(Type::LAST); ++t) {
+        std::unique_ptr<NetworkMessage> msg(::certi::NM_Factory::create(static_cast<Type>(t)));
+        msg->setLabel("label");
+        msg->send(nullptr, buffer);
+
+        ASSERT_EQ(buffer.size(), MessageBuffer::reservedBytes + msg->serializedSize()) << msg->getMessageName();
+    }
+}
+
+TEST(NetworkMessageTest, SerializedSizeIsExactWithRepeatedFields)
+{
+    MessageBuffer buffer;
+
+    ::certi::NM_Reflect_Attribute_Values msg;
+    msg.setAttributesSize(3);
+    msg.setValuesSize(3);
+    for (uint32_t i = 0; i < 3; ++i) {
+        msg.setAttributes(i + 1, i);
+        msg.setValues(::certi::AttributeValue_t(7 * i, 'v'), i);
+    }
+    msg.setTag("tag");
+    msg.setDate(::certi::FederationTime(1.5));
+    msg.send(nullptr, buffer);
+    ASSERT_EQ(buffer.size(), MessageBuffer::reservedBytes + msg.serializedSize());
+
+    msg.setException(::certi::Exception::Type::RTIinternalError, "reason");
+    msg.send(nullptr, buffer);
+    ASSERT_EQ(buffer.size(), MessageBuffer::reservedBytes + msg.serializedSize());
+}
+
+TEST(NetworkMessageTest, RepeatedHandlesRoundTrip)
+{
+    MessageBuffer buffer;
+
+    ::certi::NM_Update_Attribute_Values sent;
+    sent.setAttributesSize(100);
+    sent.setValuesSize(100);
+    for (uint32_t i = 0; i < 100; ++i) {
+        sent.setAttributes(1000 + i, i);
+        sent.setValues(::certi::AttributeValue_t(i, static_cast<char>(i)), i);
+    }
+    sent.send(nullptr, buffer);
+    buffer.assumeSizeFromReservedBytes();
+
+    ::certi::NM_Update_Attribute_Values received;
+    received.deserialize(buffer);
+
+    ASSERT_EQ(sent.getAttributes(), received.getAttributes());
+    ASSERT_EQ(sent.getValues(), received.getValues());
+}
+
+TEST(NetworkMessageTest, CompactEncodingRoundTrip)
+{
+    MessageBuffer sent;
+    MessageBuffer received;
+
+    ::certi::NM_Reflect_Attribute_Values msg;
+    msg.setFederate(2);
+    msg.setFederation(1);
+    msg.setObject(17);
+    msg.setAttributesSize(8);
+    msg.setValuesSize(8);
+    for (uint32_t i = 0; i < 8; ++i) {
+        msg.setAttributes(10 + i, i);
+        msg.setValues(::certi::AttributeValue_t(8, 'v'), i);
+    }
+    msg.setDate(::certi::FederationTime(2.0));
+
+    sent.reset();
+    sent.setCompact(true);
+    msg.serialize(sent);
+    sent.updateReservedBytes();
+    ASSERT_LT(sent.size(), MessageBuffer::reservedBytes + msg.serializedSize());
+
+    memcpy(received(0), sent(0), MessageBuffer::reservedBytes);
+    received.assumeSizeFromReservedBytes();
+    memcpy(received(MessageBuffer::reservedBytes),
+           sent(MessageBuffer::reservedBytes),
+           sent.size() - MessageBuffer::reservedBytes);
+
+    ::certi::NM_Reflect_Attribute_Values read;
+    read.deserialize(received);
+
+    ASSERT_EQ(msg.getFederate(), read.getFederate());
+    ASSERT_EQ(msg.getObject(), read.getObject());
+    ASSERT_EQ(msg.getAttributes(), read.getAttributes());
+    ASSERT_EQ(msg.getValues(), read.getValues());
+    ASSERT_EQ(2.0, read.getDate().getTime());
+    ASSERT_FALSE(read.isLabelled());
+}
+
+TEST(NetworkMessageTest, JoinFromOlderPeerHasNoWireFormat)
+{
+    MessageBuffer buffer;
+
+    ::certi::NM_Join_Federation_Execution msg;
+    msg.setFederationExecutionName("federation");
+    msg.setFederateType("type");
+    msg.send(nullptr, buffer);
+
+    // an older peer does not write the trailing wireFormat presence flag
+    buffer.assumeSizeFromReservedBytes();
+    buffer.assumeSize(buffer.size() - 1);
+
+    ::certi::NM_Join_Federation_Execution read;
+    read.deserialize(buffer);
+    ASSERT_FALSE(read.hasWireFormat());
+    ASSERT_EQ("federation", read.getFederationExecutionName());
+}
+
+TEST(NetworkMessageTest, BatchedFramesDecodeInOrder)
+{
+    MessageBuffer buffer;
+    std::vector<unsigned char> batch;
+
+    for (uint32_t object = 1; object <= 3; ++object) {
+        ::certi::NM_Update_Attribute_Values msg;
+        msg.setObject(object);
+        msg.serializeFrame(buffer, object % 2 == 0);
+        const unsigned char* frame = static_cast<unsigned char*>(buffer(0));
+        batch.insert(batch.end(), frame, frame + buffer.size());
+    }
+
+    // what the RTIG does with its read ahead buffer: one frame after the other
+    size_t offset = 0;
+    for (uint32_t object = 1; object <= 3; ++object) {
+        const uint32_t size = MessageBuffer::sizeFromReservedBytes(batch.data() + offset);
+        buffer.reset();
+        memcpy(buffer(0), batch.data() + offset, MessageBuffer::reservedBytes);
+        buffer.assumeSizeFromReservedBytes();
+        memcpy(buffer(MessageBuffer::reservedBytes),
+               batch.data() + offset + MessageBuffer::reservedBytes,
+               size - MessageBuffer::reservedBytes);
+        offset += size;
+
+        ::certi::NM_Update_Attribute_Values read;
+        read.deserialize(buffer);
+        ASSERT_EQ(object, read.getObject());
+    }
+    ASSERT_EQ(batch.size(), offset);
+}
+
+namespace {
+/// Keeps what is sent, as the peer would read it
+class RecordingSocket : public ::certi::Socket {
+public:
+    void createConnection(const char*, unsigned int) override
+    {
+    }
+    void send(const unsigned char* data, size_t size) override
+    {
+        received.insert(received.end(), data, data + size);
+    }
+    void sendSegments(const std::vector<MessageBuffer::Segment>& segments) override
+    {
+        ++gatherWrites;
+        for (const auto& segment : segments) {
+            received.insert(received.end(), segment.data, segment.data + segment.length);
+        }
+    }
+    void receive(void*, unsigned long) override
+    {
+    }
+    void close() override
+    {
+    }
+    bool isDataReady() const override
+    {
+        return false;
+    }
+    unsigned long returnAdress() const override
+    {
+        return 0;
+    }
+    SOCKET returnSocket() override
+    {
+        return 0;
+    }
+
+    std::vector<unsigned char> received;
+    int gatherWrites{0};
+};
+}
+
+TEST(NetworkMessageTest, LargeValuesAreSentWithoutCopy)
+{
+    ::certi::NM_Update_Attribute_Values msg;
+    msg.setObject(7);
+    msg.setAttributesSize(2);
+    msg.setAttributes(1, 0);
+    msg.setAttributes(2, 1);
+    msg.setValuesSize(2);
+    msg.setValues(::certi::AttributeValue_t(4 * MessageBuffer::segmentThreshold, 'x'), 0);
+    msg.setValues(::certi::AttributeValue_t(8, 'y'), 1);
+
+    MessageBuffer plain;
+    msg.serializeFrame(plain, false);
+
+    RecordingSocket socket;
+    MessageBuffer buffer;
+    msg.send(&socket, buffer);
+
+    ASSERT_EQ(1, socket.gatherWrites);
+    ASSERT_LT(buffer.maxSize(), MessageBuffer::segmentThreshold);
+    const unsigned char* expected = static_cast<unsigned char*>(plain(0));
+    ASSERT_EQ(std::vector<unsigned char>(expected, expected + plain.size()), socket.received);
+}
+
+TEST(NetworkMessageTest, SmallMessagesAreSentAtOnce)
+{
+    ::certi::NM_Update_Attribute_Values msg;
+    msg.setObject(7);
+
+    RecordingSocket socket;
+    MessageBuffer buffer;
+    msg.send(&socket, buffer);
+
+    ASSERT_EQ(0, socket.gatherWrites);
+    ASSERT_EQ(buffer.size(), socket.received.size());
+}
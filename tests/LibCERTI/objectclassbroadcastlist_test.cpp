@@ -590,6 +590,58 @@ TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageUpdatesState)
     ASSERT_EQ(ObjectBroadcastLine::State::Sent, line->stateFor(attr_handle));
 }
 
+TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageIsReliableByDefault)
+{
+    ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+    MockSecurityServer ss(s, a, ::certi::FederationHandle(3));
+    EXPECT_CALL(ss, getSocketLink(federate_handle, ::certi::RELIABLE)).WillOnce(::testing::ReturnNull());
+
+    auto message = new ::certi::NM_Reflect_Attribute_Values;
+    message->setFederate(sender_handle);
+    message->setAttributesSize(max_handle);
+    ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, max_handle);
+
+    l.addFederate(federate_handle, attr_handle);
+
+    l.preparePendingMessage(ss);
+}
+
+TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageUsesTransport)
+{
+    ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+    MockSecurityServer ss(s, a, ::certi::FederationHandle(3));
+    EXPECT_CALL(ss, getSocketLink(federate_handle, ::certi::BEST_EFFORT)).WillOnce(::testing::ReturnNull());
+
+    auto message = new ::certi::NM_Reflect_Attribute_Values;
+    message->setFederate(sender_handle);
+    message->setAttributesSize(max_handle);
+    ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, max_handle);
+    l.setTransport(::certi::BEST_EFFORT);
+
+    l.addFederate(federate_handle, attr_handle);
+
+    l.preparePendingMessage(ss);
+}
+
+TEST(ObjectClassBroadcastListTest, PreparePendingDOMessageIsAlwaysReliable)
+{
+    ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+    MockSecurityServer ss(s, a, ::certi::FederationHandle(3));
+    EXPECT_CALL(ss, getSocketLink(federate_handle, ::certi::RELIABLE)).WillOnce(::testing::ReturnNull());
+
+    auto message = new ::certi::NM_Discover_Object;
+    message->setFederate(sender_handle);
+    ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, max_handle);
+    l.setTransport(::certi::BEST_EFFORT);
+
+    l.addFederate(federate_handle, 0);
+
+    l.preparePendingMessage(ss);
+}
+
 /*TEST(ObjectClassBroadcastListTest, SendPendingRAVMessageAllWaitingSendsBaseMessage)
 {
     auto message = new ::certi::NM_Reflect_Attribute_Values;
@@ -813,3 +865,122 @@ TEST(ObjectClassBroadcastListTest, PreparePendingRAOAMessageCatchesNetworkErrors
 
     ASSERT_NO_THROW(l.preparePendingMessage(ss));
 }
+
+TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageSendsOnceToTheGroup)
+{
+    ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+    MockSecurityServer ss(s, a, ::certi::FederationHandle(3));
+    EXPECT_CALL(ss, getSocketLink(_, _)).Times(0);
+
+    ::certi::SocketUDP group;
+    const std::set<::certi::FederateHandle> members{federate_handle, federate3_handle};
+
+    auto message = new ::certi::NM_Reflect_Attribute_Values;
+    message->setFederate(sender_handle);
+    message->setAttributesSize(max_handle);
+    ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, max_handle);
+    l.setTransport(::certi::BEST_EFFORT);
+    l.setMulticastGroup(&group, members, 5, 2);
+
+    l.addFederate(federate_handle, attr_handle);
+    l.addFederate(federate3_handle, attr_handle);
+
+    auto result = l.preparePendingMessage(ss);
+
+    ASSERT_EQ(1u, result.size());
+    ASSERT_EQ(std::vector<::certi::Socket*>{&group}, result.front().sockets());
+
+    auto sent = static_cast<::certi::NM_Reflect_Attribute_Values*>(result.front().message());
+    ASSERT_TRUE(sent->hasMulticastClass());
+    ASSERT_EQ(5u, sent->getMulticastClass());
+
+    ASSERT_EQ(ObjectBroadcastLine::State::Sent, getLineForFederate(l, federate_handle)->stateFor(attr_handle));
+    ASSERT_EQ(ObjectBroadcastLine::State::Sent, getLineForFederate(l, federate3_handle)->stateFor(attr_handle));
+}
+
+TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageIsUnicastBelowTheThreshold)
+{
+    ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+    MockSecurityServer ss(s, a, ::certi::FederationHandle(3));
+    EXPECT_CALL(ss, getSocketLink(federate_handle, ::certi::BEST_EFFORT)).WillOnce(::testing::ReturnNull());
+    EXPECT_CALL(ss, getSocketLink(federate3_handle, ::certi::BEST_EFFORT)).WillOnce(::testing::ReturnNull());
+
+    ::certi::SocketUDP group;
+    const std::set<::certi::FederateHandle> members{federate_handle, federate3_handle};
+
+    auto message = new ::certi::NM_Reflect_Attribute_Values;
+    message->setFederate(sender_handle);
+    message->setAttributesSize(max_handle);
+    ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, max_handle);
+    l.setTransport(::certi::BEST_EFFORT);
+    l.setMulticastGroup(&group, members, 5, 3);
+
+    l.addFederate(federate_handle, attr_handle);
+    l.addFederate(federate3_handle, attr_handle);
+
+    auto result = l.preparePendingMessage(ss);
+
+    ASSERT_EQ(2u, result.size());
+    for (auto& response : result) {
+        ASSERT_FALSE(static_cast<::certi::NM_Reflect_Attribute_Values*>(response.message())->hasMulticastClass());
+    }
+}
+
+TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageIsUnicastToNonMembers)
+{
+    ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+    MockSecurityServer ss(s, a, ::certi::FederationHandle(3));
+    EXPECT_CALL(ss, getSocketLink(federate_handle, _)).Times(0);
+    EXPECT_CALL(ss, getSocketLink(federate2_handle, ::certi::BEST_EFFORT)).WillOnce(::testing::ReturnNull());
+
+    ::certi::SocketUDP group;
+    const std::set<::certi::FederateHandle> members{federate_handle};
+
+    auto message = new ::certi::NM_Reflect_Attribute_Values;
+    message->setFederate(sender_handle);
+    message->setAttributesSize(max_handle);
+    ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, max_handle);
+    l.setTransport(::certi::BEST_EFFORT);
+    l.setMulticastGroup(&group, members, 5, 1);
+
+    l.addFederate(federate_handle, attr_handle);
+    l.addFederate(federate2_handle, attr_handle);
+
+    auto result = l.preparePendingMessage(ss);
+
+    ASSERT_EQ(2u, result.size());
+    ASSERT_EQ(std::vector<::certi::Socket*>{&group}, result.front().sockets());
+}
+
+TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageIsUnicastOnceSentThroughASubclass)
+{
+    ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+    MockSecurityServer ss(s, a, ::certi::FederationHandle(3));
+    EXPECT_CALL(ss, getSocketLink(federate_handle, ::certi::BEST_EFFORT)).WillOnce(::testing::ReturnNull());
+    EXPECT_CALL(ss, getSocketLink(federate3_handle, ::certi::BEST_EFFORT)).WillOnce(::testing::ReturnNull());
+
+    ::certi::SocketUDP group;
+    const std::set<::certi::FederateHandle> members{federate_handle, federate3_handle};
+
+    auto message = new ::certi::NM_Reflect_Attribute_Values;
+    message->setFederate(sender_handle);
+    message->setAttributesSize(max_handle);
+    ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, max_handle);
+    l.setTransport(::certi::BEST_EFFORT);
+
+    // the subclass level is sent without group
+    l.addFederate(federate_handle, attr_handle);
+    ASSERT_EQ(1u, l.preparePendingMessage(ss).size());
+
+    l.setMulticastGroup(&group, members, 5, 1);
+    l.addFederate(federate3_handle, attr_handle);
+
+    auto result = l.preparePendingMessage(ss);
+
+    ASSERT_EQ(1u, result.size());
+    ASSERT_FALSE(static_cast<::certi::NM_Reflect_Attribute_Values*>(result.front().message())->hasMulticastClass());
+}
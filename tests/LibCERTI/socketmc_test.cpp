@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <config.h>
+
+#include <arpa/inet.h>
+
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/SocketMC.hh>
+
+#include "../mocks/sockettcp_mock.h"
+
+using ::certi::SocketMC;
+using ::certi::SocketUDP;
+
+namespace {
+static const in_addr_t base = inet_addr("239.192.0.0");
+
+/// A group on the loopback, sent to through a link attached to a server as the RTIG does.
+class SocketMCTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        server.createServer(0, htonl(INADDR_LOOPBACK));
+        SocketMC::setSendInterface(server, htonl(INADDR_LOOPBACK));
+
+        receiver.createReceiver(htonl(INADDR_LOOPBACK));
+        receiver.bindReceiver(port);
+
+        group = SocketMC::groupAddress(base, SocketMC::Group::ObjectClass, 3);
+        if (!receiver.join(group)) {
+            GTEST_SKIP() << "no multicast on the loopback";
+        }
+        link.attach(server, group, htons(port), nullptr);
+    }
+
+    void sendReflection(::certi::ObjectHandle object)
+    {
+        ::certi::NM_Reflect_Attribute_Values message;
+        message.setObject(object);
+        message.setMulticastClass(3);
+        message.setAttributesSize(1);
+        message.setAttributes(1, 0);
+        message.setValuesSize(1);
+        message.setValues(::certi::AttributeValue_t(16, 'v'), 0);
+        message.send(&link, buffer);
+        link.flush();
+    }
+
+    bool waitData()
+    {
+        fd_set fdset;
+        FD_ZERO(&fdset);
+        FD_SET(receiver.returnSocket(), &fdset);
+        struct timeval timeout {1, 0};
+        return receiver.isDataReady()
+            || select(receiver.returnSocket() + 1, &fdset, nullptr, nullptr, &timeout) > 0;
+    }
+
+    static constexpr unsigned int port = SocketMC::defaultPort + 7;
+
+    SocketUDP server;
+    SocketUDP link;
+    SocketMC receiver;
+    in_addr_t group;
+    libhla::MessageBuffer buffer;
+};
+
+constexpr unsigned int SocketMCTest::port;
+}
+
+TEST(SocketMCGroupTest, ClassesOfBothKindsHaveTheirOwnGroup)
+{
+    ASSERT_EQ(inet_addr("239.192.0.0"), SocketMC::groupAddress(base, SocketMC::Group::ObjectClass, 0));
+    ASSERT_EQ(inet_addr("239.192.0.1"), SocketMC::groupAddress(base, SocketMC::Group::InteractionClass, 0));
+    ASSERT_EQ(inet_addr("239.192.0.6"), SocketMC::groupAddress(base, SocketMC::Group::ObjectClass, 3));
+    ASSERT_EQ(inet_addr("239.192.1.3"), SocketMC::groupAddress(base, SocketMC::Group::InteractionClass, 129));
+}
+
+TEST(SocketMCGroupTest, GroupsStayInTheMulticastRange)
+{
+    const in_addr_t last_base = inet_addr("239.255.255.0");
+    ASSERT_EQ(127u, SocketMC::lastGroupHandle(last_base));
+    ASSERT_TRUE(SocketMC::hasGroup(last_base, 127));
+    ASSERT_EQ(inet_addr("239.255.255.255"), SocketMC::groupAddress(last_base, SocketMC::Group::InteractionClass, 127));
+    ASSERT_FALSE(SocketMC::hasGroup(last_base, 128));
+    ASSERT_FALSE(SocketMC::hasGroup(last_base, 0xFFFFFFFF));
+
+    ASSERT_FALSE(SocketMC::hasGroup(inet_addr("239.255.255.255"), 0));
+    ASSERT_FALSE(SocketMC::hasGroup(inet_addr("192.168.0.1"), 0));
+}
+
+TEST(SocketMCGroupTest, ReceiverIsWatchableBeforeBeingBound)
+{
+    SocketMC receiver;
+    ASSERT_FALSE(receiver.isReceiverCreated());
+
+    receiver.createReceiver();
+    ASSERT_TRUE(receiver.isReceiverCreated());
+    ASSERT_FALSE(receiver.isBound());
+    ASSERT_GE(receiver.returnSocket(), 0);
+
+    receiver.close();
+    ASSERT_FALSE(receiver.isReceiverCreated());
+}
+
+TEST_F(SocketMCTest, JoinedGroupIsReceived)
+{
+    ASSERT_TRUE(receiver.isJoined(group));
+
+    sendReflection(7);
+
+    ASSERT_TRUE(waitData());
+    std::unique_ptr<::certi::NetworkMessage> received(::certi::NM_Factory::receive(&receiver));
+    ASSERT_EQ(::certi::NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES, received->getMessageType());
+
+    auto reflection = static_cast<::certi::NM_Reflect_Attribute_Values*>(received.get());
+    ASSERT_EQ(7u, reflection->getObject());
+    ASSERT_TRUE(reflection->hasMulticastClass());
+    ASSERT_EQ(3u, reflection->getMulticastClass());
+}
+
+TEST_F(SocketMCTest, LeftGroupIsNotReceived)
+{
+    receiver.leave(group);
+    ASSERT_FALSE(receiver.isJoined(group));
+
+    sendReflection(7);
+
+    ASSERT_FALSE(waitData());
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <config.h>
+
+#include <arpa/inet.h>
+#include <unistd.h>
+
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/SocketTCP.hh>
+
+using ::certi::SocketTCP;
+
+#ifdef SOCKTCP_LOCAL_SOCKET
+namespace {
+/// A local server, and a client connected to a link it accepted, as the RTIG and a local RTIA.
+class SocketTCPLocalTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        server.createLocalServer(name);
+        client.createLocalClient(name);
+        link.accept(&server);
+    }
+
+    const std::string name{"certi-test-" + std::to_string(getpid())};
+
+    SocketTCP server;
+    SocketTCP client;
+    SocketTCP link;
+    libhla::MessageBuffer buffer;
+};
+}
+
+TEST_F(SocketTCPLocalTest, LinksAreLocal)
+{
+    ASSERT_TRUE(server.isLocal());
+    ASSERT_TRUE(client.isLocal());
+    ASSERT_TRUE(link.isLocal());
+    ASSERT_EQ(htonl(INADDR_LOOPBACK), link.returnAdress());
+}
+
+TEST_F(SocketTCPLocalTest, MessagesGoThroughUnchanged)
+{
+    ::certi::NM_Reflect_Attribute_Values message;
+    message.setObject(7);
+    message.setAttributesSize(1);
+    message.setAttributes(1, 0);
+    message.setValuesSize(1);
+    message.setValues(::certi::AttributeValue_t(100000, 'v'), 0);
+    message.send(&client, buffer);
+
+    std::unique_ptr<::certi::NetworkMessage> received(::certi::NM_Factory::receive(&link));
+
+    ASSERT_EQ(::certi::NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES, received->getMessageType());
+    auto reflection = static_cast<::certi::NM_Reflect_Attribute_Values*>(received.get());
+    ASSERT_EQ(7u, reflection->getObject());
+    ASSERT_EQ(100000u, reflection->getValues(0).size());
+}
+
+TEST_F(SocketTCPLocalTest, TheKernelGivesThePeerCredentials)
+{
+    uid_t user;
+    pid_t process;
+
+    ASSERT_TRUE(link.getPeerCredentials(user, process));
+    ASSERT_EQ(getuid(), user);
+    ASSERT_EQ(getpid(), process);
+}
+
+TEST_F(SocketTCPLocalTest, ASecondServerWithTheSameNameThrows)
+{
+    SocketTCP other;
+    ASSERT_THROW(other.createLocalServer(name), ::certi::NetworkError);
+}
+
+TEST(SocketTCPLocalClientTest, ConnectingWithoutServerThrowsAndLeavesTCPPossible)
+{
+    SocketTCP server;
+    server.createServer(0, htonl(INADDR_LOOPBACK));
+    struct sockaddr_in address;
+    socklen_t length = sizeof(address);
+    ASSERT_EQ(0, getsockname(server.returnSocket(), (struct sockaddr*) &address, &length));
+
+    SocketTCP client;
+    ASSERT_THROW(client.createLocalClient("certi-test-nobody"), ::certi::NetworkError);
+    ASSERT_FALSE(client.isLocal());
+
+    client.createTCPClient(ntohs(address.sin_port), htonl(INADDR_LOOPBACK));
+    ASSERT_FALSE(client.isLocal());
+}
+
+TEST(SocketTCPLocalAddressTest, LoopbackIsLocal)
+{
+    ASSERT_TRUE(SocketTCP::isLocalAddress(htonl(INADDR_LOOPBACK)));
+    ASSERT_FALSE(SocketTCP::isLocalAddress(inet_addr("192.0.2.1")));
+}
+#endif
+
+TEST(SocketTCPServerTest, AReservedServerAcceptsLinksOnlyOnceListening)
+{
+    SocketTCP server;
+    server.reserveServer(0, htonl(INADDR_LOOPBACK));
+    struct sockaddr_in address;
+    socklen_t length = sizeof(address);
+    ASSERT_EQ(0, getsockname(server.returnSocket(), (struct sockaddr*) &address, &length));
+    ASSERT_NE(0, address.sin_port);
+
+    SocketTCP early;
+    ASSERT_THROW(early.createTCPClient(ntohs(address.sin_port), htonl(INADDR_LOOPBACK), 1000), ::certi::NetworkError);
+
+    server.listenServer();
+    SocketTCP client;
+    client.createTCPClient(ntohs(address.sin_port), htonl(INADDR_LOOPBACK), 1000);
+    SocketTCP link;
+    link.accept(&server);
+}
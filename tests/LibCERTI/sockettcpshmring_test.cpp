@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <csignal>
+#include <memory>
+#include <thread>
+
+#include <config.h>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/SocketTCP.hh>
+
+#ifdef SOCKTCP_LOCAL_SOCKET
+#include <libCERTI/SocketTCPSHMRing.hh>
+
+using ::certi::SocketTCP;
+using ::certi::SocketTCPSHMRing;
+
+namespace {
+/// A local RTIG link and the RTIA end of it, the segment created but not activated.
+class SocketTCPSHMRingTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        server.createLocalServer(name);
+        rtia.createLocalClient(name);
+        rtig.accept(&server);
+        segment = rtia.create(4096);
+    }
+
+    void activate()
+    {
+        rtig.attach(segment);
+        rtig.activate();
+        rtia.activate();
+    }
+
+    static bool isReadable(SocketTCP& socket)
+    {
+        struct pollfd fd = {socket.returnSocket(), POLLIN, 0};
+        return poll(&fd, 1, 0) == 1;
+    }
+
+    void sendReflection(SocketTCP& from, ::certi::ObjectHandle object)
+    {
+        ::certi::NM_Reflect_Attribute_Values message;
+        message.setObject(object);
+        message.setAttributesSize(1);
+        message.setAttributes(1, 0);
+        message.setValuesSize(1);
+        message.setValues(::certi::AttributeValue_t(1000, 'v'), 0);
+        message.send(&from, buffer);
+    }
+
+    const std::string name{"certi-test-shm-" + std::to_string(getpid())};
+
+    SocketTCP server;
+    SocketTCPSHMRing rtia;
+    SocketTCPSHMRing rtig;
+    std::string segment;
+    libhla::MessageBuffer buffer;
+};
+}
+
+TEST_F(SocketTCPSHMRingTest, MessagesGoThroughTheRingsBothWays)
+{
+    activate();
+    ASSERT_TRUE(rtia.isActive());
+    ASSERT_TRUE(rtig.isActive());
+
+    // more than the rings hold in total, so that they wrap around
+    for (::certi::ObjectHandle object = 1; object <= 20; ++object) {
+        sendReflection(rtia, object);
+        std::unique_ptr<::certi::NetworkMessage> received(::certi::NM_Factory::receive(&rtig));
+        ASSERT_EQ(object, static_cast<::certi::NM_Reflect_Attribute_Values*>(received.get())->getObject());
+
+        sendReflection(rtig, object);
+        received.reset(::certi::NM_Factory::receive(&rtia));
+        ASSERT_EQ(object, static_cast<::certi::NM_Reflect_Attribute_Values*>(received.get())->getObject());
+    }
+
+    // nothing went through the socket
+    ASSERT_FALSE(isReadable(rtig));
+    ASSERT_FALSE(isReadable(rtia));
+}
+
+TEST_F(SocketTCPSHMRingTest, TheSocketIsReadableOnlyWhenTheReceiverWaits)
+{
+    activate();
+
+    sendReflection(rtia, 1);
+    ASSERT_FALSE(isReadable(rtig));
+    ASSERT_TRUE(rtig.isDataReady());
+    delete ::certi::NM_Factory::receive(&rtig);
+
+    // as before select(): nothing to read, the doorbell is armed
+    ASSERT_FALSE(rtig.isDataReady());
+    sendReflection(rtia, 2);
+    ASSERT_TRUE(isReadable(rtig));
+
+    std::unique_ptr<::certi::NetworkMessage> received(::certi::NM_Factory::receive(&rtig));
+    ASSERT_EQ(2u, static_cast<::certi::NM_Reflect_Attribute_Values*>(received.get())->getObject());
+    ASSERT_FALSE(isReadable(rtig));
+}
+
+TEST_F(SocketTCPSHMRingTest, ASenderFacingAFullRingWaitsForTheReceiver)
+{
+    activate();
+
+    // a few times what the ring holds, the receiver only starts later
+    std::thread sender([this]() {
+        for (::certi::ObjectHandle object = 1; object <= 20; ++object) {
+            sendReflection(rtia, object);
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    for (::certi::ObjectHandle object = 1; object <= 20; ++object) {
+        std::unique_ptr<::certi::NetworkMessage> received(::certi::NM_Factory::receive(&rtig));
+        ASSERT_EQ(object, static_cast<::certi::NM_Reflect_Attribute_Values*>(received.get())->getObject());
+    }
+    sender.join();
+}
+
+TEST_F(SocketTCPSHMRingTest, ASenderFacingAFullRingThrowsOnceThePeerIsGone)
+{
+    activate();
+    rtia.close();
+    auto previous = std::signal(SIGPIPE, SIG_IGN);
+
+    ASSERT_THROW(
+        {
+            for (::certi::ObjectHandle object = 1; object <= 20; ++object) {
+                sendReflection(rtig, object);
+            }
+        },
+        ::certi::NetworkError);
+
+    std::signal(SIGPIPE, previous);
+}
+
+TEST_F(SocketTCPSHMRingTest, ASenderFacingAFullRingThrowsAfterTheSendTimeout)
+{
+    rtig.setSendTimeout(300);
+    activate();
+
+    // the RTIA is connected but never reads
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_THROW(
+        {
+            for (::certi::ObjectHandle object = 1; object <= 20; ++object) {
+                sendReflection(rtig, object);
+            }
+        },
+        ::certi::NetworkError);
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(300));
+}
+
+TEST_F(SocketTCPSHMRingTest, ARefusedSegmentLeavesTheSocket)
+{
+    rtia.release();
+    rtia.activate();
+    ASSERT_FALSE(rtia.isActive());
+
+    sendReflection(rtia, 3);
+    ASSERT_TRUE(isReadable(rtig));
+
+    std::unique_ptr<::certi::NetworkMessage> received(::certi::NM_Factory::receive(&rtig));
+    ASSERT_EQ(3u, static_cast<::certi::NM_Reflect_Attribute_Values*>(received.get())->getObject());
+}
+
+TEST_F(SocketTCPSHMRingTest, AttachingAnUnknownSegmentThrows)
+{
+    ASSERT_THROW(rtig.attach("/certi_test_nobody"), ::certi::NetworkError);
+    ASSERT_FALSE(rtig.isActive());
+}
+
+TEST_F(SocketTCPSHMRingTest, TheSegmentIsUnlinkedOnceBothSidesUseIt)
+{
+    activate();
+    ASSERT_THROW(rtig.attach(segment), ::certi::NetworkError);
+}
+#endif
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <config.h>
+
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/SocketUDP.hh>
+
+#include "../mocks/sockettcp_mock.h"
+
+using ::certi::SocketUDP;
+
+using ::testing::_;
+
+namespace {
+/// A server on the loopback, and a client which receives from a link attached to it.
+class SocketUDPTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        server.createServer(0, htonl(INADDR_LOOPBACK));
+        client.createConnection(nullptr, 0);
+        link.attach(server, htonl(INADDR_LOOPBACK), client.getPort(), &fallback);
+    }
+
+    std::unique_ptr<::certi::NM_Reflect_Attribute_Values> reflection(::certi::ObjectHandle object, uint32_t size)
+    {
+        auto message = std::unique_ptr<::certi::NM_Reflect_Attribute_Values>(new ::certi::NM_Reflect_Attribute_Values);
+        message->setObject(object);
+        message->setAttributesSize(1);
+        message->setAttributes(1, 0);
+        message->setValuesSize(1);
+        message->setValues(::certi::AttributeValue_t(size, 'v'), 0);
+        return message;
+    }
+
+    ::certi::ObjectHandle receiveObject()
+    {
+        std::unique_ptr<::certi::NetworkMessage> received(::certi::NM_Factory::receive(&client));
+        EXPECT_EQ(::certi::NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES, received->getMessageType());
+        return static_cast<::certi::NM_Reflect_Attribute_Values*>(received.get())->getObject();
+    }
+
+    SocketUDP server;
+    SocketUDP client;
+    SocketUDP link;
+    MockSocketTcp fallback;
+    libhla::MessageBuffer buffer;
+};
+}
+
+TEST_F(SocketUDPTest, AttachedLinkSendsOnFlush)
+{
+    ASSERT_TRUE(link.isAttached());
+    ASSERT_FALSE(server.isAttached());
+
+    reflection(7, 16)->send(&link, buffer);
+    link.flush();
+
+    ASSERT_EQ(7u, receiveObject());
+    ASSERT_FALSE(client.isDataReady());
+}
+
+TEST_F(SocketUDPTest, MessagesKeepTheirOrderAcrossBatches)
+{
+    const auto count = 2 * SocketUDP::batchSize + 3;
+    for (auto i = 0u; i < count; ++i) {
+        reflection(i, 64)->send(&link, buffer);
+    }
+    server.flush();
+
+    for (auto i = 0u; i < count; ++i) {
+        ASSERT_EQ(i, receiveObject());
+    }
+    ASSERT_EQ(0u, server.getDroppedCount());
+    ASSERT_EQ(0u, client.getDroppedCount());
+}
+
+TEST_F(SocketUDPTest, SeveralDatagramsAreReadAtOnce)
+{
+    for (auto i = 0u; i < 3; ++i) {
+        reflection(i, 16)->send(&link, buffer);
+    }
+    server.flush();
+
+    ASSERT_EQ(0u, receiveObject());
+#ifdef HAVE_RECVMMSG
+    ASSERT_TRUE(client.isDataReady());
+#endif
+    ASSERT_EQ(1u, receiveObject());
+    ASSERT_EQ(2u, receiveObject());
+    ASSERT_FALSE(client.isDataReady());
+}
+
+TEST_F(SocketUDPTest, TooLargeMessageGoesToFallback)
+{
+    EXPECT_CALL(fallback, send(_, _)).Times(1);
+
+    reflection(1, SocketUDP::defaultMaxDatagramSize)->send(&link, buffer);
+    reflection(2, 16)->send(&link, buffer);
+    server.flush();
+
+    ASSERT_EQ(2u, receiveObject());
+    ASSERT_FALSE(client.isDataReady());
+}
+
+TEST_F(SocketUDPTest, MaxDatagramSizeIsSetOnTheServer)
+{
+    server.setMaxDatagramSize(8000);
+    ASSERT_EQ(8000u, link.getMaxDatagramSize());
+
+    server.setMaxDatagramSize(100000);
+    ASSERT_EQ(SocketUDP::maxDatagramSize, link.getMaxDatagramSize());
+
+    EXPECT_CALL(fallback, send(_, _)).Times(0);
+    reflection(3, 4000)->send(&link, buffer);
+    server.flush();
+
+    ASSERT_EQ(3u, receiveObject());
+}
+
+TEST_F(SocketUDPTest, MalformedDatagramIsDropped)
+{
+    const unsigned char garbage[] = {0, 0, 0, 0, 42, 1, 2};
+    link.send(garbage, sizeof(garbage));
+    reflection(5, 16)->send(&link, buffer);
+    server.flush();
+
+    ASSERT_EQ(5u, receiveObject());
+    ASSERT_EQ(1u, client.getDroppedCount());
+}
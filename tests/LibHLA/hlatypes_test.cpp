@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <libHLA/HLAtypesIEEE1516.hh>
 
@@ -203,3 +207,197 @@ TEST(HLATypesTest, Test7)
 
     ASSERT_EQ("0000:  02\n", result.str());
 }
+
+TEST(HLATypesTest, UserAllocatedBufferIsFound)
+{
+    using TA = HLAfixedRecord<HLAfixedField<field_a, HLAinteger32BE, HLAfixedField<field_b, HLAfloat64BE>>>;
+
+    char memory[16] = {};
+    {
+        HLAdata<TA> A(memory, sizeof(memory));
+        (*A).field<field_a>() = 5;
+        (*A).field<field_b>() = 1.5;
+        ASSERT_EQ(&A, &__HLAbuffer::__buffer(&(*A).field<field_b>()));
+    }
+    {
+        // same memory, another buffer: the first one must not be found any more
+        HLAdata<TA> B(memory, sizeof(memory));
+        ASSERT_EQ(&B, &__HLAbuffer::__buffer(&(*B).field<field_b>()));
+        ASSERT_EQ(5, (*B).field<field_a>());
+        ASSERT_EQ(1.5, (*B).field<field_b>());
+    }
+}
+
+TEST(HLATypesTest, ABufferDestroyedByAnotherThreadIsNotFound)
+{
+    using TA = HLAfixedRecord<HLAfixedField<field_a, HLAinteger32BE, HLAfixedField<field_b, HLAfloat64BE>>>;
+
+    char memory[16] = {};
+    std::unique_ptr<HLAdata<TA>> A(new HLAdata<TA>(memory, sizeof(memory)));
+    ASSERT_EQ(A.get(), &__HLAbuffer::__buffer(&(**A).field<field_b>()));
+
+    // this thread still caches A, which another thread replaces in the same memory
+    std::unique_ptr<HLAdata<TA>> B;
+    std::thread([&A, &B, &memory] {
+        A.reset();
+        B.reset(new HLAdata<TA>(memory, sizeof(memory)));
+    }).join();
+
+    ASSERT_EQ(B.get(), &__HLAbuffer::__buffer(&(**B).field<field_b>()));
+}
+
+TEST(HLATypesTest, ConcurrentBuffersDoNotInterfere)
+{
+    // clang-format off
+    using TA = HLAvariableArray<HLAfixedRecord<HLAfixedField<field_a, HLAvariableArray<HLAfloat64LE>,
+                                               HLAfixedField<field_b, HLAASCIIstring>>>>;
+    // clang-format on
+
+    static constexpr int threadCount = 4;
+    static constexpr int rounds = 200;
+
+    std::vector<std::thread> threads;
+    std::vector<int> failures(threadCount, 0);
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([t, &failures] {
+            const std::string name(static_cast<size_t>(1 + t), static_cast<char>('a' + t));
+            for (int round = 0; round < rounds; ++round) {
+                HLAdata<TA> A;
+                (*A).set_size(3);
+                for (int i = 0; i < 3; ++i) {
+                    (*A)[i].field<field_a>().set_size(i + 1);
+                    (*A)[i].field<field_a>()[i] = t + 0.5 * i;
+                    (*A)[i].field<field_b>() = name;
+                }
+                for (int i = 0; i < 3; ++i) {
+                    if ((*A)[i].field<field_a>()[i] != t + 0.5 * i
+                        || static_cast<std::string>((*A)[i].field<field_b>()) != name) {
+                        ++failures[t];
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(std::vector<int>(threadCount, 0), failures);
+}
+
+namespace {
+// clang-format off
+using PaddedRecord = HLAfixedRecord<HLAfixedField<field_a, HLAoctet,
+                                    HLAfixedField<field_b, HLAfloat64BE,
+                                    HLAfixedField<field_c, HLAinteger32BE>>>>;
+// clang-format on
+
+static_assert(PaddedRecord::__sizeof() == 20, "fixed record size is known at compile-time");
+static_assert(HLAfixedField<field_a, HLAoctet, HLAfixedField<field_b, HLAfloat64BE>>::field_offsetof(field_b) == 8,
+              "fixed field offset is known at compile-time");
+static_assert(HLAfixedArray<PaddedRecord, 2>::__sizeof() == 24 + 20, "fixed array size is known at compile-time");
+}
+
+TEST(HLATypesTest, ShakeKeepsPaddedFixedRecords)
+{
+    HLAdata<HLAvariableArray<PaddedRecord>> A;
+    (*A).set_size(1);
+    (*A)[0].field<field_a>() = 'x';
+    (*A)[0].field<field_b>() = 2.5;
+    (*A)[0].field<field_c>() = -7;
+
+    (*A).set_size(2);
+
+    ASSERT_EQ('x', (*A)[0].field<field_a>());
+    ASSERT_EQ(2.5, (*A)[0].field<field_b>());
+    ASSERT_EQ(-7, (*A)[0].field<field_c>());
+}
+
+TEST(HLATypesTest, ShakeKeepsFixedFieldsAfterVariableOnes)
+{
+    // clang-format off
+    using TA = HLAfixedRecord<HLAfixedField<field_a, HLAASCIIstring,
+                              HLAfixedField<field_b, HLAfloat64BE,
+                              HLAfixedField<field_c, HLAoctet>>>>;
+    // clang-format on
+
+    HLAdata<TA> A;
+    (*A).field<field_b>() = 1.25;
+    (*A).field<field_c>() = 'z';
+    // the padding before field_b changes with the string size
+    (*A).field<field_a>() = "abc";
+
+    ASSERT_EQ("abc", static_cast<std::string>((*A).field<field_a>()));
+    ASSERT_EQ(1.25, (*A).field<field_b>());
+    ASSERT_EQ('z', (*A).field<field_c>());
+}
+
+TEST(HLATypesTest, FixedArrayBulkSetAndGet)
+{
+    std::vector<double> doubles(100);
+    std::vector<long> longs(100);
+    for (int i = 0; i < 100; ++i) {
+        doubles[i] = i * 1.5;
+        longs[i] = -i;
+    }
+
+    HLAdata<HLAfixedArray<HLAfloat64BE, 100>> A;
+    (*A).set(doubles.data());
+    HLAdata<HLAfixedArray<HLAinteger32LE, 100>> B;
+    (*B).set(longs.data());
+
+    std::vector<double> readDoubles(100);
+    std::vector<long> readLongs(100);
+    (*A).get(readDoubles.data());
+    (*B).get(readLongs.data());
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(doubles[i], (*A)[i]);
+        ASSERT_EQ(longs[i], (*B)[i]);
+    }
+    ASSERT_EQ(doubles, readDoubles);
+    ASSERT_EQ(longs, readLongs);
+
+    std::stringstream result;
+    PrintBuffer(result, (*A)[1]);
+    ASSERT_EQ("0000:  3f f8 00 00 00 00 00 00\n", result.str());
+}
+
+namespace {
+//! Record of <N> HLAfloat64BE fields, like a large entity state (see also tests/Benchmark)
+template <int I, int N>
+struct __manyFields {
+    typedef HLAfixedField<I, HLAfloat64BE, typename __manyFields<I + 1, N>::Type> Type;
+};
+
+template <int N>
+struct __manyFields<N, N> {
+    typedef HLAfixedEnd Type;
+};
+
+using EntityState = HLAfixedRecord<__manyFields<0, 200>::Type>;
+
+template <int... I>
+void encode(EntityState& state, double value, std::integer_sequence<int, I...>)
+{
+    int expand[] = {((state.field<I>() = value + I), 0)...};
+    (void) expand;
+}
+
+template <int... I>
+double decode(const EntityState& state, std::integer_sequence<int, I...>)
+{
+    double sum = 0;
+    int expand[] = {((sum += state.field<I>()), 0)...};
+    (void) expand;
+    return sum;
+}
+}
+
+TEST(HLATypesTest, LargeFixedRecordFieldsAreIndependent)
+{
+    HLAdata<EntityState> A;
+    encode(*A, 1, std::make_integer_sequence<int, 200>());
+
+    ASSERT_EQ(200 + 200 * 199 / 2.0, decode(*A, std::make_integer_sequence<int, 200>()));
+    ASSERT_EQ(200u * 8, A.size());
+}
@@ -1,12 +1,15 @@
 #include <gtest/gtest.h>
 
 #include <cassert>
+#include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
 #include <string>
+#include <vector>
 
+#include <libHLA/ByteSwap.hh>
 #include <libHLA/MessageBuffer.hh>
 
 using ::std::cout;
@@ -455,6 +458,297 @@ TEST(MessageBufferTest, BufferCopyToEmulateNetworkSend)
     EXPECT_EQ(u16, vu16);
 }
 
+TEST(MessageBufferTest, CompactEncodingRoundTrip)
+{
+    MessageBuffer sent;
+    MessageBuffer received;
+
+    const uint32_t handles[] = {3, 4, 5, 9, 200, 201, 0xFFFFFFF0, 7};
+    const uint32_t count = sizeof(handles) / sizeof(handles[0]);
+    uint32_t handlesRead[count];
+
+    sent.setCompact(true);
+    sent.write_uint32(12);
+    sent.write_int32(-2);
+    sent.write_uint32s(handles, count);
+    sent.write_string("name");
+    sent.write_double(1.5);
+    sent.updateReservedBytes();
+
+    // small values take one byte, sorted lists about one byte per element
+    EXPECT_LT(sent.size(), MessageBuffer::reservedBytes + 4 + 4 + 4 * count + 4 + 4 + 8);
+
+    // the header keeps its fixed size and tells the encoding
+    EXPECT_EQ(sent.size(), MessageBuffer::sizeFromReservedBytes(static_cast<const uint8_t*>(sent(0))));
+    memcpy(received(0), sent(0), MessageBuffer::reservedBytes);
+    received.assumeSizeFromReservedBytes();
+    ASSERT_TRUE(received.isCompact());
+    ASSERT_EQ(sent.size(), received.size());
+    memcpy(received(MessageBuffer::reservedBytes),
+           sent(MessageBuffer::reservedBytes),
+           sent.size() - MessageBuffer::reservedBytes);
+
+    EXPECT_EQ(12u, received.read_uint32());
+    EXPECT_EQ(-2, received.read_int32());
+    received.read_uint32s(handlesRead, count);
+    for (uint32_t i = 0; i < count; ++i) {
+        EXPECT_EQ(handles[i], handlesRead[i]);
+    }
+    EXPECT_EQ("name", received.read_string());
+    EXPECT_EQ(1.5, received.read_double());
+    EXPECT_TRUE(received.endOfBuffer());
+}
+
+TEST(MessageBufferTest, CompactEncodingZigzagsSignedScalars)
+{
+    struct Expected {
+        int32_t value;
+        uint32_t size;
+    };
+    const Expected values[] = {{-1, 1}, {-64, 1}, {63, 1}, {-65, 2}, {64, 2}, {-8192, 2}, {-8193, 3}, {INT32_MIN, 5}};
+
+    for (const auto& expected : values) {
+        MessageBuffer sent;
+        sent.setCompact(true);
+        sent.write_int32(expected.value);
+        sent.updateReservedBytes();
+        EXPECT_EQ(MessageBuffer::reservedBytes + expected.size, sent.size()) << expected.value;
+
+        MessageBuffer received;
+        received.resize(sent.size());
+        memcpy(received(0), sent(0), sent.size());
+        received.assumeSizeFromReservedBytes();
+        EXPECT_EQ(expected.value, received.read_int32());
+        EXPECT_TRUE(received.endOfBuffer());
+    }
+}
+
+TEST(MessageBufferTest, CompactEncodingZigzagsTheFirstSignedArrayValue)
+{
+    const int32_t values[] = {-3, -2, -1, 0, -100};
+    const uint32_t count = sizeof(values) / sizeof(values[0]);
+    int32_t valuesRead[count];
+
+    MessageBuffer sent;
+    sent.setCompact(true);
+    sent.write_int32s(values, count);
+    sent.updateReservedBytes();
+    EXPECT_EQ(MessageBuffer::reservedBytes + count + 1, sent.size());
+
+    MessageBuffer received;
+    received.resize(sent.size());
+    memcpy(received(0), sent(0), sent.size());
+    received.assumeSizeFromReservedBytes();
+    received.read_int32s(valuesRead, count);
+    for (uint32_t i = 0; i < count; ++i) {
+        EXPECT_EQ(values[i], valuesRead[i]);
+    }
+}
+
+TEST(MessageBufferTest, ResetGoesBackToFixedSizeEncoding)
+{
+    MessageBuffer msgBuf;
+
+    msgBuf.setCompact(true);
+    msgBuf.write_uint32(1);
+    msgBuf.reset();
+    ASSERT_FALSE(msgBuf.isCompact());
+
+    msgBuf.write_uint32(1);
+    ASSERT_EQ(MessageBuffer::reservedBytes + 4u, msgBuf.size());
+}
+
+TEST(MessageBufferTest, TruncatedVarintThrows)
+{
+    MessageBuffer msgBuf;
+
+    msgBuf.setCompact(true);
+    msgBuf.write_uint32(0xFFFFFFFF);
+    msgBuf.assumeSize(msgBuf.size() - 1);
+
+    ASSERT_THROW(msgBuf.read_uint32(), MessageBuffer::MessageBufferError);
+}
+
+TEST(MessageBufferTest, GrowthIsGeometricBeyondPooledSizes)
+{
+    MessageBuffer msgBuf;
+    const std::vector<uint8_t> chunk(64 * 1024, 0x5a);
+
+    uint32_t capacity = msgBuf.maxSize();
+    int reallocations = 0;
+    while (msgBuf.size() < 8 * 1024 * 1024) {
+        msgBuf.write_uint8s(chunk.data(), chunk.size());
+        if (msgBuf.maxSize() != capacity) {
+            EXPECT_GE(msgBuf.maxSize(), 2 * capacity);
+            capacity = msgBuf.maxSize();
+            ++reallocations;
+        }
+    }
+    EXPECT_LE(reallocations, 20);
+}
+
+TEST(MessageBufferTest, SegmentedBufferHasTheSameContent)
+{
+    const std::vector<uint8_t> large(3 * MessageBuffer::segmentThreshold, 0xa5);
+    const std::vector<uint8_t> small(16, 0x11);
+
+    auto write = [&](MessageBuffer& msgBuf) {
+        msgBuf.write_uint32(42);
+        msgBuf.write_uint8s(large.data(), large.size());
+        msgBuf.write_uint8s(small.data(), small.size());
+        msgBuf.write_uint8s(large.data(), large.size());
+        msgBuf.write_uint32(43);
+        msgBuf.updateReservedBytes();
+    };
+
+    MessageBuffer plain;
+    write(plain);
+
+    MessageBuffer segmented;
+    segmented.setSegmented(true);
+    write(segmented);
+
+    ASSERT_FALSE(plain.hasSegments());
+    ASSERT_TRUE(segmented.hasSegments());
+    ASSERT_EQ(plain.size(), segmented.size());
+
+    std::vector<uint8_t> gathered;
+    for (const auto& segment : segmented.segments()) {
+        gathered.insert(gathered.end(), segment.data, segment.data + segment.length);
+    }
+    const uint8_t* expected = static_cast<uint8_t*>(plain(0));
+    ASSERT_EQ(std::vector<uint8_t>(expected, expected + plain.size()), gathered);
+
+    // the large arrays are referenced, not copied
+    ASSERT_EQ(5u, segmented.segments().size());
+    ASSERT_EQ(large.data(), segmented.segments()[1].data);
+
+    segmented.reset();
+    ASSERT_FALSE(segmented.hasSegments());
+    ASSERT_EQ(MessageBuffer::reservedBytes, segmented.size());
+}
+
+namespace {
+/// A buffer in the other endianness, as written by a peer of the other kind
+void assumeOtherEndianness(MessageBuffer& msgBuf)
+{
+    if (MessageBuffer::HostIsLittleEndian()) {
+        msgBuf.assumeBufferIsBigEndian();
+    }
+    else {
+        msgBuf.assumeBufferIsLittleEndian();
+    }
+}
+}
+
+TEST(MessageBufferTest, SwappedArraysMatchScalarSwap)
+{
+    // every tail length of the vector kernels, at an odd offset
+    for (uint32_t n = 0; n < 40; ++n) {
+        std::vector<uint16_t> u16(n);
+        std::vector<uint32_t> u32(n);
+        std::vector<uint64_t> u64(n);
+        for (uint32_t i = 0; i < n; ++i) {
+            u16[i] = static_cast<uint16_t>(0x0102 + 0x1111 * i);
+            u32[i] = 0x01020304 + 0x11111111 * i;
+            u64[i] = 0x0102030405060708ULL + 0x1111111111111111ULL * i;
+        }
+
+        MessageBuffer msgBuf;
+        assumeOtherEndianness(msgBuf);
+        msgBuf.write_uint8(0);
+        const int32_t at16 = msgBuf.write_uint16s(u16.data(), n);
+        const int32_t at32 = msgBuf.write_uint32s(u32.data(), n);
+        const int32_t at64 = msgBuf.write_uint64s(u64.data(), n);
+
+        for (uint32_t i = 0; i < n; ++i) {
+            uint16_t v16;
+            uint32_t v32;
+            uint64_t v64;
+            memcpy(&v16, static_cast<uint8_t*>(msgBuf(at16 + 2 * i)), 2);
+            memcpy(&v32, static_cast<uint8_t*>(msgBuf(at32 + 4 * i)), 4);
+            memcpy(&v64, static_cast<uint8_t*>(msgBuf(at64 + 8 * i)), 8);
+            ASSERT_EQ(LIBHLA_UINT16_SWAP_BYTES(u16[i]), v16) << n << " " << i;
+            ASSERT_EQ(LIBHLA_UINT32_SWAP_BYTES(u32[i]), v32) << n << " " << i;
+            ASSERT_EQ(LIBHLA_UINT64_SWAP_BYTES(u64[i]), v64) << n << " " << i;
+        }
+
+        std::vector<uint16_t> r16(n);
+        std::vector<uint32_t> r32(n);
+        std::vector<uint64_t> r64(n);
+        msgBuf.read_uint8();
+        msgBuf.read_uint16s(r16.data(), n);
+        msgBuf.read_uint32s(r32.data(), n);
+        msgBuf.read_uint64s(r64.data(), n);
+        ASSERT_EQ(u16, r16);
+        ASSERT_EQ(u32, r32);
+        ASSERT_EQ(u64, r64);
+    }
+}
+
+TEST(MessageBufferTest, SwappedDoublesRoundTrip)
+{
+    std::vector<double> values(1000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = 1.5 * i - 0.25;
+    }
+
+    MessageBuffer msgBuf;
+    assumeOtherEndianness(msgBuf);
+    msgBuf.write_doubles(values.data(), values.size());
+
+    std::vector<double> read(values.size());
+    msgBuf.read_doubles(read.data(), read.size());
+    ASSERT_EQ(values, read);
+}
+
+TEST(MessageBufferBenchmark, SwappedArrayThroughput)
+{
+    static constexpr uint32_t elements = 1000;
+    static constexpr int rounds = 20000;
+
+    std::vector<uint64_t> data(elements, 0x0102030405060708ULL);
+    std::vector<uint64_t> read(elements);
+
+    std::cerr << "    byte swap kernel: " << libhla::ByteSwap::kernel() << std::endl;
+
+    for (const bool swapped : {false, true}) {
+        for (const int size : {2, 4, 8}) {
+            MessageBuffer msgBuf;
+            if (swapped) {
+                assumeOtherEndianness(msgBuf);
+            }
+
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int round = 0; round < rounds; ++round) {
+                msgBuf.reset();
+                if (swapped) {
+                    assumeOtherEndianness(msgBuf);
+                }
+                switch (size) {
+                case 2:
+                    msgBuf.write_uint16s(reinterpret_cast<uint16_t*>(data.data()), elements);
+                    msgBuf.read_uint16s(reinterpret_cast<uint16_t*>(read.data()), elements);
+                    break;
+                case 4:
+                    msgBuf.write_uint32s(reinterpret_cast<uint32_t*>(data.data()), elements);
+                    msgBuf.read_uint32s(reinterpret_cast<uint32_t*>(read.data()), elements);
+                    break;
+                default:
+                    msgBuf.write_uint64s(data.data(), elements);
+                    msgBuf.read_uint64s(read.data(), elements);
+                }
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+
+            const double seconds = std::chrono::duration<double>(end - start).count();
+            const double megabytes = 2.0 * rounds * elements * size / (1024 * 1024);
+            std::cerr << "    " << (swapped ? "swapped" : "native ") << " write+read of " << elements << " x "
+                      << 8 * size << " bits: " << megabytes / seconds << " MiB/s" << std::endl;
+        }
+    }
+}
+
 #ifdef HOST_IS_BIG_ENDIAN
 TEST(MessageBufferTest, BigEndianHost)
 {
@@ -1,10 +1,18 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+
 #define TEST_FOR_FEDERATION
 #include <RTIG/Federation.hh>
 
 #include <libCERTI/AuditFile.hh>
 #include <libCERTI/NM_Classes.hh>
+#include <libCERTI/ObjectClass.hh>
+#include <libCERTI/RootObject.hh>
 #include <libCERTI/SocketServer.hh>
 #include <libCERTI/SocketTCP.hh>
 
@@ -206,6 +214,94 @@ TEST_F(FederationTest, CtorFailsIfXmlFedWithoutXmlSupport)
 }
 #endif
 
+#ifdef HAVE_XML
+namespace {
+void writeXmlFom(const std::string& path, const std::string& attribute)
+{
+    std::ofstream file(path);
+    file << "<?xml version=\"1.0\"?>" << std::endl
+         << "<objectModel>" << std::endl
+         << "  <objects>" << std::endl
+         << "    <objectClass name=\"Ball\">" << std::endl
+         << "      <attribute name=\"" << attribute << "\" transportation=\"HLAreliable\" order=\"TimeStamp\" />"
+         << std::endl
+         << "      <objectClass name=\"ColoredBall\">" << std::endl
+         << "        <attribute name=\"Color\" transportation=\"HLAbestEffort\" order=\"Receive\" />" << std::endl
+         << "      </objectClass>" << std::endl
+         << "    </objectClass>" << std::endl
+         << "  </objects>" << std::endl
+         << "  <interactions>" << std::endl
+         << "    <interactionClass name=\"Hit\" transportation=\"HLAreliable\" order=\"TimeStamp\">" << std::endl
+         << "      <parameter name=\"Strength\" />" << std::endl
+         << "    </interactionClass>" << std::endl
+         << "  </interactions>" << std::endl
+         << "  <routingSpace name=\"Geo\">" << std::endl
+         << "    <dimension name=\"X\" />" << std::endl
+         << "  </routingSpace>" << std::endl
+         << "</objectModel>" << std::endl;
+}
+
+void expectSameFOM(Federation& expected, Federation& actual)
+{
+    ::certi::NM_Join_Federation_Execution expected_fom;
+    ::certi::NM_Join_Federation_Execution actual_fom;
+    for (auto fom : {&expected_fom, &actual_fom}) {
+        // only the FOM is compared
+        fom->setNumberOfRegulators(0);
+        fom->setMulticastAddress(0);
+        fom->setBestEffortAddress(0);
+        fom->setBestEffortPeer(0);
+        fom->setRtiVersion(::certi::HLA_1_3);
+    }
+    expected.getFOM(expected_fom);
+    actual.getFOM(actual_fom);
+
+    ::libhla::MessageBuffer expected_buffer;
+    ::libhla::MessageBuffer actual_buffer;
+    expected_fom.serialize(expected_buffer);
+    actual_fom.serialize(actual_buffer);
+
+    ASSERT_EQ(expected_buffer.size(), actual_buffer.size());
+    ASSERT_EQ(0, memcmp(expected_buffer(0), actual_buffer(0), expected_buffer.size()));
+
+    auto& expected_root = expected.getRootObject();
+    auto& actual_root = actual.getRootObject();
+    ASSERT_EQ(expected_root.freeObjectClassHandle, actual_root.freeObjectClassHandle);
+    ASSERT_EQ(expected_root.freeInteractionClassHandle, actual_root.freeInteractionClassHandle);
+    ASSERT_EQ(expected_root.freeParameterHandle, actual_root.freeParameterHandle);
+    ASSERT_EQ(expected_root.freeSpaceHandle, actual_root.freeSpaceHandle);
+    ASSERT_EQ(expected_root.freeDimensionHandle, actual_root.freeDimensionHandle);
+}
+}
+
+TEST_F(FederationTest, SameXmlModuleGivesSameFOM)
+{
+    writeXmlFom("Cached.xml", "Position");
+
+    Federation first{"first", federation_handle, s, a, {"Cached.xml"}, "", ::certi::HLA_1_3, quiet};
+    Federation second{"second", federation_handle, s, a, {"Cached.xml"}, "", ::certi::HLA_1_3, quiet};
+
+    expectSameFOM(first, second);
+    ASSERT_EQ(2u, second.getRootObject().getObjectClass(2)->getHandleClassAttributeMap().size());
+
+    std::remove("Cached.xml");
+}
+
+TEST_F(FederationTest, ChangedXmlModuleIsParsedAgain)
+{
+    writeXmlFom("Cached.xml", "Position");
+    Federation first{"first", federation_handle, s, a, {"Cached.xml"}, "", ::certi::HLA_1_3, quiet};
+
+    writeXmlFom("Cached.xml", "Speed");
+    Federation second{"second", federation_handle, s, a, {"Cached.xml"}, "", ::certi::HLA_1_3, quiet};
+
+    ASSERT_NO_THROW(second.getRootObject().getObjectClass(1)->getAttributeHandle("Speed"));
+    ASSERT_THROW(second.getRootObject().getObjectClass(1)->getAttributeHandle("Position"), ::certi::NameNotFound);
+
+    std::remove("Cached.xml");
+}
+#endif
+
 TEST_F(FederationTest, VerboseLevelChangesOutput)
 {
     std::ostringstream oss;
@@ -273,6 +369,245 @@ TEST_F(FederationTest, AddFederateCreateUnderlying)
     ASSERT_EQ("fed", f.getFederate(fed).getName());
 }
 
+namespace {
+size_t countResponses(const ::certi::Responses& responses, ::certi::NetworkMessage::Type type)
+{
+    return std::count_if(responses.begin(), responses.end(), [type](const ::certi::MessageEvent<::certi::NetworkMessage>& r) {
+        return r.message()->getMessageType() == type;
+    });
+}
+
+const ::certi::NM_Join_Federation_Execution* joinAnswer(const ::certi::Responses& responses)
+{
+    for (const auto& r : responses) {
+        if (r.message()->getMessageType() == ::certi::NetworkMessage::Type::JOIN_FEDERATION_EXECUTION) {
+            return static_cast<const ::certi::NM_Join_Federation_Execution*>(r.message());
+        }
+    }
+    return nullptr;
+}
+
+/// The join answer as the RTIA reads it.
+std::unique_ptr<::certi::NM_Join_Federation_Execution> receivedJoinAnswer(const ::certi::Responses& responses, bool compact)
+{
+    auto answer = const_cast<::certi::NM_Join_Federation_Execution*>(joinAnswer(responses));
+    if (!answer) {
+        return nullptr;
+    }
+    ::libhla::MessageBuffer frame;
+    answer->serializeFrame(frame, compact);
+    frame.assumeSizeFromReservedBytes();
+
+    std::unique_ptr<::certi::NM_Join_Federation_Execution> received(new ::certi::NM_Join_Federation_Execution());
+    received->deserialize(frame);
+    return received;
+}
+}
+
+TEST_F(FederationTest, AddFederateAnswersWithTheFOM)
+{
+    ::certi::NM_Join_Federation_Execution fom;
+    f.getFOM(fom);
+
+    for (const auto& name : {"fed1", "fed2"}) {
+        auto responses = f.add(name, fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).second;
+
+        auto answer = receivedJoinAnswer(responses, false);
+        ASSERT_NE(nullptr, answer.get());
+        ASSERT_EQ("name", answer->getFederationExecutionName());
+        ASSERT_EQ(fom.getObjectClassesSize(), answer->getObjectClassesSize());
+        ASSERT_EQ(fom.getInteractionClassesSize(), answer->getInteractionClassesSize());
+        ASSERT_EQ(fom.getRoutingSpacesSize(), answer->getRoutingSpacesSize());
+        for (uint32_t i = 0; i < fom.getObjectClassesSize(); ++i) {
+            ASSERT_EQ(fom.getObjectClasses(i).getName(), answer->getObjectClasses(i).getName());
+            ASSERT_EQ(fom.getObjectClasses(i).getAttributesSize(), answer->getObjectClasses(i).getAttributesSize());
+        }
+    }
+}
+
+TEST_F(FederationTest, JoinAnswerIsAPlainJoinAnswerOnTheWire)
+{
+    auto responses = f.add("fed", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).second;
+    auto answer = const_cast<::certi::NM_Join_Federation_Execution*>(joinAnswer(responses));
+    ASSERT_NE(nullptr, answer);
+
+    // the same fields, with the FOM converted for this answer alone
+    ::certi::NM_Join_Federation_Execution plain(*answer);
+    f.getFOM(plain);
+    ASSERT_EQ(plain.serializedSize(), answer->serializedSize());
+
+    for (const bool compact : {false, true}) {
+        ::libhla::MessageBuffer spliced;
+        answer->serializeFrame(spliced, compact);
+        ::libhla::MessageBuffer expected;
+        plain.serializeFrame(expected, compact);
+
+        ASSERT_EQ(expected.size(), spliced.size());
+        ASSERT_EQ(0, memcmp(expected(0), spliced(0), expected.size()));
+        ASSERT_GE(answer->serializedSize(), spliced.size() - ::libhla::MessageBuffer::reservedBytes);
+    }
+}
+
+TEST_F(FederationTest, AddFederateWithoutModulesDoesNotResendTheFOM)
+{
+    f.add("fed1", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0);
+    auto responses = f.add("fed2", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).second;
+
+    ASSERT_EQ(0u, countResponses(responses, ::certi::NetworkMessage::Type::ADDITIONAL_FOM_MODULE));
+}
+
+namespace {
+const ::certi::NM_Peer_Route* peerRoute(const ::certi::Responses& responses)
+{
+    for (const auto& r : responses) {
+        if (r.message()->getMessageType() == ::certi::NetworkMessage::Type::PEER_ROUTE) {
+            return static_cast<const ::certi::NM_Peer_Route*>(r.message());
+        }
+    }
+    return nullptr;
+}
+
+std::vector<const ::certi::NM_Peer_Route*> peerRoutes(const ::certi::Responses& responses)
+{
+    std::vector<const ::certi::NM_Peer_Route*> routes;
+    for (const auto& r : responses) {
+        if (r.message()->getMessageType() == ::certi::NetworkMessage::Type::PEER_ROUTE) {
+            routes.push_back(static_cast<const ::certi::NM_Peer_Route*>(r.message()));
+        }
+    }
+    return routes;
+}
+}
+
+TEST_F(FederationTest, SubscribeObjectSendsNoRouteWithoutPeerToPeer)
+{
+    auto fed = f.add("fed", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 5000).first;
+
+    auto responses = f.subscribeObject(fed, 3, {2}, true);
+
+    ASSERT_EQ(0u, countResponses(responses, ::certi::NetworkMessage::Type::PEER_ROUTE));
+}
+
+TEST_F(FederationTest, AddFederateAnswersThePeerPortWithPeerToPeer)
+{
+    s.enablePeerToPeer();
+
+    auto answer = joinAnswer(f.add("fed", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 5000).second);
+
+    ASSERT_NE(nullptr, answer);
+    ASSERT_TRUE(answer->hasPeerPort());
+    ASSERT_EQ(5000u, answer->getPeerPort());
+}
+
+TEST_F(FederationTest, SubscribeObjectSendsTheRouteWithPeerToPeer)
+{
+    s.enablePeerToPeer();
+    auto fed = f.add("fed", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 5000).first;
+
+    auto responses = f.subscribeObject(fed, 3, {2}, true);
+
+    ASSERT_EQ(1u, countResponses(responses, ::certi::NetworkMessage::Type::PEER_ROUTE));
+    auto route = peerRoute(responses);
+    ASSERT_EQ(fed, route->getFederate());
+    ASSERT_EQ(3u, route->getObjectClass());
+    ASSERT_EQ(1u, route->getAttributesSize());
+    ASSERT_EQ(2u, route->getAttributes(0));
+    ASSERT_EQ(0x0100007fu, route->getPeerAddress());
+    ASSERT_EQ(5000u, route->getPeerPort());
+}
+
+TEST_F(FederationTest, UpdateAttributeValuesReflectsTheSequenceNumber)
+{
+    s.enablePeerToPeer();
+    auto publisher = f.add("pub", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 5000).first;
+    auto subscriber = f.add("sub", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 5001).first;
+    f.publishObject(publisher, 3, {2}, true);
+    f.subscribeObject(subscriber, 3, {2}, true);
+    auto object = f.registerObject(publisher, 3, "object").first;
+
+    auto responses = f.updateAttributeValues(publisher, object, {2}, {::certi::AttributeValue_t(8, 'v')}, "", 7);
+
+    auto reflection = std::find_if(responses.begin(), responses.end(), [](const ::certi::MessageEvent<::certi::NetworkMessage>& r) {
+        return r.message()->getMessageType() == ::certi::NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES;
+    });
+    ASSERT_NE(responses.end(), reflection);
+    auto message = static_cast<const ::certi::NM_Reflect_Attribute_Values*>(reflection->message());
+    ASSERT_TRUE(message->hasSequence());
+    ASSERT_EQ(7u, message->getSequence());
+}
+
+TEST_F(FederationTest, UnsubscribeObjectSendsAnEmptyRouteWithPeerToPeer)
+{
+    s.enablePeerToPeer();
+    auto fed = f.add("fed", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 5000).first;
+    f.subscribeObject(fed, 3, {2}, true);
+
+    auto route = peerRoute(f.subscribeObject(fed, 3, {}, true));
+
+    ASSERT_NE(nullptr, route);
+    ASSERT_EQ(3u, route->getObjectClass());
+    ASSERT_EQ(0u, route->getAttributesSize());
+}
+
+TEST_F(FederationTest, AddFederateSendsTheExistingRoutesWithPeerToPeer)
+{
+    s.enablePeerToPeer();
+    auto fed = f.add("fed1", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 5000).first;
+    f.subscribeObject(fed, 3, {2}, true);
+
+    auto responses = f.add("fed2", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 5001).second;
+
+    // besides the announcements of the federates
+    auto routes = peerRoutes(responses);
+    routes.erase(std::remove_if(routes.begin(), routes.end(), [](const ::certi::NM_Peer_Route* route) {
+        return route->getObjectClass() == 0;
+    }), routes.end());
+    ASSERT_EQ(1u, routes.size());
+    ASSERT_EQ(fed, routes.front()->getFederate());
+}
+
+TEST_F(FederationTest, AddFederateAnnouncesTheFederatesWithPeerToPeer)
+{
+    s.enablePeerToPeer();
+    auto fed1 = f.add("fed1", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 5000).first;
+
+    auto joined = f.add("fed2", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 5001);
+
+    std::map<::certi::FederateHandle, uint32_t> announced;
+    for (const auto route : peerRoutes(joined.second)) {
+        ASSERT_EQ(0u, route->getObjectClass());
+        announced[route->getFederate()] = route->getPeerPort();
+    }
+    ASSERT_EQ(2u, announced.size());
+    ASSERT_EQ(5000u, announced[fed1]);
+    ASSERT_EQ(5001u, announced[joined.first]);
+}
+
+TEST_F(FederationTest, AddFederateWithoutPeerPortIsNotAnnounced)
+{
+    s.enablePeerToPeer();
+    f.add("fed1", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 5000);
+
+    auto responses = f.add("fed2", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 0).second;
+
+    auto routes = peerRoutes(responses);
+    ASSERT_EQ(1u, routes.size());
+    ASSERT_EQ(5000u, routes.front()->getPeerPort());
+}
+
+TEST_F(FederationTest, RemoveFederateSendsTheEndOfItsRoutesWithPeerToPeer)
+{
+    s.enablePeerToPeer();
+    auto fed = f.add("fed1", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 5000).first;
+    f.add("fed2", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0x0100007f, 5001);
+
+    auto route = peerRoute(f.remove(fed));
+
+    ASSERT_NE(nullptr, route);
+    ASSERT_EQ(fed, route->getFederate());
+    ASSERT_EQ(0u, route->getObjectClass());
+}
+
 TEST_F(FederationTest, CannotAddSameFederateTwice)
 {
     f.add("fed", "typeerate", {}, ::certi::HLA_1_3, &federate_socket, 0, 0);
@@ -488,6 +823,68 @@ TEST_F(FederationTest, UpdateRegulatorNeedsValidRegulatorIfNotAnonymous)
 
 // TODO UpdateRegulator not tested
 
+TEST_F(FederationTest, RequestNullMessagesThrowsIfFederateDoesNotExists)
+{
+    ASSERT_THROW(f.requestNullMessages(ukn_federate, {}), ::certi::FederateNotExecutionMember);
+}
+
+TEST_F(FederationTest, RequestNullMessagesWithoutRegulatorsIsEmpty)
+{
+    auto handle = f.add("fed", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+
+    ASSERT_TRUE(f.requestNullMessages(handle, 10.0).empty());
+}
+
+TEST_F(FederationTest, RequestNullMessagesSkipsRequesterAndRegulatorsAhead)
+{
+    auto requester = f.add("requester", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+    auto regulator = f.add("regulator", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+
+    for (auto& handle_time : {std::make_pair(requester, 0.0), std::make_pair(regulator, 20.0)}) {
+        try {
+            f.addRegulator(handle_time.first, handle_time.second);
+        }
+        catch (certi::FederateNotExecutionMember& e) {
+            // SocketServer is empty, so we will throw from SocketServer::getWithReferences, but the regulator should be registered
+        }
+    }
+
+    ASSERT_EQ(2, f.getNbRegulators());
+    ASSERT_TRUE(f.requestNullMessages(requester, 10.0).empty());
+}
+
+TEST_F(FederationTest, RequestNullMessagesAsksOnlyTheLaggingRegulatorWhoseAnswerUnblocksTheRequester)
+{
+    auto requester = f.add("requester", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+    auto lagging = f.add("lagging", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+    auto ahead = f.add("ahead", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+
+    MockSocketTcp requester_socket, lagging_socket, ahead_socket;
+    s.links = {{requester, &requester_socket}, {lagging, &lagging_socket}, {ahead, &ahead_socket}};
+
+    f.addRegulator(lagging, 5.0);
+    f.addRegulator(ahead, 20.0);
+
+    // the requester waits for 10, only the regulator at 5 holds it back
+    auto requests = f.requestNullMessages(requester, 10.0);
+    ASSERT_EQ(1u, requests.size());
+    ASSERT_EQ(std::vector<::certi::Socket*>{&lagging_socket}, requests.front().sockets());
+    ASSERT_EQ(::certi::NetworkMessage::Type::MESSAGE_NULL_REQUEST, requests.front().message()->getMessageType());
+    ASSERT_EQ(requester, requests.front().message()->getFederate());
+    ASSERT_EQ(10.0, requests.front().message()->getDate().getTime());
+
+    // its NULL message goes past 10 and reaches the requester
+    auto nulls = f.updateRegulator(lagging, 12.0, false);
+    ASSERT_EQ(1u, nulls.size());
+    const auto& sockets = nulls.front().sockets();
+    ASSERT_NE(sockets.end(), std::find(sockets.begin(), sockets.end(), &requester_socket));
+    ASSERT_EQ(::certi::NetworkMessage::Type::MESSAGE_NULL, nulls.front().message()->getMessageType());
+    ASSERT_EQ(12.0, nulls.front().message()->getDate().getTime());
+
+    // nothing holds the requester back anymore
+    ASSERT_TRUE(f.requestNullMessages(requester, 10.0).empty());
+}
+
 TEST_F(FederationTest, RegisterSynchronizationAddsLabelToAllFederates)
 {
     auto handle = f.add("fed", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
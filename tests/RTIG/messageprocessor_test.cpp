@@ -148,6 +148,13 @@ TEST_F(MessageProcessorTest, Process_NM_Message_Null_Prime_Empty)
     ASSERT_ANY_THROW(mp.processEvent({nullptr, std::move(message)}););
 }
 
+TEST_F(MessageProcessorTest, Process_NM_Message_Null_Request_Empty)
+{
+    auto message = make_unique<::certi::NM_Message_Null_Request>();
+
+    ASSERT_NO_THROW(mp.processEvent({nullptr, std::move(message)});) << "This message has a special exception handling";
+}
+
 TEST_F(MessageProcessorTest, Process_NM_Register_Federation_Synchronization_Point_Empty)
 {
     auto message = make_unique<::certi::NM_Register_Federation_Synchronization_Point>();
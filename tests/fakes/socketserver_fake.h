@@ -1,15 +1,22 @@
 #pragma once
 
+#include <map>
+
 #include <libCERTI/SocketServer.hh>
 
 class FakeSocketServer : public ::certi::SocketServer {
+public:
     using SocketServer::SocketServer;
 
+    /// links of the federates, the others have none
+    std::map<::certi::FederateHandle, ::certi::Socket*> links;
+
     virtual ::certi::Socket* getSocketLink(::certi::FederationHandle /*the_federation*/,
-                                           ::certi::FederateHandle /*the_federate*/,
+                                           ::certi::FederateHandle the_federate,
                                            ::certi::TransportType /*the_type*/ = ::certi::RELIABLE) const override
     {
-        return nullptr;
+        auto link = links.find(the_federate);
+        return link == links.end() ? nullptr : link->second;
     }
 
     virtual void setReferences(long /*the_socket*/,
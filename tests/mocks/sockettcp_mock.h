@@ -9,6 +9,12 @@ class MockSocketTcp : public certi::SocketTCP {
 public:
     MOCK_METHOD2(send, void(const unsigned char* data, size_t size));
 
+    /// Segmented messages go through the mocked send() as well
+    void sendSegments(const std::vector<libhla::MessageBuffer::Segment>& segments) override
+    {
+        certi::Socket::sendSegments(segments);
+    }
+
     MOCK_METHOD2(receive, void(void* buffer, unsigned long size));
 };
 